@@ -1,2 +1,1632 @@
-var e,n,t,r,o,i,u,a,s,f,c,l,p,d,m,y,h,w,g,A,E,b,_,R,S,I,T,v,L,U,W,M,H,P,F,O,k,B,N,x,C="object"==typeof process&&"object"==typeof process.versions&&"string"==typeof process.versions.node&&"function"==typeof require;let q;if(C)try{q=require("path")}catch(e){}function D(e){throw new Error("wasm abort"+(e?": "+(e.stack||e):""))}"undefined"!=typeof module&&(e=module,module=void 0),(n={preRun:[],postRun:[],print:console.log.bind(console),printErr:console.error.bind(console)}).ready=new Promise(e=>{n.onRuntimeInitialized=(()=>{e({})})}),C&&q&&(n.locateFile=function(e){return q.join(__dirname,e)}),n.print;let j=n.printErr;for(r in t={},n=void 0!==n?n:{})n.hasOwnProperty(r)&&(t[r]=n[r]);for(r in o=[],i="object"==typeof window,u="function"==typeof importScripts,a="","object"==typeof process&&"object"==typeof process.versions&&"string"==typeof process.versions.node?(a=u?require("path").dirname(a)+"/":__dirname+"/",s=function(e,n){return l||(l=require("fs")),p||(p=require("path")),e=p.normalize(e),l.readFileSync(e,n?null:"utf8")},c=function(e){var n=s(e,!0);return n.buffer||(n=new Uint8Array(n)),n.buffer,n},f=function(e,n,t){l||(l=require("fs")),p||(p=require("path")),e=p.normalize(e),l.readFile(e,function(e,r){e?t(e):n(r.buffer)})},process.argv.length>1&&process.argv[1].replace(/\\/g,"/"),o=process.argv.slice(2),"undefined"!=typeof module&&(module.exports=n),n.inspect=function(){return"[Emscripten Module object]"}):(i||u)&&(u?a=self.location.href:"undefined"!=typeof document&&document.currentScript&&(a=document.currentScript.src),a=0!==a.indexOf("blob:")?a.substr(0,a.lastIndexOf("/")+1):"",s=function(e){var n=new XMLHttpRequest;return n.open("GET",e,!1),n.send(null),n.responseText},u&&(c=function(e){var n=new XMLHttpRequest;return n.open("GET",e,!1),n.responseType="arraybuffer",n.send(null),new Uint8Array(n.response)}),f=function(e,n,t){var r=new XMLHttpRequest;r.open("GET",e,!0),r.responseType="arraybuffer",r.onload=function(){200==r.status||0==r.status&&r.response?n(r.response):t()},r.onerror=t,r.send(null)}),t)t.hasOwnProperty(r)&&(n[r]=t[r]);function G(e){m.delete(_.get(e)),d.push(e)}function K(e,n){return function(e,n){var t,r,o,i;if(!m)for(m=new WeakMap,t=0;t<_.length;t++)(r=_.get(t))&&m.set(r,t);if(m.has(e))return m.get(e);o=function(){if(d.length)return d.pop();try{_.grow(1)}catch(e){if(!(e instanceof RangeError))throw e;throw"Unable to grow wasm table. Set ALLOW_TABLE_GROWTH."}return _.length-1}();try{_.set(o,e)}catch(t){if(!(t instanceof TypeError))throw t;i=function(e,n){var t,r,o,i,u,a,s,f,c;if("function"==typeof WebAssembly.Function){for(t={i:"i32",j:"i64",f:"f32",d:"f64"},r={parameters:[],results:"v"==n[0]?[]:[t[n[0]]]},o=1;o<n.length;++o)r.parameters.push(t[n[o]]);return new WebAssembly.Function(r,e)}for(i=[1,0,1,96],u=n.slice(0,1),a=n.slice(1),s={i:127,j:126,f:125,d:124},i.push(a.length),o=0;o<a.length;++o)i.push(s[a[o]]);return"v"==u?i.push(0):i=i.concat([1,s[u]]),i[1]=i.length-2,f=new Uint8Array([0,97,115,109,1,0,0,0].concat(i,[2,7,1,1,101,1,102,0,0,7,5,1,1,102,0,0])),c=new WebAssembly.Module(f),new WebAssembly.Instance(c,{e:{f:e}}).exports.f}(e,n),_.set(o,i)}return m.set(e,o),o}(e,n)}function X(e){g=e,n.HEAP8=new Int8Array(e),n.HEAP16=new Int16Array(e),n.HEAP32=E=new Int32Array(e),n.HEAPU8=A=new Uint8Array(e),n.HEAPU16=new Uint16Array(e),n.HEAPU32=b=new Uint32Array(e),n.HEAPF32=new Float32Array(e),n.HEAPF64=new Float64Array(e)}function z(e){return e.startsWith(U)}function V(e){return e.startsWith("file://")}function J(e){try{if(e==W&&y)return new Uint8Array(y);if(c)return c(e);throw"both async and sync fetching of the wasm failed"}catch(e){D(e)}}function $(e){for(var t,r;e.length>0;)"function"!=typeof(t=e.shift())?"number"==typeof(r=t.func)?void 0===t.arg?_.get(r)():_.get(r)(t.arg):r(void 0===t.arg?null:t.arg):t(n)}function Y(e){try{return h.grow(e-g.byteLength+65535>>>16),X(h.buffer),1}catch(e){}}function Q(e){function t(){N||(N=!0,n.calledRun=!0,w||($(S),n.onRuntimeInitialized&&n.onRuntimeInitialized(),function(){if(n.postRun)for("function"==typeof n.postRun&&(n.postRun=[n.postRun]);n.postRun.length;)e=n.postRun.shift(),I.unshift(e);var e;$(I)}()))}e=e||o,T>0||(function(){if(n.preRun)for("function"==typeof n.preRun&&(n.preRun=[n.preRun]);n.preRun.length;)e=n.preRun.shift(),R.unshift(e);var e;$(R)}(),T>0||(n.setStatus?(n.setStatus("Running..."),setTimeout(function(){setTimeout(function(){n.setStatus("")},1),t()},1)):t()))}if(t=null,n.arguments&&(o=n.arguments),n.thisProgram&&n.thisProgram,n.quit&&n.quit,d=[],n.wasmBinary&&(y=n.wasmBinary),n.noExitRuntime||!0,"object"!=typeof WebAssembly&&D("no native wasm support detected"),w=!1,n.INITIAL_MEMORY,R=[],S=[],I=[],0,T=0,v=null,L=null,n.preloadedImages={},n.preloadedAudios={},U="data:application/octet-stream;base64,",z(W="markdown.wasm")||(x=W,W=n.locateFile?n.locateFile(x,a):a+x),M={a:function(e){var n,t,r,o,i=A.length;if((e>>>=0)>2147483648)return!1;for(n=1;n<=4;n*=2)if(t=i*(1+.2/n),t=Math.min(t,e+100663296),Y(Math.min(2147483648,((r=Math.max(e,t))%(o=65536)>0&&(r+=o-r%o),r))))return!0;return!1}},function(){var e={a:M};function t(e,t){var r,o=e.exports;n.asm=o,X((h=n.asm.b).buffer),_=n.asm.i,r=n.asm.c,S.unshift(r),function(e){if(T--,n.monitorRunDependencies&&n.monitorRunDependencies(T),0==T&&(null!==v&&(clearInterval(v),v=null),L)){var t=L;L=null,t()}}()}function r(e){t(e.instance)}function o(n){return function(){if(!y&&(i||u)){if("function"==typeof fetch&&!V(W))return fetch(W,{credentials:"same-origin"}).then(function(e){if(!e.ok)throw"failed to load wasm binary file at '"+W+"'";return e.arrayBuffer()}).catch(function(){return J(W)});if(f)return new Promise(function(e,n){f(W,function(n){e(new Uint8Array(n))},n)})}return Promise.resolve().then(function(){return J(W)})}().then(function(n){return WebAssembly.instantiate(n,e)}).then(n,function(e){j("failed to asynchronously prepare wasm: "+e),D(e)})}if(T++,n.monitorRunDependencies&&n.monitorRunDependencies(T),n.instantiateWasm)try{return n.instantiateWasm(e,t)}catch(e){return j("Module.instantiateWasm callback failed with error: "+e),!1}y||"function"!=typeof WebAssembly.instantiateStreaming||z(W)||V(W)||"function"!=typeof fetch?o(r):fetch(W,{credentials:"same-origin"}).then(function(n){return WebAssembly.instantiateStreaming(n,e).then(r,function(e){return j("wasm streaming compile failed: "+e),j("falling back to ArrayBuffer instantiation"),o(r)})})}(),n.___wasm_call_ctors=function(){return(n.___wasm_call_ctors=n.asm.c).apply(null,arguments)},H=n._wrealloc=function(){return(H=n._wrealloc=n.asm.d).apply(null,arguments)},P=n._wfree=function(){return(P=n._wfree=n.asm.e).apply(null,arguments)},F=n._WErrGetCode=function(){return(F=n._WErrGetCode=n.asm.f).apply(null,arguments)},O=n._WErrGetMsg=function(){return(O=n._WErrGetMsg=n.asm.g).apply(null,arguments)},k=n._WErrClear=function(){return(k=n._WErrClear=n.asm.h).apply(null,arguments)},B=n._parseUTF8=function(){return(B=n._parseUTF8=n.asm.j).apply(null,arguments)},n.addFunction=K,n.removeFunction=G,L=function e(){N||Q(),N||(L=e)},n.run=Q,n.preInit)for("function"==typeof n.preInit&&(n.preInit=[n.preInit]);n.preInit.length>0;)n.preInit.pop()();Q(),n.inspect=(()=>"[asm]"),void 0!==e&&(module=e,e=void 0);class WError extends Error{constructor(e,n,t,r){super(n,t||"wasm",r||0),this.name="WError",this.code=e}}function Z(e,n){const t=H(0,n);return A.set(e,t),t}let ee=0;n.postRun.push(()=>{ee=H(0,4)});const ne="undefined"!=typeof TextEncoder?(()=>{const e=new TextEncoder("utf-8"),n=new TextDecoder("utf-8");return{encode:n=>e.encode(n),decode:e=>n.decode(e)}})():"undefined"!=typeof Buffer?{encode:e=>new Uint8Array(Buffer.from(e,"utf-8")),decode:e=>Buffer.from(e.buffer,e.byteOffset,e.byteLength).toString("utf8")}:{encode:e=>{let n=[];for(let t=0,r=e.length;t!=r;++t)n[t]=255&e.charCodeAt(t);return new Uint8Array(n)},decode:e=>String(e)},te=n.ready,re={COLLAPSE_WHITESPACE:1,PERMISSIVE_ATX_HEADERS:2,PERMISSIVE_URL_AUTO_LINKS:4,PERMISSIVE_EMAIL_AUTO_LINKS:8,NO_INDENTED_CODE_BLOCKS:16,NO_HTML_BLOCKS:32,NO_HTML_SPANS:64,TABLES:256,STRIKETHROUGH:512,PERMISSIVE_WWW_AUTOLINKS:1024,TASK_LISTS:2048,LATEX_MATH_SPANS:4096,WIKI_LINKS:8192,UNDERLINE:16384,DEFAULT:2823,NO_HTML:96},oe={HTML:1,XHTML:2,AllowJSURI:4};function ie(e,n){let t=void 0===(n=n||{}).parseFlags?re.DEFAULT:n.parseFlags,r=n.allowJSURIs?oe.AllowJSURI:0;switch(n.format){case"xhtml":r|=oe.HTML|oe.XHTML;break;case"html":case void 0:case null:case"":r|=oe.HTML;break;default:throw new Error(`invalid format "${n.format}"`)}let o=n.onCodeBlock?(i=n.onCodeBlock,K(function(e,n,t,r,o){try{const u=n>0?ne.decode(A.subarray(e,e+n)):"",a=A.subarray(t,t+r);let s=void 0;a.toString=(()=>s||(s=ne.decode(a)));let f=null;if(null===(f=i(u,a))||void 0===f)return-1;let c=ue(f);if(c.length>0){const e=Z(c,c.length);b[o>>2]=e}return c.length}catch(e){return console.error(`error in markdown onCodeBlock callback: ${e.stack||e}`),-1}},"iiiiii")):0;var i;let u=ue(e),a=function(e){let n=e(ee),t=E[ee>>2];if(0==t)return null;let r=A.subarray(t,t+n);return r.heapAddr=t,r}(e=>(function(e,n){const t=function(e){return e instanceof Uint8Array?e:new Uint8Array(e)}(e),r=t.length,o=Z(t,r),i=n(o,r);return function(e){P(e)}(o),i})(u,(n,i)=>B(n,i,t,r,e,o)));return n.onCodeBlock&&G(o),function(){let e=function(){let e=F();if(0!=e){let n=O(),t=0!=n?UTF8ArrayToString(A,n):"";return k(),new WError(e,t)}}();if(e)throw e}(),n.bytes||n.asMemoryView?a:ne.decode(a)}function ue(e){return"string"==typeof e?ne.encode(e):e instanceof Uint8Array?e:new Uint8Array(e)}export{te as ready,re as ParseFlags,ie as parse};
+const exports = {}
+
+// ——— wasm runtime ———
+const Module = {
+  preRun: [],
+  postRun: [],
+  print: console.log.bind(console),
+  printErr: console.error.bind(console),
+}
+Module.ready = new Promise(resolve => {
+  Module.onRuntimeInitialized = () => {
+    resolve({})
+  }
+})
+
+function abort(what) {
+  throw new Error("wasm abort" + (what ? ": " + (what.stack || what) : ""))
+}
+
+let wasmMemory, wasmTable
+let HEAP8, HEAPU8, HEAP16, HEAPU16, HEAP32, HEAPU32, HEAPF32, HEAPF64
+
+function updateMemoryViews() {
+  const b = wasmMemory.buffer
+  Module.HEAP8 = HEAP8 = new Int8Array(b)
+  Module.HEAP16 = HEAP16 = new Int16Array(b)
+  Module.HEAP32 = HEAP32 = new Int32Array(b)
+  Module.HEAPU8 = HEAPU8 = new Uint8Array(b)
+  Module.HEAPU16 = HEAPU16 = new Uint16Array(b)
+  Module.HEAPU32 = HEAPU32 = new Uint32Array(b)
+  Module.HEAPF32 = HEAPF32 = new Float32Array(b)
+  Module.HEAPF64 = HEAPF64 = new Float64Array(b)
+}
+
+// emscripten_resize_heap grows memory to at least requestedSize bytes, overallocating
+// by up to 20% to reduce the number of times memory grows
+function emscripten_resize_heap(requestedSize) {
+  const maxHeapSize = 2147483648
+  const oldSize = HEAPU8.length
+  requestedSize >>>= 0
+  if (requestedSize > maxHeapSize)
+    return 0
+  for (let cutDown = 1; cutDown <= 4; cutDown *= 2) {
+    let overGrown = Math.min(oldSize * (1 + 0.2 / cutDown), requestedSize + 100663296)
+    let newSize = Math.max(requestedSize, overGrown)
+    newSize = Math.min(maxHeapSize, Math.ceil(newSize / 65536) * 65536)
+    try {
+      wasmMemory.grow((newSize - wasmMemory.buffer.byteLength) / 65536)
+      updateMemoryViews()
+      return 1
+    } catch (e) {}
+  }
+  return 0
+}
+
+function emscripten_get_now() {
+  return performance.now()
+}
+
+// UTF8ArrayToString decodes the NUL-terminated UTF-8 string at ptr in heap
+function UTF8ArrayToString(heap, ptr) {
+  let end = ptr
+  while (heap[end])
+    end++
+  return utf8.decode(heap.subarray(ptr, end))
+}
+
+// addFunction adds the JS function fn to the wasm table, so that wasm code can call it,
+// and returns its index. sig describes its type, e.g. "iii" for (i32, i32) -> i32.
+let functionsInTableMap = null
+const freeTableIndexes = []
+
+function convertJsFunctionToWasm(fn, sig) {
+  const types = { i: "i32", j: "i64", f: "f32", d: "f64" }
+  if (typeof WebAssembly.Function == "function") {
+    const type = { parameters: [], results: sig[0] == "v" ? [] : [types[sig[0]]] }
+    for (let i = 1; i < sig.length; i++)
+      type.parameters.push(types[sig[i]])
+    return new WebAssembly.Function(type, fn)
+  }
+  // a module which imports fn and exports it as a wasm function of the right type
+  const codes = { i: 0x7f, j: 0x7e, f: 0x7d, d: 0x7c }
+  const sigParams = sig.slice(1)
+  let typeSection = [0x01, 0x00, 0x01, 0x60, sigParams.length]
+  for (let i = 0; i < sigParams.length; i++)
+    typeSection.push(codes[sigParams[i]])
+  if (sig[0] == "v")
+    typeSection.push(0x00)
+  else
+    typeSection = typeSection.concat([0x01, codes[sig[0]]])
+  typeSection[1] = typeSection.length - 2
+  const bytes = new Uint8Array([0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00].concat(
+    typeSection,
+    [0x02, 0x07, 0x01, 0x01, 0x65, 0x01, 0x66, 0x00, 0x00,  // import "e" "f"
+     0x07, 0x05, 0x01, 0x01, 0x66, 0x00, 0x00]))            // export "f"
+  const module = new WebAssembly.Module(bytes)
+  return new WebAssembly.Instance(module, { e: { f: fn } }).exports.f
+}
+
+function addFunction(fn, sig) {
+  if (!functionsInTableMap) {
+    functionsInTableMap = new WeakMap()
+    for (let i = 0; i < wasmTable.length; i++) {
+      const item = wasmTable.get(i)
+      if (item)
+        functionsInTableMap.set(item, i)
+    }
+  }
+  if (functionsInTableMap.has(fn))
+    return functionsInTableMap.get(fn)
+  let index
+  if (freeTableIndexes.length) {
+    index = freeTableIndexes.pop()
+  } else {
+    try {
+      wasmTable.grow(1)
+    } catch (err) {
+      if (!(err instanceof RangeError))
+        throw err
+      throw new Error("Unable to grow wasm table")
+    }
+    index = wasmTable.length - 1
+  }
+  try {
+    wasmTable.set(index, fn)
+  } catch (err) {
+    if (!(err instanceof TypeError))
+      throw err
+    wasmTable.set(index, convertJsFunctionToWasm(fn, sig))
+  }
+  functionsInTableMap.set(fn, index)
+  return index
+}
+
+function removeFunction(index) {
+  functionsInTableMap.delete(wasmTable.get(index))
+  freeTableIndexes.push(index)
+}
+
+Module.addFunction = addFunction
+Module.removeFunction = removeFunction
+
+let _setOutbufMaxRetain
+let _outbufTrim
+let _releaseMemory
+let _memoryUsage
+let _parseStats
+let _parserCreate
+let _parserReset
+let _parserDestroy
+let _refDefsCreate
+let _refDefsDestroy
+let _parseUTF8
+let _parseUTF8Stream
+let _streamCreate
+let _streamFree
+let _streamWrite
+let _streamEnd
+let _parseUTF8Batch
+let _incCreate
+let _incFree
+let _incSet
+let _incEdit
+let _wrealloc
+let _wfree
+let _WErrGetCode
+let _WErrGetMsg
+let _WErrClear
+
+function receiveInstance(instance) {
+  const e = instance.exports
+  Module.asm = e
+  wasmMemory = e.memory
+  wasmTable = e.__indirect_function_table
+  updateMemoryViews()
+  Module._setOutbufMaxRetain = _setOutbufMaxRetain = e.setOutbufMaxRetain
+  Module._outbufTrim = _outbufTrim = e.outbufTrim
+  Module._releaseMemory = _releaseMemory = e.releaseMemory
+  Module._memoryUsage = _memoryUsage = e.memoryUsage
+  Module._parseStats = _parseStats = e.parseStats
+  Module._parserCreate = _parserCreate = e.parserCreate
+  Module._parserReset = _parserReset = e.parserReset
+  Module._parserDestroy = _parserDestroy = e.parserDestroy
+  Module._refDefsCreate = _refDefsCreate = e.refDefsCreate
+  Module._refDefsDestroy = _refDefsDestroy = e.refDefsDestroy
+  Module._parseUTF8 = _parseUTF8 = e.parseUTF8
+  Module._parseUTF8Stream = _parseUTF8Stream = e.parseUTF8Stream
+  Module._streamCreate = _streamCreate = e.streamCreate
+  Module._streamFree = _streamFree = e.streamFree
+  Module._streamWrite = _streamWrite = e.streamWrite
+  Module._streamEnd = _streamEnd = e.streamEnd
+  Module._parseUTF8Batch = _parseUTF8Batch = e.parseUTF8Batch
+  Module._incCreate = _incCreate = e.incCreate
+  Module._incFree = _incFree = e.incFree
+  Module._incSet = _incSet = e.incSet
+  Module._incEdit = _incEdit = e.incEdit
+  Module._wrealloc = _wrealloc = e.wrealloc
+  Module._wfree = _wfree = e.wfree
+  Module._WErrGetCode = _WErrGetCode = e.WErrGetCode
+  Module._WErrGetMsg = _WErrGetMsg = e.WErrGetMsg
+  Module._WErrClear = _WErrClear = e.WErrClear
+}
+
+function callRuntimeCallbacks(callbacks) {
+  while (callbacks.length)
+    callbacks.shift()(Module)
+}
+
+const wasmImports = {
+  env: {
+    emscripten_resize_heap,
+    emscripten_get_now,
+  },
+}
+
+function run(instance) {
+  callRuntimeCallbacks(Module.preRun)
+  receiveInstance(instance)
+  Module.calledRun = true
+  Module.onRuntimeInitialized()
+  callRuntimeCallbacks(Module.postRun)
+}
+
+// scriptDirectory is where markdown.wasm is loaded from: the directory of this file
+let scriptDirectory = ""
+const ENVIRONMENT_IS_NODE = typeof process == "object" && typeof process.versions == "object" &&
+  typeof process.versions.node == "string" && typeof require == "function"
+if (ENVIRONMENT_IS_NODE) {
+  scriptDirectory = __dirname + "/"
+} else if (typeof importScripts == "function") {
+  scriptDirectory = self.location.href
+} else if (typeof document != "undefined" && document.currentScript) {
+  scriptDirectory = document.currentScript.src
+}
+if (!ENVIRONMENT_IS_NODE)
+  scriptDirectory = scriptDirectory.indexOf("blob:") !== 0 ?
+    scriptDirectory.substr(0, scriptDirectory.lastIndexOf("/") + 1) : ""
+Module.locateFile = name => scriptDirectory + name
+
+function instantiateAsync() {
+  const wasmFile = Module.locateFile("markdown.wasm")
+  let p
+  if (ENVIRONMENT_IS_NODE) {
+    p = new Promise((resolve, reject) => {
+      require("fs").readFile(require("path").normalize(wasmFile), (err, data) => {
+        err ? reject(err) : resolve(data)
+      })
+    }).then(data => WebAssembly.instantiate(data, wasmImports))
+  } else if (typeof WebAssembly.instantiateStreaming == "function") {
+    p = WebAssembly.instantiateStreaming(fetch(wasmFile, { credentials: "same-origin" }), wasmImports)
+      .catch(err => {
+        Module.printErr("wasm streaming compile failed: " + err)
+        Module.printErr("falling back to ArrayBuffer instantiation")
+        return fetch(wasmFile, { credentials: "same-origin" })
+          .then(r => r.arrayBuffer())
+          .then(data => WebAssembly.instantiate(data, wasmImports))
+      })
+  } else {
+    p = fetch(wasmFile, { credentials: "same-origin" })
+      .then(r => r.arrayBuffer())
+      .then(data => WebAssembly.instantiate(data, wasmImports))
+  }
+  return p.then(result => run(result.instance), err => {
+    Module.printErr("failed to asynchronously prepare wasm: " + err)
+    abort(err)
+  })
+}
+// ——— end of wasm runtime ———
+
+// WError represents an error from a wasm module
+//
+class WError extends Error {
+  constructor(code, message, file, line) {
+    super(message, file || "wasm", line || 0)
+    this.name = "WError"
+    this.code = code
+  }
+}
+
+// Get & clear last WErr. Returns null if there was no error.
+// Uses a descriptive name so to help in stack traces.
+function error_from_wasm() { // :WError|null
+  let code = _WErrGetCode()
+  if (code != 0) {
+    let msgptr = _WErrGetMsg()
+    let message = msgptr != 0 ? UTF8ArrayToString(HEAPU8, msgptr) : ""
+    _WErrClear()
+    return new WError(code, message)
+  }
+}
+
+function werrCheck() {
+  let err = error_from_wasm()
+  if (err) {
+    throw err
+  }
+}
+
+// bytebuf takes an ArrayBuffer or Iterable<byte> and returns a Uint8Array
+//
+// bytebuf(buf :ArrayBuffer|Iterable<byte>|byte[]) : Uint8Array
+//
+function bytebuf(buf) {
+  if (buf instanceof Uint8Array) {
+    return buf
+  }
+  return new Uint8Array(buf)
+}
+
+// mallocbuf allocates memory in the WASM heap and copies length bytes
+// from byteArray into the allocated location.
+// Returns the address to the allocated memory.
+//
+function mallocbuf(byteArray, length) {
+  const offs = _wrealloc(0, length)
+  HEAPU8.set(byteArray, offs)
+  return offs
+}
+
+// malloc32 allocates at least size bytes on 32-bit boundary.
+// Returns two values: original_address and aligned_address.
+// You should call free() with original_address.
+//
+function malloc32(size) {
+  let ptr_orig = _wrealloc(0, size + 3)
+  return [ptr_orig, ptr_orig + (4 - (ptr_orig % 4))]
+}
+
+// malloc16 allocates at least size bytes on 16-bit boundary.
+// Returns two values: original_address and aligned_address.
+// You should call free() with original_address.
+//
+function malloc16(size) {
+  let ptr_orig = _wrealloc(0, size + 1)
+  return [ptr_orig, ptr_orig + (ptr_orig % 2)]
+}
+
+// free wasm heap memory
+function free(ptr) {
+  _wfree(ptr)
+}
+
+
+// writeUTF16Str writes str as UTF16 to address ptr.
+// ptr must be aligned on a 16-bit boundary.
+//
+function writeUTF16Str(str, ptr) {
+  for (let i = 0; i < str.length; ++i) {
+    HEAP16[ptr >> 1] = str.charCodeAt(i)
+    ptr += 2
+  }
+}
+
+
+// withTmpBytePtr takes an ArrayBuffer or Uint8Array and:
+// 1. copies it into the WASM module memory
+// 2. calls fn(pointer, size)
+// 3. calls free(pointer)
+//
+function withTmpBytePtr(buf, fn) {
+  const u8buf = bytebuf(buf)
+  const size = u8buf.length
+  const ptr = mallocbuf(u8buf, size)
+  const r = fn(ptr, size)
+  free(ptr)
+  return r
+}
+
+
+// withUTF16Str takes a JavaScript string and:
+// 1. copies it into the WASM module memory as UTF16, 16-bit aligned
+// 2. calls fn(aligned_pointer, bytesize)
+// 3. calls free(original_pointer)
+//
+function withUTF16Str(str, fn) {
+  let bytesize = str.length * 2
+  let ptr = _wrealloc(0, bytesize + 1) // +1 for alignment
+  let aligned_ptr = (ptr % 2 != 0) ? ptr + 1 : ptr
+  writeUTF16Str(str, aligned_ptr, bytesize)
+  let r = fn(aligned_ptr, bytesize)
+  free(ptr)
+  return r
+}
+
+
+function cstrlen(ptr) {
+  let end = ptr >> 0
+  while (HEAP8[end]) { end++ }
+  return end - ptr
+}
+
+
+// asciicstr interprets memory in buf at offset as an ASCII-encoded string,
+// and returns a JavaScript string.
+//
+function asciicstr(buf, offset) {
+  let str = ''
+  while (true) {
+    let b = buf[offset++ >> 0]
+    if (b == 0) { break }
+    str += String.fromCharCode(b)
+  }
+  return str
+}
+
+// cstrStack allocates a UTF-8 encoded version of str as a nul-terminated
+// "C string" on the stack.
+//
+function cstrStack(str) {
+  var ret = 0
+  if (str !== null && str !== undefined && str !== 0) {
+    var len = (str.length << 2) + 1
+    ret = stackAlloc(len)
+    stringToUTF8Array(str, HEAPU8, ret, len)
+  }
+  return ret
+}
+
+// used by strFromUTF8Ptr as a temporary address-sized integer
+let tmpPtr = 0
+
+Module.postRun.push(() => {
+  tmpPtr = _wrealloc(0, 4)
+})
+
+
+// strFromUTF8Ptr provides a pointer-sized integer that can be written
+// to by fn. fn is expected to return the number of bytes written to the
+// address pointed to by p. The address is dereferenced and the written
+// number of bytes are interpreted as UTF8, returning a JS string.
+//
+// This is useful for efficiently converting UTF8 strings that are
+// already allocated inside the library to JavaScript strings.
+//
+// Example:
+//   strFromUTF8Ptr((p)=> _FooGetName(ptr, p))
+//   ...
+//   u32 EXPORT FooGetName(Foo* f, const char** p) {
+//     *p = f->name_ptr;
+//     return f->name_len;
+//   }
+//
+// Synopsis:
+//   strFromUTF8Ptr( fn :(p:int)=>int )
+//
+function strFromUTF8Ptr(fn) {
+  let z = fn(tmpPtr)
+  let offs = HEAP32[tmpPtr >> 2]
+  return z == 0 ? "" : utf8.decode(HEAPU8.subarray(offs, offs + z))
+}
+
+// withOutPtr facilitates the following:
+//
+// 1. calls fn with an address to memory that fits a pointer.
+//    fn(outptr) is expected to:
+//    a. Write some data into heap memory
+//    b. Write the address of that data at outptr (i.e. *outptr = heapaddr)
+//    c. Return the length of data written
+//
+// 2. withOutPtr reads the address from outptr
+//    a. If the address is 0 (NULL), returns null
+//    b. Else a slice of the heap memory is created, starting at *outptr
+//       and ending at ((*outptr) + length_returned_by_fn).
+//       A free() function is added to the buffer and it is returned.
+//
+// It is important to free() the memory of the returned buffer when the caller is done.
+// This is implementation specific, so this function can not help you with that.
+//
+// The return type is as follows:
+//   interface HeapData extends Uint8Array {
+//     readonly heapAddr :number  // address in heap == *outptr
+//   }
+//
+// Example:
+//
+//   // WASM module, in C:
+//   typedef struct Color_ { char r, g, b; } Color;
+//   size_t newColor(const Color** outp) {
+//     Color* c = (Color*)malloc(sizeof(Color));
+//     c->r = 0xFF;
+//     c->g = 0xCA;
+//     c->b = 0x0;
+//     *outp = c;
+//     return sizeof(Color);
+//   }
+//   void freeColor(const Color* p) {
+//     free(p);
+//   }
+//
+//   // JavaScript
+//   let color = withOutPtr(_newColor)
+//   console.log("RGB:", color[0], color[1], color[2])
+//   _freeColor(color.heapAddr)
+//
+function withOutPtr(fn) {
+  let len = fn(tmpPtr)
+  let addr = HEAP32[tmpPtr >> 2]
+  if (addr == 0) {
+    return null
+  }
+  let buf = HEAPU8.subarray(addr, addr + len)
+  buf.heapAddr = addr
+  return buf
+}
+
+
+
+// withStackFrame saves the stack and calls fn; code in fn can then
+// allocate stack memory. When fn returns or throws, the stack is restored
+// to the point before this function was called.
+// Returns the return value of fn.
+//
+function withStackFrame(fn) {
+  let stack = stackSave()
+  try {
+    return fn()
+  } finally {
+    stackRestore(stack)
+  }
+}
+
+
+// ureadU16 reads a (little endian) unsigned 16-bit integer from buf at addr
+//
+function ureadU16(buf, addr) {
+  return ((buf[addr] | (buf[addr + 1] << 8))) >>> 0
+}
+
+// ureadI16 reads a (little endian) signed 16-bit integer from buf at addr
+//
+function ureadI16(buf, addr) {
+  let n = ((buf[addr]) | (buf[addr + 1] << 8))
+  return n >= 0x8000 ? n - 0x10000 : n
+}
+
+// ureadU32 reads a (little endian) unsigned 32-bit integer from buf at addr
+//
+function ureadU32(buf, addr) {
+  return (
+    (buf[addr + 3] << 24) |
+    (buf[addr + 2] << 16) |
+    (buf[addr + 1] << 8) |
+    (buf[addr] >>> 0)
+  ) >>> 0
+}
+
+// ureadU32 reads a (little endian) signed 32-bit integer from buf at addr
+//
+function ureadI32(buf, addr) {
+  return (
+    (buf[addr + 3] << 24) |
+    (buf[addr + 2] << 16) |
+    (buf[addr + 1] << 8) |
+    (buf[addr] >>> 0)
+  )
+}
+
+
+// export function ureadI16be(buf, addr) {
+//   let n = ((buf[addr] << 8) | (buf[addr + 1]))
+//   return n >= 0x8000 ? n - 0x10000 : n
+// }
+
+// export function ureadU16be(buf, addr) {
+//   return ((buf[addr] << 8) | (buf[addr + 1])) >>> 0
+// }
+
+// export function ureadU32be(buf, addr) {
+//   return (
+//     (buf[addr] << 24) |
+//     (buf[addr + 1] << 16) |
+//     (buf[addr + 2] << 8) |
+//     (buf[addr + 3])
+//   ) >>> 0
+// }
+
+// export function ureadI32be(buf, addr) {
+//   return (
+//     (buf[addr] << 24) |
+//     (buf[addr + 1] << 16) |
+//     (buf[addr + 2] << 8) |
+//     (buf[addr + 3])
+//   )
+// }
+
+
+// asciiStrToU32 converts a <=4 character string to a u32.
+// For example, string -> hb_tag_t
+//
+function asciiStrToU32(s) {
+  // Note: Should match #define HB_TAG(c1,c2,c3,c4) in hb-common.h
+  return (
+    ((s.charCodeAt(0) >>> 0) << 24) >>> 0 | // "">>> 0" u32 please
+    ((s.charCodeAt(1) >>> 0) << 16) |
+    ((s.charCodeAt(2) >>> 0) << 8) |
+     (s.charCodeAt(3) >>> 0)
+  )
+}
+
+const hbtag = asciiStrToU32
+
+// u32ToAsciiStr converts a u32 to a ASCII string
+// For example, hb_tag_t -> string
+//
+function u32ToAsciiStr(u) {
+  return String.fromCharCode(
+    ((u >> 24) & 0xff),
+    ((u >> 16) & 0xff),
+    ((u >>  8) & 0xff),
+    ((u >>  0) & 0xff)
+  )
+}
+
+// interface utf8 {
+//   encode(s :string) :Uint8Array
+//   decode(b :Uint8Array) :string
+// }
+const utf8 = typeof TextEncoder != 'undefined' ? (() => {
+  // Modern browsers
+  const enc = new TextEncoder("utf-8")
+  const dec = new TextDecoder("utf-8")
+  // TextDecoder does not accept views of shared memory (i.e. the heap of a
+  // threaded build), so those are copied first
+  const isShared = typeof SharedArrayBuffer != 'undefined' ?
+    b => b.buffer instanceof SharedArrayBuffer :
+    b => false
+  return {
+    encode: s => enc.encode(s),
+    decode: b => dec.decode(isShared(b) ? b.slice() : b),
+  };
+})() : typeof Buffer != 'undefined' ? {
+  // Nodejs
+  encode: s => new Uint8Array(Buffer.from(s, 'utf-8')),
+  decode: b =>
+    Buffer.from(b.buffer, b.byteOffset, b.byteLength).toString('utf8'),
+} : {
+  // Some other pesky JS environment
+  encode: s => {
+    let asciiBytes = [];
+    for (let i = 0, L = s.length; i != L; ++i) {
+      asciiBytes[i] = 0xff & s.charCodeAt(i);
+    }
+    return new Uint8Array(asciiBytes);
+  },
+  decode: b => String(b),
+}
+
+
+// Converts between 16.16 fixed-point number and 64-bit floating-point numbers
+function fixedToFloat(i) {
+  return i / 65536.0
+}
+function floatToFixed(f) {
+  return (f * 65536.0) >> 0
+}
+
+
+
+
+
+
+
+
+
+
+
+const ready = Module.ready
+
+// console.time('wasm load')
+// Module.postRun.push(() => {
+//   console.timeEnd('wasm load')
+// })
+
+const ParseFlags = {
+  COLLAPSE_WHITESPACE:         0x0001, // In TEXT, collapse non-trivial whitespace into single ' '
+  PERMISSIVE_ATX_HEADERS:      0x0002, // Do not require space in ATX headers ( ###header )
+  PERMISSIVE_URL_AUTO_LINKS:   0x0004, // Recognize URLs as links even without <...>
+  PERMISSIVE_EMAIL_AUTO_LINKS: 0x0008, // Recognize e-mails as links even without <...>
+  NO_INDENTED_CODE_BLOCKS:     0x0010, // Disable indented code blocks. (Only fenced code works)
+  NO_HTML_BLOCKS:              0x0020, // Disable raw HTML blocks.
+  NO_HTML_SPANS:               0x0040, // Disable raw HTML (inline).
+  TABLES:                      0x0100, // Enable tables extension.
+  STRIKETHROUGH:               0x0200, // Enable strikethrough extension.
+  PERMISSIVE_WWW_AUTOLINKS:    0x0400, // Enable WWW autolinks (without proto; just 'www.')
+  TASK_LISTS:                  0x0800, // Enable task list extension.
+  LATEX_MATH_SPANS:            0x1000, // Enable $ and $$ containing LaTeX equations.
+  WIKI_LINKS:                  0x2000, // Enable wiki links extension.
+  UNDERLINE:                   0x4000, // Enable underline extension (disables '_' for emphasis)
+
+  // Github style default flags
+  DEFAULT: 0x0001 | 0x0002 | 0x0004 | 0x0200 | 0x0100 | 0x0800,
+    // COLLAPSE_WHITESPACE
+    // PERMISSIVE_ATX_HEADERS
+    // PERMISSIVE_URL_AUTO_LINKS
+    // STRIKETHROUGH
+    // TABLES
+    // TASK_LISTS
+
+  NO_HTML: 0x0020 | 0x0040, // NO_HTML_BLOCKS | NO_HTML_SPANS
+}
+
+// Syntax tree records of the "binary" format, read by ASTReader.
+// These should be in sync with fmt_bin.h and md4c.h
+const ASTKind = { BLOCK: 1, SPAN: 2, END: 3, TEXT: 4, ATTR: 5 }
+
+const BlockType = {
+  DOC: 0, QUOTE: 1, UL: 2, OL: 3, LI: 4, HR: 5, H: 6, CODE: 7, HTML: 8, P: 9,
+  TABLE: 10, THEAD: 11, TBODY: 12, TR: 13, TH: 14, TD: 15,
+}
+
+const SpanType = {
+  EM: 0, STRONG: 1, A: 2, IMG: 3, CODE: 4, DEL: 5, LATEXMATH: 6, LATEXMATH_DISPLAY: 7,
+  WIKILINK: 8, U: 9,
+}
+
+const TextType = {
+  NORMAL: 0, NULLCHAR: 1, BR: 2, SOFTBR: 3, ENTITY: 4, CODE: 5, HTML: 6, LATEXMATH: 7,
+}
+
+const AttrType = { HREF: 1, TITLE: 2, SRC: 3, LANG: 4, INFO: 5, TARGET: 6 }
+
+const ASTFlags = { TIGHT: 1 << 1, TASK: 1 << 2, CHECKED: 1 << 3 }
+
+const AST_POOL = 1 << 0 // text is in the string pool rather than the source
+
+const DEFAULT_CHUNK_SIZE = 64 * 1024
+
+// these should be in sync with "OutputFlags" in common.h
+const OutputFlags = {
+  HTML:       1 << 0, // Output HTML
+  XHTML:      1 << 1, // Output XHTML (only has effect with HTML flag set)
+  AllowJSURI: 1 << 2, // Allow "javascript:" URIs
+  JSON:       1 << 3, // Output the syntax tree as JSON
+  Binary:     1 << 4, // Output the syntax tree as binary records
+}
+
+
+function parse(source, options) {
+  return parseWithCtx(source, options, 0)
+}
+
+
+// InputBuffer is a region of WASM memory holding markdown source which can be passed to
+// parse() and friends in place of a string or byte array. The parser then reads the
+// source right where it is, without copying it.
+// Call dispose() when the buffer is no longer needed.
+class InputBuffer {
+  constructor(capacity) {
+    this.ptr = 0
+    this.capacity = 0
+    this.length = 0  // number of valid bytes
+    reserve_input(this, capacity || 0)
+  }
+
+  // set writes source (a string or UTF-8 data) into the buffer, growing it as needed
+  set(source) {
+    write_input(this, source)
+  }
+
+  // bytes returns a view of the buffer's memory for writing UTF-8 data into directly,
+  // after which length should be set to the number of bytes written.
+  // The view must not be used after any other call into this module since the WASM
+  // memory may have grown, detaching the view.
+  bytes() {
+    return HEAPU8.subarray(this.ptr, this.ptr + this.capacity)
+  }
+
+  // reserve grows the buffer so that it can hold at least size bytes
+  reserve(size) {
+    reserve_input(this, size)
+  }
+
+  dispose() {
+    if (this.ptr) {
+      free(this.ptr)
+      this.ptr = 0
+      this.capacity = 0
+      this.length = 0
+    }
+  }
+}
+
+
+// Memory retained between calls, see setMemoryPolicy
+let maxRetained = 0  // bytes; 0 = no limit
+let idleRelease = 0  // milliseconds; 0 = never
+let lastUse = 0
+let idleTimer = null
+
+
+// setMemoryPolicy controls how much memory is kept around between calls for the internal
+// input and output buffers, which otherwise retain their largest size forever.
+//   maxRetained  buffers larger than this many bytes are freed after use
+//   idleRelease  release all memory when not used for this many milliseconds
+// Setting either to 0 (the default) disables it.
+function setMemoryPolicy(policy) {
+  maxRetained = policy.maxRetained || 0
+  idleRelease = policy.idleRelease || 0
+  _setOutbufMaxRetain(maxRetained)
+  if (maxRetained > 0 && heapInput.capacity > maxRetained)
+    release_input()
+  if (idleTimer) {
+    clearTimeout(idleTimer)
+    idleTimer = null
+  }
+  note_use()
+}
+
+
+// releaseMemory frees the internal input and output buffers. A result returned with the
+// bytes option is no longer valid afterwards. WASM memory can not shrink, but the memory
+// is reused for later calls rather than the WASM memory growing further.
+function releaseMemory() {
+  _releaseMemory()
+  if (!heapInputBusy)
+    release_input()
+}
+
+
+// release_output is called once the result of a call has been copied out of the output
+// buffer, to free it if it is larger than setMemoryPolicy allows
+function release_output() {
+  if (maxRetained > 0)
+    _outbufTrim()
+}
+
+
+// memoryUsage returns the current memory use of the module in bytes
+function memoryUsage() {
+  let p = _memoryUsage() >> 2
+  return {
+    memorySize:   HEAPU8.length,      // size of WASM memory (never shrinks)
+    heapSize:     HEAPU32[p + 2],     // memory obtained by malloc
+    heapUsed:     HEAPU32[p + 1],     // memory currently allocated
+    outputBuffer: HEAPU32[p],
+    inputBuffer:  heapInput.capacity,
+  }
+}
+
+
+function note_use() {
+  if (idleRelease > 0) {
+    lastUse = Date.now()
+    if (!idleTimer)
+      schedule_idle_release(idleRelease)
+  }
+}
+
+function schedule_idle_release(delay) {
+  idleTimer = setTimeout(() => {
+    idleTimer = null
+    let idle = Date.now() - lastUse
+    if (idle >= idleRelease) {
+      releaseMemory()
+    } else {
+      schedule_idle_release(idleRelease - idle)
+    }
+  }, delay)
+  // don't keep NodeJS processes alive
+  if (idleTimer.unref)
+    idleTimer.unref()
+}
+
+
+// parseChunked renders source like parse() but, rather than returning all the HTML at
+// once, passes it to onChunk in pieces of about options.chunkSize bytes (default 64 kB)
+// as it is produced. This keeps memory use low for very large documents.
+// A chunk is a view into WASM memory which is only valid during the call to onChunk;
+// use chunk.slice() to keep a copy.
+function parseChunked(source, onChunk, options) {
+  options = options || {}
+
+  let [parseFlags, outputFlags] = htmlOptionFlags(options, "parseChunked")
+  let chunkSize = options.chunkSize || DEFAULT_CHUNK_SIZE
+
+  let onCodeBlockPtr = options.onCodeBlock ? create_onCodeBlock_fn(options.onCodeBlock) : 0
+
+  let chunkErr = null
+  let onChunkPtr = addFunction(function(ptr, len) {
+    try {
+      onChunk(HEAPU8.subarray(ptr, ptr + len))
+      return 0
+    } catch (err) {
+      chunkErr = err
+      return -1  // abort
+    }
+  }, "iii")
+
+  with_input(source, (inptr, inlen) =>
+    _parseUTF8Stream(
+      inptr, inlen, parseFlags, outputFlags, onChunkPtr, chunkSize, onCodeBlockPtr, 0)
+  )
+
+  removeFunction(onChunkPtr)
+  if (options.onCodeBlock)
+    removeFunction(onCodeBlockPtr)
+
+  if (chunkErr) {
+    _WErrClear()
+    throw chunkErr
+  }
+  werrCheck()
+}
+
+
+// parseStream returns a ReadableStream of the HTML of source, in Uint8Array chunks.
+// The source is parsed by a ChunkedParser in pieces of options.chunkSize bytes (default
+// 64 kB) as the stream is read, so HTML is available before all of it has been parsed,
+// and a reader which falls behind holds up the parsing rather than the HTML queueing up.
+// The onCodeBlock option is not supported. In NodeJS, stream.Readable.fromWeb() turns
+// the stream into a Readable.
+function parseStream(source, options) {
+  let chunkSize = (options && options.chunkSize) || DEFAULT_CHUNK_SIZE
+  let isString = typeof source == "string"
+  if (!isString)
+    source = as_byte_array(source)
+  let offset = 0
+  let nchunks = 0
+  let parser = null
+  return new ReadableStream({
+    start(controller) {
+      parser = new ChunkedParser(chunk => {
+        // the chunk is a view into WASM memory which is only valid during this call
+        controller.enqueue(chunk.slice())
+        nchunks++
+      }, options)
+    },
+    pull(controller) {
+      try {
+        // write pieces of source until some HTML comes out or the source is all written
+        let n = nchunks
+        while (nchunks == n && offset < source.length) {
+          let end = Math.min(offset + chunkSize, source.length)
+          if (isString) {
+            if (end < source.length && (source.charCodeAt(end - 1) & 0xFC00) == 0xD800)
+              end++  // don't split a surrogate pair
+            parser.write(source.substring(offset, end))
+          } else {
+            parser.write(source.subarray(offset, end))
+          }
+          offset = end
+        }
+        if (offset == source.length) {
+          parser.end()
+          parser.dispose()
+          controller.close()
+        }
+      } catch (err) {
+        parser.dispose()
+        throw err
+      }
+    },
+    cancel() {
+      parser.dispose()
+    },
+  })
+}
+
+
+// ChunkedParser parses a document which is provided in chunks, e.g. as it arrives over
+// the network, passing its HTML to onChunk (like parseChunked) as soon as top-level blocks
+// are complete. Only the incomplete part of the document is kept in memory, unless it may
+// refer to link reference definitions yet to come, in which case the HTML from there on
+// is held back until end().
+// String chunks must not split surrogate pairs. UTF-8 chunks may be split anywhere.
+// Options are the same as for parse(), except for onCodeBlock which is not supported.
+// Call dispose() when the parser is no longer needed.
+class ChunkedParser {
+  constructor(onChunk, options) {
+    options = options || {}
+    if (options.onCodeBlock)
+      throw new Error("onCodeBlock is not supported by ChunkedParser")
+    let [parseFlags, outputFlags] = htmlOptionFlags(options, "ChunkedParser")
+    this.chunkErr = null
+    this.onChunkPtr = addFunction((ptr, len) => {
+      try {
+        onChunk(HEAPU8.subarray(ptr, ptr + len))
+        return 0
+      } catch (err) {
+        this.chunkErr = err
+        return -1  // abort
+      }
+    }, "iii")
+    this.ptr = _streamCreate(parseFlags, outputFlags, this.onChunkPtr)
+  }
+
+  // write adds source to the document
+  write(source) {
+    if (!this.ptr)
+      throw new Error("ChunkedParser has been disposed")
+    with_input(source, (inptr, inlen) => _streamWrite(this.ptr, inptr, inlen))
+    this._check()
+  }
+
+  // end completes the document. The parser can then be used for a new document.
+  end() {
+    if (!this.ptr)
+      throw new Error("ChunkedParser has been disposed")
+    _streamEnd(this.ptr)
+    this._check()
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _streamFree(this.ptr)
+      removeFunction(this.onChunkPtr)
+      this.ptr = 0
+    }
+  }
+
+  _check() {
+    let err = this.chunkErr
+    if (err) {
+      this.chunkErr = null
+      _WErrClear()
+      throw err
+    }
+    werrCheck()
+  }
+}
+
+
+// createParseStream returns a TransformStream which turns markdown, written to it in
+// chunks of text or UTF-8 data, into HTML, e.g.
+//   response.body.pipeThrough(createParseStream())
+function createParseStream(options) {
+  let parser
+  return new TransformStream({
+    start(controller) {
+      parser = new ChunkedParser(chunk => controller.enqueue(chunk.slice()), options)
+    },
+    transform(chunk) {
+      try {
+        parser.write(chunk)
+      } catch (err) {
+        parser.dispose()
+        throw err
+      }
+    },
+    flush() {
+      try {
+        parser.end()
+      } finally {
+        parser.dispose()
+      }
+    },
+  })
+}
+
+
+// parseBatch renders many documents in a single call into WASM, which is a lot faster
+// than calling parse() for each one when the documents are small.
+// Returns the HTML of each document, or with the bytes option set, the HTML of all
+// documents in one Uint8Array plus the offsets of each document's HTML in it.
+function parseBatch(sources, options) {
+  return parseBatchWithCtx(sources, options, 0)
+}
+
+
+// Parser is a reusable parser which keeps its internal memory (buffers and lookup tables)
+// around between calls to parse(). This makes parsing many small documents cheaper.
+// Call dispose() when the parser is no longer needed.
+class Parser {
+  constructor() {
+    this.ptr = _parserCreate()
+  }
+
+  parse(source, options) {
+    if (!this.ptr)
+      throw new Error("Parser has been disposed")
+    return parseWithCtx(source, options, this.ptr)
+  }
+
+  parseBatch(sources, options) {
+    if (!this.ptr)
+      throw new Error("Parser has been disposed")
+    return parseBatchWithCtx(sources, options, this.ptr)
+  }
+
+  // reset releases memory retained by the parser. The parser remains usable.
+  reset() {
+    if (this.ptr)
+      _parserReset(this.ptr)
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _parserDestroy(this.ptr)
+      this.ptr = 0
+    }
+  }
+}
+
+
+// RefDefs holds link reference definitions which are shared by many documents, like a
+// common footer, parsed once. Given as the refDefs option of parse(), they resolve links
+// to labels which the document does not define itself. Only options.parseFlags is used.
+// Call dispose() when no longer needed.
+class RefDefs {
+  constructor(source, options) {
+    let [parseFlags] = parseOptionFlags(options || {})
+    this.ptr = with_input(source, (inptr, inlen) => _refDefsCreate(inptr, inlen, parseFlags))
+    if (!this.ptr)
+      throw new Error("out of memory")
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _refDefsDestroy(this.ptr)
+      this.ptr = 0
+    }
+  }
+}
+
+
+// IncrementalParser keeps a document around so that, after an edit, only the top-level
+// blocks around the edit need to be parsed again. This is useful for live previews.
+// Options are the same as for parse(), except for onCodeBlock which is not supported.
+// Call dispose() when the parser is no longer needed.
+class IncrementalParser {
+  constructor(options) {
+    options = options || {}
+    if (options.onCodeBlock)
+      throw new Error("onCodeBlock is not supported by IncrementalParser")
+    let [parseFlags, outputFlags] = htmlOptionFlags(options, "IncrementalParser")
+    this.options = options
+    this.source = null
+    this.ptr = _incCreate(parseFlags, outputFlags)
+  }
+
+  // parse replaces the document with source and returns its HTML
+  parse(source) {
+    if (!this.ptr)
+      throw new Error("IncrementalParser has been disposed")
+    this.source = typeof source == "string" ? source : null
+    let outbuf = withOutPtr(outptr => with_input(source, (inptr, inlen) =>
+      _incSet(this.ptr, inptr, inlen, outptr)
+    ))
+    werrCheck()
+    return this._result(outbuf)
+  }
+
+  // edit replaces deleteCount characters at offset with text and returns the updated HTML.
+  // Offsets are in UTF-16 code units when the document was given as a string, and in
+  // bytes when it was given as UTF-8 data.
+  edit(offset, deleteCount, text) {
+    if (!this.ptr)
+      throw new Error("IncrementalParser has been disposed")
+    let off = offset, dellen = deleteCount
+    if (this.source !== null) {
+      if (typeof text != "string")
+        text = utf8.decode(as_byte_array(text))
+      let s = this.source
+      off = utf8_length(s, 0, offset)
+      dellen = utf8_length(s, offset, offset + deleteCount)
+      this.source = s.substr(0, offset) + text + s.substr(offset + deleteCount)
+    }
+    let outbuf = withOutPtr(outptr => with_input(text, (inptr, inlen) =>
+      _incEdit(this.ptr, off, dellen, inptr, inlen, outptr)
+    ))
+    werrCheck()
+    return this._result(outbuf)
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _incFree(this.ptr)
+      this.ptr = 0
+      this.source = null
+    }
+  }
+
+  _result(outbuf) {
+    outbuf = outbuf || new Uint8Array(0)
+    if (this.options.bytes || this.options.asMemoryView)
+      return outbuf
+    return utf8.decode(outbuf)
+  }
+}
+
+
+// ASTReader reads the syntax tree which parse() returns with format "binary" right
+// where it is in WASM memory (see fmt_bin.h for the layout), without creating any
+// objects other than for the strings asked for. Nodes are referred to by the index of
+// their record; the document is node 0. Like the result of parse() with the bytes
+// option, it is only valid until the next call into this module.
+//
+// Text and attributes refer to the source by offset where possible. When the source
+// passed to parse() was a Uint8Array, textBytes returns views of that array, and when
+// it was an ASCII string, text returns substrings of it, neither of which copies any
+// text nor depends on WASM memory staying as it is.
+class ASTReader {
+  constructor(outbuf, srcptr, source, srclen) {
+    let p = outbuf.heapAddr >> 2
+    this.bytes = outbuf           // the encoded tree
+    this.length = HEAPU32[p]      // number of records
+    this.rec = p + 4              // index in HEAPU32 of the first record
+    this.pool = outbuf.heapAddr + HEAPU32[p + 1]
+    this.src = srcptr
+    // the caller's source, when offsets into the UTF-8 source are offsets into it too
+    this.srcBytes = (source instanceof Uint8Array) ? source : null
+    this.srcString = (typeof source == "string" && source.length == srclen) ? source : null
+  }
+
+  kind(i)  { return HEAPU32[this.rec + i * 4] & 0xff }           // ASTKind
+  type(i)  { return (HEAPU32[this.rec + i * 4] >> 8) & 0xff }    // BlockType, SpanType, ...
+  flags(i) { return HEAPU32[this.rec + i * 4] >>> 16 }           // ASTFlags
+  a(i)     { return HEAPU32[this.rec + i * 4 + 1] }              // details, see fmt_bin.h
+  b(i)     { return HEAPU32[this.rec + i * 4 + 2] }
+
+  // end returns the index of the END record of block or span i
+  end(i) { return HEAPU32[this.rec + i * 4 + 3] }
+
+  // next returns the index of the record following node i and its contents
+  next(i) {
+    let k = this.kind(i)
+    return (k == ASTKind.BLOCK || k == ASTKind.SPAN) ? this.end(i) + 1 : i + 1
+  }
+
+  // attr returns the index of the attribute of block or span i of the given AttrType,
+  // or -1 if it has none
+  attr(i, type) {
+    for (let j = i + 1; j < this.length && this.kind(j) == ASTKind.ATTR; j++) {
+      if (this.type(j) == type)
+        return j
+    }
+    return -1
+  }
+
+  // offset returns the byte offset in the source of text or attribute i, or -1 if its
+  // bytes are not found verbatim in the source
+  offset(i) {
+    return (this.flags(i) & AST_POOL) ? -1 : this.a(i)
+  }
+
+  // textBytes returns a view of the UTF-8 bytes of text or attribute i
+  textBytes(i) {
+    let a = this.a(i)
+    if (this.flags(i) & AST_POOL)
+      return HEAPU8.subarray(this.pool + a, this.pool + a + this.b(i))
+    if (this.srcBytes)
+      return this.srcBytes.subarray(a, a + this.b(i))
+    return HEAPU8.subarray(this.src + a, this.src + a + this.b(i))
+  }
+
+  // text returns text or attribute i as a string
+  text(i) {
+    if (this.srcString && !(this.flags(i) & AST_POOL))
+      return this.srcString.substring(this.a(i), this.a(i) + this.b(i))
+    return utf8.decode(this.textBytes(i))
+  }
+
+  // textContent returns the text of node i and its contents, like the DOM property
+  textContent(i) {
+    let k = this.kind(i)
+    if (k == ASTKind.TEXT || k == ASTKind.ATTR)
+      return this.text(i)
+    let s = ""
+    for (let j = i + 1, end = this.end(i); j < end; j++) {
+      if (this.kind(j) != ASTKind.TEXT)
+        continue
+      switch (this.type(j)) {
+        case TextType.NULLCHAR: s += "\uFFFD"; break
+        case TextType.BR:
+        case TextType.SOFTBR:   s += "\n"; break
+        default:                s += this.text(j); break
+      }
+    }
+    return s
+  }
+}
+
+
+function parseOptionFlags(options) {
+  let parseFlags = (
+    options.parseFlags === undefined ? ParseFlags.DEFAULT :
+    options.parseFlags
+  )
+
+  let outputFlags = options.allowJSURIs ? OutputFlags.AllowJSURI : 0
+
+  switch (options.format) {
+    case "xhtml":
+      outputFlags |= OutputFlags.HTML | OutputFlags.XHTML
+      break
+
+    case "html":
+    case undefined:
+    case null:
+    case "":
+      outputFlags |= OutputFlags.HTML
+      break
+
+    case "json":
+      outputFlags |= OutputFlags.JSON
+      break
+
+    case "binary":
+      outputFlags |= OutputFlags.Binary
+      break
+
+    default:
+      throw new Error(`invalid format "${options.format}"`)
+  }
+
+  return [parseFlags, outputFlags]
+}
+
+
+// ref_defs_ptr returns the address of the RefDefs in options.refDefs, or 0 if none
+function ref_defs_ptr(options) {
+  if (!options.refDefs)
+    return 0
+  if (!options.refDefs.ptr)
+    throw new Error("RefDefs has been disposed")
+  return options.refDefs.ptr
+}
+
+
+// htmlOptionFlags is parseOptionFlags for functions which only produce HTML
+function htmlOptionFlags(options, funcname) {
+  let flags = parseOptionFlags(options)
+  if (flags[1] & (OutputFlags.JSON | OutputFlags.Binary))
+    throw new Error(`format "${options.format}" is not supported by ${funcname}`)
+  return flags
+}
+
+
+function parseWithCtx(source, options, ctxptr) {
+  options = options || {}
+
+  let [parseFlags, outputFlags] = parseOptionFlags(options)
+
+  let refDefsPtr = ref_defs_ptr(options)
+  let onCodeBlockPtr = options.onCodeBlock ? create_onCodeBlock_fn(options.onCodeBlock) : 0
+
+  let binary = (outputFlags & OutputFlags.Binary) != 0
+  let inputptr = 0, inputlen = 0
+  let outbuf = withOutPtr(outptr => with_input(source, (inptr, inlen) => {
+    inputptr = inptr
+    inputlen = inlen
+    return _parseUTF8(inptr, inlen, parseFlags, outputFlags, outptr, onCodeBlockPtr, ctxptr,
+                      options.threads || 1, options.stats ? 1 : 0, refDefsPtr)
+  }, binary))
+
+  if (options.onCodeBlock)
+    removeFunction(onCodeBlockPtr)
+
+  // check for error and throw if needed
+  werrCheck()
+
+  // DEBUG
+  // if (outbuf) {
+  //   console.log(utf8.decode(outbuf))
+  // }
+
+  if (binary) {
+    let ast = new ASTReader(outbuf, inputptr, source, inputlen)
+    if (options.stats)
+      return { ast, stats: read_stats(_parseStats(), inputlen) }
+    return ast
+  }
+
+  let view = options.bytes || options.asMemoryView
+
+  if (outputFlags & OutputFlags.JSON) {
+    let ast = view ? outbuf : JSON.parse(utf8.decode(outbuf))
+    if (!view)
+      release_output()
+    if (options.stats)
+      return { ast, stats: read_stats(_parseStats(), inputlen) }
+    return ast
+  }
+
+  let html = view ? outbuf : utf8.decode(outbuf)
+  if (!view)
+    release_output()
+
+  if (options.stats)
+    return { html, stats: read_stats(_parseStats(), inputlen) }
+
+  return html
+}
+
+
+// read_stats reads MD_STATS (md4c.h) at ptr, a struct of u64 fields
+function read_stats(ptr, inputlen) {
+  let u64 = i => HEAPU32[(ptr >> 2) + i * 2] + HEAPU32[(ptr >> 2) + i * 2 + 1] * 0x100000000
+  return {
+    bytes:         inputlen,
+    analyzeTime:   u64(0) / 1e6,
+    processTime:   u64(1) / 1e6,
+    scannedBytes:  u64(2),
+    marks:         u64(3),
+    rollbacks:     u64(4),
+    blocks:        u64(5),
+    containers:    u64(6),
+    refDefs:       u64(7),
+    refDefLookups: u64(8),
+  }
+}
+
+
+function parseBatchWithCtx(sources, options, ctxptr) {
+  options = options || {}
+
+  let [parseFlags, outputFlags] = htmlOptionFlags(options, "parseBatch")
+
+  let count = sources.length
+  let bufs = new Array(count)
+  let inlen = 0
+  for (let i = 0; i < count; i++) {
+    let source = sources[i]
+    bufs[i] = source instanceof InputBuffer ? source : as_byte_array(source)
+    inlen += bufs[i].length
+  }
+
+  let refDefsPtr = ref_defs_ptr(options)
+  let onCodeBlockPtr = options.onCodeBlock ? create_onCodeBlock_fn(options.onCodeBlock) : 0
+
+  // Everything goes into one heap allocation:
+  //   u32 inoffs[count+1], u32 outoffs[count+1], u8 input[inlen]
+  let tablesize = (count + 1) * 4
+  let inoffsptr = _wrealloc(0, tablesize * 2 + inlen)
+  let outoffsptr = inoffsptr + tablesize
+  let inptr = outoffsptr + tablesize
+  let inoff = 0
+  for (let i = 0; i < count; i++) {
+    HEAPU32[(inoffsptr >> 2) + i] = inoff
+    if (bufs[i] instanceof InputBuffer) {
+      HEAPU8.copyWithin(inptr + inoff, bufs[i].ptr, bufs[i].ptr + bufs[i].length)
+    } else {
+      HEAPU8.set(bufs[i], inptr + inoff)
+    }
+    inoff += bufs[i].length
+  }
+  HEAPU32[(inoffsptr >> 2) + count] = inoff
+
+  let outbuf, offsets
+  try {
+    outbuf = withOutPtr(outptr =>
+      _parseUTF8Batch(
+        inptr, inoffsptr, count, parseFlags, outputFlags, outptr, outoffsptr,
+        onCodeBlockPtr, ctxptr, refDefsPtr)
+    ) || new Uint8Array(0)
+    offsets = HEAPU32.slice(outoffsptr >> 2, (outoffsptr >> 2) + count + 1)
+  } finally {
+    free(inoffsptr)
+    note_use()
+    if (options.onCodeBlock)
+      removeFunction(onCodeBlockPtr)
+  }
+
+  werrCheck()
+
+  if (options.bytes || options.asMemoryView)
+    return { bytes: outbuf, offsets }
+
+  let results = new Array(count)
+  for (let i = 0; i < count; i++)
+    results[i] = utf8.decode(outbuf.subarray(offsets[i], offsets[i + 1]))
+  release_output()
+  return results
+}
+
+
+function create_onCodeBlock_fn(onCodeBlock) {
+  // See https://emscripten.org/docs/porting/connecting_cpp_and_javascript/
+  //   Interacting-with-code.html#calling-javascript-functions-as-function-pointers-from-c
+  //
+  // Function's C type: JSTextFilterFun
+  // (metaptr ptr, metalen ptr, inptr ptr, inlen ptr, outptr ptr) -> outlen int
+  const fnptr = addFunction(function(metaptr, metalen, inptr, inlen, outptr) {
+    try {
+      // lang is the "language" tag, if any, provided with the code block
+      const lang = metalen > 0 ? utf8.decode(HEAPU8.subarray(metaptr, metaptr + metalen)) : ""
+
+      // body is a view into heap memory of the segment of source (UTF8 bytes)
+      const body = HEAPU8.subarray(inptr, inptr + inlen)
+      let bodystr = undefined
+      body.toString = () => (bodystr || (bodystr = utf8.decode(body)))
+
+      // result is the result from the onCodeBlock function
+      let result = null
+      result = onCodeBlock(lang, body)
+
+      if (result === null || result === undefined) {
+        // Callback indicates that it does not wish to filter.
+        // The md.c implementation will html-encode the body.
+        return -1
+      }
+
+      let resbuf = as_byte_array(result)
+      if (resbuf.length > 0) {
+        // copy resbuf to WASM heap memory
+        const resptr = mallocbuf(resbuf, resbuf.length)
+        // write pointer value
+        HEAPU32[outptr >> 2 /* == outptr / 4 */] = resptr
+        // Note: fmt_html.c calls free(resptr)
+      }
+
+      return resbuf.length
+    } catch (err) {
+      console.error(`error in markdown onCodeBlock callback: ${err.stack||err}`)
+      return -1
+    }
+  }, "iiiiii")
+  return fnptr
+}
+
+
+// Sources which are not an InputBuffer are written into this buffer, which is kept
+// around between calls. Strings are UTF-8 encoded straight into it.
+const heapInput = { ptr: 0, capacity: 0, length: 0 }
+let heapInputBusy = false
+
+const encoder = (
+  typeof TextEncoder != "undefined" && TextEncoder.prototype.encodeInto ?
+    new TextEncoder() :
+    null
+)
+
+
+// with_input calls fn with the address and size of source in WASM memory.
+// With keep set, the internal input buffer is not released after the call, even when
+// larger than setMemoryPolicy allows, since the result refers to the source in it.
+function with_input(source, fn, keep) {
+  if (source instanceof InputBuffer)
+    return fn(source.ptr, source.length)
+  if (heapInputBusy) {
+    // called again from within fn, i.e. from an onCodeBlock callback
+    return withTmpBytePtr(as_byte_array(source), fn)
+  }
+  write_input(heapInput, source)
+  heapInputBusy = true
+  try {
+    return fn(heapInput.ptr, heapInput.length)
+  } finally {
+    heapInputBusy = false
+    if (maxRetained > 0 && heapInput.capacity > maxRetained && !keep)
+      release_input()
+    note_use()
+  }
+}
+
+
+function release_input() {
+  if (heapInput.ptr) {
+    free(heapInput.ptr)
+    heapInput.ptr = 0
+    heapInput.capacity = 0
+    heapInput.length = 0
+  }
+}
+
+
+// write_input writes source as UTF-8 into the memory of buf (heapInput or an InputBuffer),
+// growing it as needed
+function write_input(buf, source) {
+  if (source instanceof InputBuffer) {
+    reserve_input(buf, source.length)
+    HEAPU8.copyWithin(buf.ptr, source.ptr, source.ptr + source.length)
+    buf.length = source.length
+    return
+  }
+  if (typeof source == "string" && encoder) {
+    // Most text is ASCII, so start out assuming one byte per character. When that turns
+    // out to be too little, grow the buffer by exactly what the rest of the text needs.
+    reserve_input(buf, source.length)
+    let r = encoder.encodeInto(source, HEAPU8.subarray(buf.ptr, buf.ptr + buf.capacity))
+    let written = r.written
+    if (r.read < source.length) {
+      let rest = source.substring(r.read)
+      reserve_input(buf, written + utf8_length(rest, 0, rest.length))
+      written += encoder.encodeInto(
+        rest, HEAPU8.subarray(buf.ptr + written, buf.ptr + buf.capacity)).written
+    }
+    buf.length = written
+    return
+  }
+  let bytes = as_byte_array(source)
+  reserve_input(buf, bytes.length)
+  HEAPU8.set(bytes, buf.ptr)
+  buf.length = bytes.length
+}
+
+
+function reserve_input(buf, size) {
+  if (buf.capacity < size) {
+    // grow by at least 50% to avoid many small reallocations
+    let capacity = Math.max(size, buf.capacity + (buf.capacity >> 1))
+    buf.ptr = _wrealloc(buf.ptr, capacity)
+    buf.capacity = capacity
+  }
+}
+
+
+// utf8_length returns the number of bytes needed to UTF-8 encode s.substring(start, end)
+function utf8_length(s, start, end) {
+  let n = 0
+  for (let i = start; i < end; i++) {
+    let c = s.charCodeAt(i)
+    if (c < 0x80) {
+      n++
+    } else if (c < 0x800) {
+      n += 2
+    } else if (c >= 0xD800 && c <= 0xDBFF && i + 1 < end &&
+               (s.charCodeAt(i + 1) & 0xFC00) == 0xDC00) {
+      n += 4  // surrogate pair
+      i++
+    } else {
+      n += 3
+    }
+  }
+  return n
+}
+
+
+function as_byte_array(something) {
+  if (typeof something == "string")
+    return utf8.encode(something)
+  if (something instanceof InputBuffer)
+    return HEAPU8.slice(something.ptr, something.ptr + something.length)
+  if (something instanceof Uint8Array)
+    return something
+  return new Uint8Array(something)
+}
+
+// ——— start ———
+instantiateAsync()
+export { ready, ParseFlags, ASTKind, BlockType, SpanType, TextType, AttrType, ASTFlags, parse, InputBuffer, setMemoryPolicy, releaseMemory, memoryUsage, parseChunked, parseStream, ChunkedParser, createParseStream, parseBatch, Parser, RefDefs, IncrementalParser, ASTReader }
 //# sourceMappingURL=markdown.es.js.map
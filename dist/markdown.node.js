@@ -1,4 +1,1611 @@
 (function(exports){"use strict";
-const WASM_DATA = require("zlib").brotliDecompressSync(Buffer.from("G07dF8TdF3lyOzDn/n7YMhKh25G3afq9opkB20BaZR9RVdWkpDLGtlPbAUGxNIMEx1lf0oIeyq1EvJHG3GEfk6Q1MklqfH6GsiW+9NlxRWN0XTh0Qzp4h3XTN1wy2caCyMpfZpQ2DEWaYatURcrgIjXYyPTzoPOP8+GGDoeuJP48ZHal2cOLJ+v9+qSJFmWWJykQ62U+w8q2odORI0EiQVAg0qDdRU3QG4vFRx6UvOACY4O43rHp5jyoilbbUJeRwr/AZT1ZZQov8eLGSYvAxmWMZKVbLzwPtLben52lFqswFvSuibWSvxdVLFYAVvKNarwaIwKr8aLS6rGvfqbdb+aT9k924pJj2VpHozUtYFVOa+B7+JzDMbUn8x8DQQBZDqNBRrkqQEpKcZGyGwAW5ioqIEmSXdAwvEefz53NmSk5VgVUzYScJronaHtfqoV0HqD93IsDQp3a3e8zC41kt4aI5kgLdACFBET4/75WVp/cA5678ktqzGw4/zdFQVZxWLequ8eveiJSoaioHAB0HxIM7HyAtgSwZbY98HLWBP+ZrX9ruktfI3Wt3U+aYK2d4Ox/awCeK3m+9xk5xdnIkBJnCEmIKaByyxEQ/l9u1a+q0J3tSqBoeG8Z/z+jTveDWSYZSZCBFfFfI1t0mrenhTW5HEzOe1M/HMUFvqep+Wb+FsmtUiN6Kau7TriUJqcAAqPRWmZw6baI+VduCkbWiBIMr+3CJH9pCbwXAvB96crRQaSFn5+h+5kOUxmyDqS1OUlds5FkKKMj+LI9rkfW/b4EzZjZFRqFO5LaKoHiRhgAHloT+0eNvOZgSz+EwPwjQo6W48Sxk6RC6Atkk+FBIpuy+QWhj1JMRwRAVPz70jSv7380gCE3YcANlKNEp1x3V81Acgjpcme/93435//fgKa7MaPpbgw9COQKwEgmgKHWmNEawHBtzGwaig4kN1FyohxCIGltlciN0jqmmw/33aPD3T76cvLZR9+Ovlx8sv85Lan09P/XzKE97TqFlkaYJO/M0WxQEL21vZ7IJaU2QEsvKDAhICwABUB0PBT3krpv7v7M3nXASnCqpf2y1wqWbqmVohoPxTIewIhxKIASdUNE3Vr9mR9bmqYAf4zf27n9WuS9UKQEjO0PXf/qafXG/B1AIYUkZOC3MVpUVx99sWsgKioM+xBobjMBr/j0RXIdfw5ye7MCpO9iygqJOSsslMJYZJ/Giz69aXkGcxUQfJep3rUrgUkO73kL9hmYcdzxmGu3uZ7v/0th4f1n+sudFz/tD1/62KQmtSk516yWq4X3Prneubhe+XAjtjE0LqXGN20Tog8xRmfJudQsz7xLsQ0WFj4E59eLRWy9996HrovLRUzJf1nzm4X3Xx2++qtDu/Kz19nnXpC2eNeq+awL8J/d5u5V7WJ/rbvwXtfOX9e289Z17TCv9+DHdtGYeSfqxSe9n3v7bS/dkvt/V/zUMwMbLYT5vbVuPdL4MIdBB2LjkjHYuGK0rkN/Bxe0wptACqA4EsdUAApdRTzOeekOlvJHq1A5FlxZ4a6xDpqXux8i3nROKBmAW6fVFbY/XiuRpz5mIeWP9sP/l8t+KvxiDgOxMwDFFgNpe2uVWnTA5EwDKbo9oJSbjTDesMoNVrNxawcjAEcDyzdv7apiUqOiXzG90VZBqREhlWdPsy9vKLwRlXsqrj8a+aNxa1pxi69cJ+iiIbgVQLTld8HwxrxkGujCtTPhT2cOveXqKs8I058rZg7L7kcCuz/COFClEZWZBb/Tgi7rezFaqAOjdkbVv25fJclz5JRSEd19xQwsAHb2XvVG6gQVda+STfJYGxXvxflRfmMGqa0aZKixD5RYwwJTozzpqnhPp/LVhzvvkEjBn1q5qAzUaAhbQEKtmCcPA3G4/amAR6EEZ/YYeW0o36ObDYIOxWlWO7WmSZYLv6u8Bbq05aUWGKnDh+zLvEeo0WCWSwWpajPlgeU9NCo09kcSNVAI4OvSQ8qHmhUD+EK+JslcKp2+0gTUquX5RZwCwTdyksvDsizqoWQ+K/BGTR4TQhbyRHTpWtYwIDUNceXZNtIsofEqEfkY6pxLPiqih6UheAZErRnDAW/5aOMTAwxAz+OfmUqk+O5tjqnv9G2nP0T8gqH8//vH2FFiB29FSP7DVcdAg0pBvGRyBtKLW9M6wuOFKh6eoZgLUGP5f+i2tFlNqn1tOaJqmmn4iapOlQhQrqF+ImhNCgD8hvsiICTjUeLoLKmUKtePQSuSB1IDjLeAcA/qYxNHJhLz3TKgtOu0LNdqqFAhFu8JE1VzLLDGQ2RtxfFcbGFB7R5OCGyZtjQfqGd/DlqgDHGxBWb/KESYkZB10BwS7mDIeTcMWuhtnSMPxCWMwBuBcJkhIDKXk0ZoywwHsYXEEJ6w2NIdgLuz8pavX36RnT3d7Qw/IpQtKE5tTWs8Cr9q9T3HpRNJVxmpXg0gDzNBzTs1KvKPsVhGEB+3EPQ3L73NwAKmzAsTtDrn4/qoXxoZcCvHwyyLVAsLZ5Rq6RQpHSeZ0pWVWHV8ykvqBRSw5OXB+JySZoUVIyn2asrnLU4P5T+wqT3fJcjRnQYGda030Mlq62BvlyzRqR5G2tptkhoRljqQNK00hu9d4fw+wdfalCv7DfFLENQJQ7Su1AqSW4X6XgU3wDALvtAAw4F8IxXXFvv9a9gM5DZ65Ihf2aVatyZYiyos7ecG+SSOC6QCefEqTqxJOKIwEkt0Q1tU7pB7Q2wLfaGqrJPuhgGBRmpOHqWgCzpmqz5aGEfqpFfbhdOkaGP8QSO00Agj6n+OYqhO5jTJBQOx6bimxSwnJjLW5uCgMWbccKRlzNiWMfPdpda+RnhbD/NbrL7s91fLt+OSKrUXc+X3JWZAS5g1pZjbbysvajZDclaPQ8seFkW3/+iScjcoLTodQYiOMi3IkbSngNJgAwEvYXeamQzNjXlajn8b9u2XEvM7IGu5VkjDT5NQQ+WU89tOWYQhkYii0UHylMbFzmG2wIo7a8RSOdSRZncxNo6JgoiFUGe90OeIUpqH+bCHtJaBMTdLJK4ilAD0dpr1X7DucxFMgw4lqMdAQEybiB6v+2Z1EnuA0lGsQ98E/jYByqxxDERo/wasJEUqegsgMk8QVECdvJcJTgAyjzoE81EKJhD5IWNSa+QBe+Zn7zRwByrK0P2Ci6eZ/Mil7FyfEpookygHvRiQ7FRe0vXeIgbsU/yvRwlYDOX2z3GCCinGZ7Jh0ayXWq05xai3oaOWXkNe5NvfHcKHdi+KAYguioCi4c0gM7LgCUMT2ITwJkOyiDKIcoCznREjMxJAWYMULnvB9GtQQ8AJGUtwt85MGXWgd8ZHaGGrwOsedsNKEXigWqa+4wD56CHOVcKJIld6Ib99DQDQ1wAAfg2AJRCQ+OoDrh6jFIyRjYoJnf8UTGSYSycDCsuXCzT23l6kitPVMyeQoYKIBmQ53jSCmoio6TZ7dI8Q9IUZEzkHYm0QD7G4ySWYjT1cD8QRBx//jfWzVVBQv8vicAc+6VA2xNxlgCNNA/QZNnutzirI0eGAAocm4Ux8ovafFGHSdGjpqSAIyYoh6RDWFaIYlWI5HVbk3MrIajkENjPaJEwkU/CEhkKQusx1ppv8KkApwTVs5sLOm5mXBnFwGuQXOQ+AsU8N28kwDKPcpah2wsRIhQrHfe4iZPdHozrwFTBPhcf6R1aa9X58G6chzkUMH/i6dfdn7szHaOP3/q++ddo/LXw+LqWcO0+OPfkPTzaP6o6PtYgJHt16Xo+nciIF5ETfhFP3xEIPQh+q4UMd2f6LG40QnyziGI7p0dYlJu32GQYdSHoe+1BPtgp5oMExzaDVkEkjo3wkOqGsWfcWTFepLKWgEvq4Om4Umh67JTgNgYncbVq7s5DMyVkjVuVthcIXUiLHQBuZO6DdK9QtYVxUk/oBLxE5CyFqDdveQoIN6LmVpe40wM5THpwfrGSRE2LAOgTVq5golfSYO2XmGjsfQZ5YFcrGKjjvGgO0Q9bskjkhJx6LDS1n6abNZncd25hhGFoVyg0h5hEXBXQ41TsFIs5PlYw6uC/TkRZr8EaCN/fub+Gg48njCihG/76kHRp/JlVTF9R/zbpgbbxVISCgxSPbbGikuV092yJrjZ5sHcaesM62YAfpMu7ZVxWyGQcinNAOVCI5POGezMO6N5DyurxdN4C1q1Kq4xbWInNK5PK2GjN+7CbChl5W1McAWxprI+IxHZe0oZnvcSlj9f/FJUKxk+ljTPoUABA5Th7EK61F7hpt01QP6ak8TTBVvVwgrzvPy/fhkYel/jQSxw2B79Q+7gbjwTOBbPVHjf/U6s+ESJ3UFknnCPo+KIjOjW0rKDKV5L4K8nYanNRWalHBslL5V9ZIbSySHvAMiyX10i4Oa4bF8otqdxdHbOcqpmF7wxBlZ6fN68c4nYGHMWwhDpzbb3BzN4xsAmIg8BoUx4CYAHOEI2bkw9rMGGPHAAhAABgHk7ZxSRu7VXDrfAgzKzQQpbUHXSCBlaaCYAgIGa0CohwoV6gt3qf4dAxo7BKaAHhaDjt9i8qk4Ap0NWI6G8LcFsOX2grCIbELKivCyICwCQi20igAkAFzUShFnwRfGONULV7pSv/TgvncQxOadgtouKenlHL6Y1wahxn5Uoykou1ovdh6wkxDC0c7Kz5LhuQKk+tQbmIEqcD2FjoCpREo+aOVTRIH+hPRbIr8PSF1VP0dPTGcl+KDYwGDGk1NTaltDdkWerlUojP08EjUtUJax2XkTGeNc8MzS0UsscQlfG0apb551Xab3Y1tKKp18x6UoGueDxsrMD7dGCqErkTQdroxdRaKJ0S3iY+FgIr1sPUi0QQbX1rkFLdALyfSbq3hzj2sJ5PIeCDHiXHidBjokcEuejkVER8B0VspZFzQWJpqNgyzl6T/kbdeKm4UT8VJ6ec6cH2Z1ctMs3IN6Z5NpTJZNCSCMKI8fu8NphgDUhRhRzVY/QgqJRFBgbrlQDWIMEEBavTxbsJSIhJR5tDSXw9dA4oCDqWVOu4lEwPRxccoEOREQGXyl2MiNcjXexUuWX4NYB+9xMzcHV4tDBaZNAe8/IPgEiW4beAsQkiAvrCnxoOqwpxtwLPtkXOgKuDTFhFK2j+ka4HnQC020mnVQH6pYvP8Fi6kNBr1hy8xg2w1MXHTpo6nhJUVIPABk3X3VCjO4/9XbpNl8w7lYNp/h7o9I/qsz1VEH1o37FVj6fee0B48F4IPRsibB+OZxhT0ucYnmE7CFQRYxDiz+bRQDpzNFfa3S3K9BjDMXHDyEcgESoG2QBfb0IAdrYB4dWoNJezeUCrv9KerFQ4Wpp4GZPyHP58AB38vdHUX67dAkWdSP09fTycG6IbGoBFVc9vfvfzzwAeJ2hP86V+ilu6CdcSsbnH0On+WLlk88/XqUnli3COtHRfBUDfqDHsVDxMeS66CnY/Fa7KUY+7JGF00NWAcYsITFq8FZKiWEtFmLmNTNFZsgRresKSNkCE15j4KtIAP2stV4Ql5MUq58LVKA2fz2BhNm12jd/4kXOZY8rHvnuRlN1k7g8hzGea9r7FQOJc0ZobiozHgLSu7TKWRfPRtFYwm/mLaa+vIj8yDsXD5BHE8dHrqrk6JjOSC7PEmJh+WNXL2DymZKI3rYRHrcbZOvjo96AnryPckcl7DtP6AMy89htHGhI+OIoVb5a0YpJQluf+abVwD7KsA0dOBEzFeTmm1/k8WhvJc/Y48SYlkKrRBiNQi+EjBLAxUldTaCE4atM7ELDgYLUJxruabbM77iWwL1JvFkBF0WdBrhKnaQzKc87lxxsQqOHsKxQnwCjhwatEXsDz0aU5pK8gfosMuXMByX2k4BTdMFkYdpxoBG07NMdoXYJPBupFs9SH/dQ/oZiEexvk7VNInUKGNgd42iEv04vBTr7BUOiIUxoxOmUH1YpoCx+fVIeeiy81cDiqtFliXrU5VUxA/KwFaq/3c8AiobjvM5NQIiLahT2uAP9QsbWyLkkf4SZTaRcEPhoeiryG6qzG1YTlysNkQtlQsNuQlsQ7maEgDDmjsUaMIGLJ74WwqIyNUGkVhXNxIPgQXzKreDoptgFw+f0GIP1XIma8nfi/Iz4ntFNISCTLILo3dVmVuDYsDkn2sQz0RuW0z5PrTPfpoc7SyT+7Qsmdv1cSujmcTU7nKK9D0QNPhxE8PFZNIDGhsdcskUHYMgskHbRUvLCifX2f25Xq1iO/pxAL40iT2KL6bZp8ZJORv+k/i9fYK+ppy1vcx7B2AFGfZjOZ/qxrJHA8d+DDI5ixIkd2QWvD9MsAjPOsKjGS6AM5rH9QDmZDj6Fd738xxmMQLk2GbmJqoIprsgbbE0OqDahrVnNyEJsstRy1lj4hpD/RofQPmbKZqI1BQCPppk7xu/aLZFRm8FMc5PCHs/S8c0moUT5dWCYPTsjhY4jwc5IigijBDPzGLLWw76wrrUyqGVvauhJfYUn74aQvgVEVMppFkwVpkCJUwoDaCG45D+wLMfjT4ZpZQ5IEp0yxXTAYKvd2ls9IjGffrYdzPYIpoRpgcUXqcD6dcO2EmqPWzZEl5YU6rKsdx0Fo5PSxC6r7bwmLWtZKOaqyDBwYUT7mHiLJO7BhX2G1rwkgoLTJLUtQ9qwnHmS7zW2plp6coL22T6Z3BnLJqM3F6NynBYEFD97ERyJHcO//viWYVBayYtNNOOunkwXlw2ZazNRXSjPXoqqa2cGMQ9kHUQxYDWKkCWBDwMr7BJFVgOiy0B3mw8HoUUOuuLSxMSZQXOQ2sAt6JRecdE9qGDByt3kN8PzMT8WtN7xFKEzs/az1Khdxh9CibIUY0pDd0N48SqZDlb+whDqcpDeGbZUfIMStgubAmqrb8XOvgkp1+PB+NbybOtFRaAENmgsBWgZbOJdLdu9e+qnDFyzBG1wbSYo+3icCx0BVmWedM13vnDa9qwZ34xOQruqeExa2a8EekebxHZ1RUNrIldFmFJasUKPCWyqrVjeQu/ADhq6MNXSPzTYOYJavDVCr7WKWBYO4EeJRr7NRxeNroHUH8NHWTEWtmGK4bWFf+jvmp35YT3ptFCtV9gNgjHZLX2LjfhBgF2nMny00y1jlgdzKhU9z6fqvODy1gwuTj89ptB+TuAtBRmDLdUd9bcg4zVKlvRIatKJC+jVNuMoGdAOsj+Hik6ZaGjyW5G6f/l679evCJYw/XxQkZkX4BW0j8pehPnRVyJfq5rW9Fu22yxBu2HSBWrXYeh71jsmGhCORazOQAeyxHp7+WyKqIhmtn0m3bQrlHFGNiS4CuxaDZwIK/XtZFDJ4OUVRKKpZjW78I/v+iauJ6rpslYat4xZTP5GuRzNHiZ/170eUwhXsdQzZ5wPJRIj+5Lqhf4TUEIH3qcY00J/gK4fF7968MUwfsKcymhXVD/cUQzTbxcCayp9rLO83sv4SIVnPa6pcNe4+1usc4WohN03g3EKKbXciTqQnuF2J1DaQARJVHKw9nBzJnTDBy9YMFl3wT4rW7Ro27wqbYIj2xR6qFP6SUoiEFNI+PpfSIGi/woGviSa6MBoY4qO5NYapswYvZ0wuSA7DYfoTaFpNZ8POH3pkLLgpNv4qhE2jkgWb1pcVKRK4PPXmOLuagTRbToqD3qvz6NLDZWyCWGt/aC+bMqtIVFNnVzY7j3jrJIEep/LpWrEi4PYL+u1nfzZ6YbuzKpe5KHoqtGrLuKmZIL5amQEaKTmnRnwukM45+dLX6iM4fKRfb6TAQ7RxdPp0twbJo8tg92iaWIOJS6krZAL3qWvQPn/SjnLSU5jjH2Yxq5NDK7mXTc30iImHG8LRp4mxjF52w9siqduT3thkaCqshEKJoMBolnPHzQlgqT4cZv1y2y7BcLpOzw6TJm37pD3FajMvmRZX6uGhoCUWpAlfUxuB0Q1zLyUUZbpyykiAauU5dhyv3sDiiJeJ4YuiMeJCjVrjtkgb2ktzTMJvQ98D5O4UKeQqLCkyimgdkbh8EeSiSC5SOYTFI0iyz6qjYxcrKeqa/n0X6R2OD7uyM7POJFK0+nvVs8cJEuzo/pmsaT/VOBxm9KxuegfUnEHSFaC+4CNYYsU+wEnTxQu1cxkNXAq0euDjjnrix5sHRNImJ2t3kJeqdtuKh4SoQkF3Oi8pYtzCjVKtmBZ+ymGjkkRhaYq61V2KwnzV9N4QLXijMZTi252B4C8S2kh1RPaAWHqImDah/oMrLuPDxS7GgxDsIbsQ361qLE6BVtzmi/sguexroCDJmo3EoqqafTiwYkrhDHcxaR3fMkM3KORc9aJWW6VDimmjMTmwE4bFs74QMIHGJPEDiDXVxwT27ZALlNuQm7hUC9iNlOYFgBRJvnbolfwRGqOuuXqy9DTlZv1vQ4A4zWxWj476Dqyxyy0lPEt275cUenRs3S5JvZp8gULgVcPWj7W7A76wMDVtubvsIPN3r8D2YzIWGEFJM/CuQ6yA7GZ1meUS097HQvFwrDUsYbg4sqBXqjH4NHRyMQkm3Vq70hlOOy5LoUORqPkRE7LUORR8IMjJx9aEwxlU9ojTyW9Z1eGzGAJZu3YlD7eZKpwdJQBca4eQPO4e+p8kZdPynhRxyqv0vBRBQNLcATcCcO29s0c0GwIF5adxy42tENKkXk294c4Lw8Pjgul/Dq4sUwf1rem1YF9SopzfVCAinqase5JHIBOaWEyH6ZchwyUoMTl3IoKv068LxKEBboK6z+fXJdQCfsKNi2xjEus3FUp592J0zcFTqtdJW/MZkr7GDDXs59Glml241rtY8DeSxJoknzpjZWuI3vI+XN5PDSE2SuGiD21WfSXhtPYjpHdou/+ApbuahX05Pcf+oC2Edkf3gqt6HPeyE+2r6AjDJpAlnwU7JdLVmikpBTnnHNBnCbrnVYQ/SB2fsIWjRrkHLey6eh1EXredlmm3UZrb7YaSC7RkZ4TnaDOH7xGOaJQXpt5H3SSW7dNE+qogISpszeNXNZcoLlCvHQsp7yZUzBiq6Ei4WB2/04yCqQMPpxq/cWWCzJzyAYGXkZ9A9YmcY1gjzU3CMaipTigOUdIwyQoO2LIqP5K26EGkdnI2KwUKiEmv2pNTnKbmE+XbU23Xhchbegyg+dG2qrEDMlRXlbTbQqsG6NhLmC1ohZcdxE5f6dZFZnnEzL5XgTV891+Ti5fXbyiWy8XiRQt5kChGMicWMUYa4JHn2rSEM2rGZfjHbwd7O+e32O8KnOcybWjVdl7rP75FfrvMbKQKrS0B1HrMVLxcg5lBEwNZR1AOxc9WkPm3tTnuoXhsLv9wiCjoXggZK/ulktiKI0E+0phdWrZ6Dtt/qOrHUth8ZjnL9/vcq0jlYJPpYybACddpQbQFqeQ/dQPG3KuQqqj9EbQolGbS1qDMgbmy7lHgLaEtMZih0bIeAL6mfSjLq9DPEgR04lmDhTUjr5ib1kGuMGON+75x3ei5D+andiKweSBCd49pZg9vpzNmXDKJDyFnGlBqRjbdvLzX1/9QtVrrejkZjfyTYNLb8FXALV2itl5ivaReMQLlYmf6SQc3Yvi9E3BV2T4xwIIVJDSG/pOS4fZGMEjWkyYbGOB01IS1K1zoMBUPEqlW+nPY8CZA3LdJs1Lf2ZNJZC1ZDjSWxtwI7FFQSbOPhgmldtmDnHml8IzcRkQXgjniIBSNElB1eQyzBSIz2IPb2ZCG2XpTEu2Z5BvhEkDcVpnbeNGVRLRcmgf+GGv4RiqURduvkOwpBhflQzScH2iBi1Y2AO6x556ow6zvzXUjJTrVw9fvDORgHZrH8OGYtFuL6qKPahM/WT5jpe3wHm/Vi8oSFE99Dlmb7zbhKCAdOEBdN0FEm5uGdMS6exfh4na6UHHO8UKVE2Jz5hkPFYoYFMUHsQrV3K0/GGAOT2FXN+F7okk+mHUXdCKa9S+DFRlI/9rM3gqRF0ZC5ZrZDZ7+P/2Dy7WwaEGEFckOSWLHbVZH3qtyEGl1GlWw/mBa2cNfnf2QuIsOIT6W1aRWFIUldYAeB0w68n8XIw/USyynbVzXaZtFZ3FspmKQtumCDAyWz6DsXaxyjtQyBxOwBmpu+PUdp3FJ+8aGldO3YEXxX183qEeMkpwy9KhLgTQ86w1C2clPOv9r+MZFc9MKXf7aNE8shU0P3hqgPxwft/bIW5n5UagKdcqYhs1pV11AMEnOkodqBJOXoxuOxPmFKsDEBoT3gFWo7d5iEi1ozZ/LLMjqeMoRmHgyzyNpOzRplwq4o24JlmDseuPFtkXoFhOZSAAjopDzXytGgkLVtETrIXpIcj+oJk98msWP0lUeS6Etz2buSDTr5r0IEvLP+jg5M2h7Kiq8NQyoFkcYYVwhjgjQJiWp9Pqg1COx9VzXVuSmXW7MRzWsuSdvlPlz7RuQYb510kbRehZ0LvEX8l5e0iY0504NIAgQ3asuuLzN6a/aN3nMmVevVmOB7heAyUxpEHx+LHCNr55NLpUVyJDaRbZ92qFwppnhUllDXW+Zh0OVOhWtcVOBA2F8Kv2zW4ESMxN3bXNQWHOP4qtMf59fZSKyiMYuZtnvnFjt3vGCZg9m+fffBQKMA3WWINq7LVWZiLgd1v1jYnaUei4XIOpV3ir+uJCZrZ6Z7mlIZmug+7uTYT3qfSgR6PX3w9K933ejIPREqoD32PlhNQAYmncL/S01JRSeSa9YmzFaa0ebVJF+KydI0RHgp7TktkjVDKsmDkslE1SC3ymkatqv4XGcbVqFjxDVJY+dOqgP4ReEEJmbBzsgvpP4bwTeFvysywMUbfA1JyIvI2Dn6WaHrDyWFox0f0kydFt1K6rpxc0x5qSWNzUzf/9xMkCARs64SBrhrTIq8CKRAemSf50j8LBp5ec3I6CQ+7UbQsRlHEw4xeOCJ7amBfGPGkNCbX+Gz4nyvffSSM8hP4GfjE7USGkmE2FR3klqkcTAkZYxTVR42m8TKhBDxZEMWnbd5DotcPMmzJZ1lmVhAaTNRrrKkjUgCipOXmzq6ZMLLsGuC6RjVqpdilGJzqfh2Twim8Ust2hnA0epK+XzxEFWVYCXMSaES51/QBEamYgEukKeEecpLvIAvVj2GD3IAcBSw7xAxBBaanGttByDBcsIRU4QJgJVVkAViY8YyY+2iFZcnpBySCiKyMsDDCR83DqhxxMKQzK0vIRQ1r0/2KWEKcWNi1aRIhBQ1rW5dg75ikOOH3PySbzjqeoqlmG6hyeRbT3e5SoUhSKtxkjPCw+18TC8hhKSbRyomJiiy1FYSDYVB5ogAcIABCJbghFA8lCeEjAYmtKDNEcXwiJ7FQxOuQQY6l2ht1paeQ5MBhgOYB+jOriMCgEBwgCaGGt3btbM02TbkJWc12VeOIGsftPU/0zY1VlQqL//ZdShGWVthtwGgWD4ZA+pC23A2aUFji/4y6xnryiMoyYlKzDBhMUGXkJfd5exdvqHaN4r295gEC/4F/xFyY4C4MDsAoRdmtEvDCylzpktXRnJd5XyI19av4c7rtauXFgvHe7PMwt54RLojupK+O7v2Q8lHfi0+C71KPbymPW/BOc1pO7Ez7+xwNjgINUQmeq+pxBx/G5TRYPjeW5BC5o7RnKkqWoQ7Fi3gZuTG7XTaePAh6hkQAY1u+hE55iUQu/xi0Yp3Oka+L/LNpUMl43U+tmTHlI9PC+FZYBTTZZ8BOnaCOBxWBak0GT3TjpTAz091WHWtzbQV2qrveNzSBO7cnO5lu3B559jp+LLoa7QU65gl5qYJnhNdQuXJeKqAA1pW73S+H793S56RfhTmL5EqC7E5Y9oyHNJKKVDQ0w/Aitp6ldQ7vTIau1LKs3EDinlrkmiTFJui5pQNAbfbpGk+1PFniao5IUfndI2S67k0+Wmq6yuzhwxIq5Q6F7TTKMB+y9zI2msvMBYDstp80ZRq+fg+Q93hbMUCTHbYjJV1dyAI6ihqWv4mUe1+bjqcgavmKuKlLGYVPD+s0mfavJgUWxeyzVwta7CsV9uH6/K32SJvLObQ3Jt4JSI+nYzsamwG2/KhapPQHoPFCilIuMr2e3aVomzx54hjWVCAUjknUxCFXJ80mLgNJrl7LsGmVKT0NYzjbMNRpk7aK7j+KkBfd7buqlItCK0VfIO1OwU9i5iSfAwLh2n9xriHFDtYHhGaUf9eTE/QrzFFbgViQdA8UImSw1gMzrXgfUSHyRx7ufXmteTl+JTNS3p/sDAU0r6JIk4v0+rE9vgeCCd0A66cBzXNSyl5Ep8WBuAho4vEyjg3OQXoHg92wOat1mXXptj0HZJ97qxKkFlx1yYeHScRxWFO5ZnsFPoiCdZCzAl6Voyjt5y+bgT4LJf+d5x4l81E2541KsDO8rIN3SuID1K+AS9yzwS63XJYv1C9pQxQ6/6w373v5nE/+eKxz2B840wDWGlU0bLYEGqAD/JLWLFurtnhhsuaYrpBeAzLjtcMdL3/PuEoUlCbhbzjlAoKhLXvM2oG6B2yNPxGbHuk3VNL365C72zbmaH2pOlk69Vq1UzQtVoIBtG1ZrlRjJg/yIGOyKFiNCegh+UrQwVCP0Xxq1BzNBwS4SavYv5bfm1qm8zVPOx1CxSwFIzGn+3Vyq20r5Fu94xQAjy4qbIljl+OKuYFst13FNKLvQmkD3AZrRcolyEN/E0X+NmZGJjLsDLo/Sed3IF8d/q62vCpmQiuLLPw+dpuoUuBL1nZFVR6AsYgmALz9nh4xa1gM/Z+EGqPRRl4V44iYNI6/iFvH8gPlCePCriA99fNs9knQpb18HS+/jTXcyUP0BcPSbm7kpKkwsT3SYWCgedK9QZOb9yqwEM7wspxL6SXFfTCMQltSH1ObuNO2wLQUBnmVyXoQjN3S1LAdkHcPlPAT3eBeh8EfVdOXpgHtde0hoIgz42vxSMd5binsnjKQV/KvH5nuoDKjukqANknCinkWk2U1+3U6p60M71GNMJSTYbVvuZiI691xQb1DkhP13tHVgVeFJ4K9yXfB4eCze6GCZfQrNNcY2ZHcqzGZqcWKmoyUrOl7UMjb7crJxZWPWiISm2YddWwdImTFNRGfzPyNXYTOrQz+lomOsW2eXRFjeM15UM7kjPtQBzr0mFzVVYNFuXVR6zXyc7Imbw+XDnVExE8qiLD315/uneS5yMFlO1hIEVbzAVxUGEbcWOHUvyjKs+ba4pdl0ph9Q6oQiA4wOvDlVM9eTzatfaqN29wysOXD1i9uyIJ2VvplvuCrCrqdWL7I5FaqTGrWilUfMS60RGeDsJ9vFsZQWn+DD/3j0vM5ObZVTUhyyhhbbte7zKFpGi3cmFmxZbCBnZ+aeFE70xcv0kGFl0b0+Yz7Xq9DgofaOR5bQQyenQ+BDissHXVwDwawPnFj8StKqXAaO8nONVsMEb+Ke3KJWKqHR24U/aQGnjvLK1ObodK/Jz0WJ8rsXtQNQ+kUOvrithqG0HikmuM6SwpN1Etj1meH0Wh4MQPnNuUBJk3RTJp2trScvgdWyPe4muoEOqtumuyzJTpiH3LyjPuWAtX+YHVV0i2toKXWH7BkS4t1NReqAIPOjFdiHS52ef1tJi/0YkF+UC7J0cFDqqrkdGY0oGc1htAvuy0wUkalRl8F78qqdfJgbme5tGsdJc7tywFhSmva/4+KU4YnElD3zljJJoz08x+72s11grNNvObunOAc4yjMrP8ySCxQUE57wWZmPWYazn7mUJ7wiPK72slGbnC6rsFCGQ5Xn9N89sBXt2N1FIuosQUHKu9KAgqzlPU952FEpbM8abxdlbn2Sfj+NZaXxSzn0fuGKzcEThtkORqEnbDqe7dxN1TQIAdOWXKP6IuOaUNVkisOvnoULznqgANDTls9ZMknmglBehshPrGNxCGyQu5g/y68wKst3dQRgcSJjwq8XlZWDjUklJrfcOskm5blSTQdvaJbJ6IeIB8B9AKwVxUdUeYBVKudP6D4B/BuZyGhpJvXeCwrYUZ4tp4YMRU7mUtaLqqh0QnVnWmrc18sENOEW/IPREYz2L1yZgUn2GkBtMZNzOG7qC+gB414p8P6ciQSMpsUiqdQ2EiuxSWDP1zuycg1TNiGsRRtsJAtRszQMPVOS4NKI1cokNoUHwdFrkkh+rAFYx81seHXjDO2KkareXq0TTkiJN4mLDquHS0pa6YhXzX5C1O9bYNWhzo2M1U3w26faVSWSXlSmPSkEnBrDBPSVx5BActAEZKsRYRYGRxmr4C00yExKBxmcCxCNbPWxV1GlrB/tjYNaz3w10xoBtQ95gqoBnoCwS+X9u48o9we+eJ9rXfJYMnII4Wx+Djz4lo4nOPAfu5BUT/5XrDc81Pt9VYmAlI5G9RQ90/u421SwLTPAfwmdj56qKicZr7Sc6eXUQhGgasBq9zFlJ0iIaEvYuemJGCuL4kE7+bZgK/XQ7hp9TNWnyjs/whedQHU5RVQqQrZqMXEI02CV2cQPj3NLNJma3THcnIKbVc496ls5BhJLikwQsjqmymeplwByfjWtHSbi13sEMtR3iPE29+XyGBjMPTEjaovmy2iBZ3BP5zy7WOwotfgLXPY9gmqX02s5D82pkAIu88wyG9MPC9Iwr9K94qCaVqb4jVeXNOwdv9/s9p8mAK3zxF5nlOxRyxbrkQrC2fPC5K2Yre7yViEZzBkjadBrt164P7p8JW1rNaEeZm5llkXIywpsWozOs1Lslgg81Ktj1orx64AEoYkAkacNhYWQ+UDjV3qmc1VjA1uau2oHkecpaCCfMnxpDO1/ujAO9DxL6XqddDdFsBaf5SRFgnYeOHWqCMbgufJZECe5DeNWYpUXtR5TSA/JeqCNAoUmdMiUYbIQhnuleMwVOvShPTEIp00/7bmLetL/xXRgRQL80gERxcyC005eifwcJ31AhJCzqQlWxUMF40C0ruWPncN/Nr4jFwxFVPnt5kOmbtsiFwkEmVj+jj7KB6zf8Ct86Pg7Hxwd/Dnvw/+UM/fKluPgl73KPzu3HDBnLnNnxuysfUqDKQsZR/8ZhV8SHaDWeOXOQYzWVycqfkqSIr1MR69bfIe/EY5W/wF0MsPkVmGNY9kTEFeSjQllQl6zXSymFoH4pa/8s15WGBoEne26eMXfaL3xvGa8oF6CNQrHDz5r7IknlJz9Ma9Kq/fv0NjzoiLkdXBRBKwzcVu79xrnH6VbPki1BjfO9k5iHfd3MLiUN+L4Z+BDW3BDiplwfZOgT7Zu0gtUVNrDwUMys86uBVDx6DfFzw5nPLB/BDeLX326Nh4J32EW63u17wiT2cdMCxl5+JxjbLxSMYPEO5jZWoZT37U8Q4DPwheeZAmdccogyOsRSwiL3gC1yptca19ZjbX3yAbXa1nsgMT28U3EcPthy33JZUB6z75TF0IPh1kycj6chI2mRSRluOUveMfyauwUGiHP/CapF9uzQ7ZyGGD6zT6ouArfJ+qjlMiw+Eqqc3W/3gXosfCEFlR0A4idVsIrieOHaG712gSXO/iki+uKkcxgm5a6kaSGSNKr2fkO7s4gFYe2F9TG+9hTp0yW8GKjBrkU1aVLsO2g6MsiB6NJ4seiiI+5JWtokCDcQVlLlNUiuESvBhjfUNu3SMAnTVe0/wHGgtrvCu1WALe6Ab0r74gJ0I0A0Awb66ZyW7LXOP8jjfS77nxQ0RtLzwNjemj3BqXLUWziFBezk4krJmHUDRwgGxtbmPsd0TiTQmYY6B9bvBm8mhnQidmTISiYDVrvo8ZhaZsdc1A3PpgW9RktFEAHLGA0FvGZHMrSFu0qb1aLIrRlRZCwhXdkmvfcCvUZZ8S9/Ds9nw780BP1DtmBrjkcQlP9l8XkoKRXN8MEJWPT8GXO2ao8lCCPFNNOmp9otAsK9BF6cRlY8ppgYhiviVNyVK1i2TQssQvG/LR0keo+IeqAbyRIhl5CfKSwvpB4Iu9QEkiIpFBRluFSPIByK9AcQPQN/QdP50sPUPYafeMDwl/MXJawRKD+/2grv5j6VYVG7xok/ykU2I31BL8FT2Jw0W88ErW498KhmBhbH+eXBmH+HrNkuBj/3R5Bdi262WX9yI1UOkYHf9xH5qPQxO06uSJ31PtSPU7tNXPDVyKcdrGrok63nwoxVFVv2eTzLjXuUROefeyR1KqSOjF5waEtkNfCtlHhB0L/Pq8GYu8yXfLnXiwGMSYeTotnsOc8Gk7rtT2+o0iHsYBnlgE6bha7YV+CAgJr4HhATmQ2DSg+4oNNdp1nBfprr+mMsRhZKQZ8rePGuu76hNv2C6aEu7r9YivE2pZtfTWzkCPg8BLifPzwyYnyslhfDNTQBHCbv12TvbfmnubXavaMDsByUlycTOgHUhPTUhTPW8vGssYzhLh13JYMtLd+rpDrzllMZL2bJupAMdGelZRqxV/23iyeKxuq1X1iUIlXiHOGYpEOnVHkkPrfz5WIxVFG7fPOtY0TTPiPYDTMNvyBpXhBQAr1Pyi75v+/Wr1Kf+OitnmuxvvryR4sb6xmoH62llRJXI9o0fYd/l9+cXkwuVhEUi3QfnuqeZdTeFTSbheu52bjIk5qd653qnvTA/HBsml1+dHc0VBFL2jXF/uK1G+VFcVrjEb7BTu0u7q7gCmkWZ1xUX5rPTqHCRYl0LmjHzfXFRO9uvSTVfb6BnEFXg5ufDmNqRuJRgYYVAhzg0yRYo4AYsriWP9pbSQ+ofpK8t8yk5bxCiF1IwILgORY7Ohg/z8lOdiAlIYWKLBeUD5geCBXkzSGiFRWdtYQBXr7pfTyKR9CdOk9VcFd5gHjyQHBKiMaLT/VSrQl5JkG6xq3Ccv803omtZsF95fvXT7FL5vlgZcT8duFWnjTR5UmLXJlq4zIbHT37ytfrSoOT7Yjlkj5O9+fmBmNCUFUjI7rqOTvhMN1pJpv3W46GoBmwUBEgy2w3Ty9Ue8loANu0Y+nyas+GShHQGdW+Ne3OpZ9EJzo7E4YsrHu1NWow+Bo3AGCrBOnRIdxzj+H82CAPBYchJzUyKCwEJZfkrCRBBOCB3w+vESFJDOgIXLQ1hao98X6QmstbcPUJQ/FkZmiTahCUxW4jlXVgqEQxrUku5G9CyUbSnyqagPxyf0sHJH6sdu7IjqhXM5oaiOrMQCRB2IWenC11bRzBS91lGNMzXrpTzGP9hTcxTWlTovCOyQVzJoTczo45ZoG8WiPUncaB9tdcU4OCkgRdXEsbBcNLaB21s7NsvJOUWJanSt9Vn0aRW/MJDRBUuOMEIyBwzRKH7L7KDEUc968UYP36AalOPXFj0Q7a2+40suKWKv2u+4WztSQOPeC5+sqhXiggw6fdVxAOObQ9wwJCNinrvxrMa5zZJUS1ZpJkiY/L63UIYqXxsXOaVVHvVRaue8UxyFPVdzPxvY0b1gkVXWB/t7RlfmuDwkV1UTjXI9uTxWQqJV8JOBTLDnk22SlDDLNYgRJFE3fofuQqXVkPVOu8x7gyb+9pEWOxuabmLuXlqsEkLYsP/Ey6iOTtxjnLl+x0sUcLg5h7BMSlnPXPi6VeRCgu79iiMSdH0N83vv8khYBSjQj24wFH490+Y2WkohVthhs4xN+Y+ZvRNDTNZDIfT/ZztG/m3GSY1qe0tkLLUlGAa6NUUxoRk6IbNK+IuAU3WpLve7weMsEgFgQ/U9KA0q2GC1WrCrvlHJoi0BMdidsdKlKGDYJ5v2uC0nHdK+57s2xkLSOR1GpMonWbtnQtvi1aKRcYLuaGuPcQvgKpsLptBXzB6956lrmmwrLURBY1Xy2jfK9JFyN82Qxet5HgSkW1U1gkGpB780QIdY9Vtf6HpRJAh9Wj3kdAVxlzTWHH6q5mJNF2dRGuEByOjrh9JOhclfZg0DH85DGuqlkVmZ0PhsuzPCyKsnYVrdhZGl2v4Ghly9kCCbeXrYSPECWO55uLc/wbx2SLzKpvbzse75Gq2ACCTuwU5D8tVv25XNdSjz3+399EpRkzuofl5YIRezerAqGNxqXYeed44kcQo8aX1iKNasZaeodW8TNjsXANOxIvABn7kIzrCGAE93dOomBz2wzPRHPf2cAN4tevXfZTdt965/CKbr6ewn2R0y7XT1PiSTczxWhNrLvbVJzNZdU3X2mvmcOmVnLNucpHgqOWzlQg2kf4QdXlBe1S2XweSswWeLK66WOgbx6bDcHQ+mqbV+Eid66qImhX2JsLtD30Q4twT7TzwcO8x5KB9iots8fCbgSvBZbPAaMdynRWYEJbX0epvhSh4SVxFzGw+IqOhG6PFew2ZjogTzqbyjajLrBHuu2l1pIc0RL2Qs2LPAsKHu89M0P+jRDN3CDdoRlqsz/Sr9otYMslgum2NcDWpPegq/UfZIOa5FhD+qxNZL5R89YY3sT7vUz0dNhhPsYRlihL94H1wT8AMUMatErJDeQUOLJ2COMWjz0jiWZa+PNCYkvetjlhAZU9WVFfqTfmWouv3E80s7ULNd+zqLewnVr+qUAYeSE0m5TwToqNwDffcF44C+V1wTxaMRDBrZedjq9TtAjAVeZtmGymnrmyM28GqKpF2NneaQtrk5wyXpRFGDp1yCvqeMfuWXb6dO4pFppqahX8Ib4rmmhiYoi2sopizQ/VLarNqNrkyW38sUmaxGBf4NGG7KGuLFTvf7Y7e+KNCYV0Je9tjCgg1Nut6LKOnu2ZXcNNDvYOrkd5U5wDPDlfZNFI3rV7z9C46nR8qBJLrw/qtsenI8gcy2Fi5wAD+8pZJ1601rYkQcYPozrXbUMy+qtt+dmIjQETsrZITSnf8pU+DrVmpTKnJrvUP5RHONR7YLLaqYCpKqecm4tpklcFQHO+MzAwOqRSkmvVnWBo66bBDtGEvgKEo5qArkpTQNi4GfW5GSAeBqPqGYcaG4PrxSScMBFf3zrJJDA3N+dbMmmF1KVIMcGnaUAsL7S2qbmKPsHqvTkKbLgL7JRP1sezaLTOAgmm1B33yf/6g1xppNstVhEc9HLEi3oLyhpMSh/oypVt2saA/a5Az0pjnU+rFCj4rJpvHT9IUuyjJ88vePnUbPSvJtRSGvCgVQVJ8dVORfE2ABl5rJtB/gnW5cwr/V892PwfuRKfRqeVdQ0Vvqcfv1ieEZmsIzcKoKydSo9GyxFq33uVCBOJ8a81+yefC/IX77/5NfhL7ugtOoq2GbgYLO7v3if2LkTxnQK9yjpNGJpvfI0n6qEgnKUYC4zReZi7nlmocck1hyUQxqq4uUq2ydEi02ENQ303h3qQw0rlweklXdg4XoUk1YnBHxPJJkvvWBTl6ijSJIYlFJ/HtGONZw639pYRDn76G96aaPzrlQ0xNI3aCB4w7PbCbYD99f3RhMHoimjU1A04mP2EplrtCWwMluzeIcA0qqfy4C34pxktjOAdhujOc8+H0MOvTAqjXwrspv6OQbcmPWirBB+yREr/uvSkr7fK7dPIB7CgoELuKrCpF9vFxwHQiLbLJfVL9+x5FL/mPoYG7LD2WmvbG4n+RcQtD+no2+65flo+aLmix0RzRb1s6WM7udapwyJW63XsABBjXhadyP89Ao5lIWpcrLgbEYTH89rkfSLlv5wzwx1P6qcreu4DcGUzu5gnJCvH3udEZ2Hkr9q1PGFKbcUTajatqhlCQ1rnjyWAUQVp7NQndvrMd/5vHorXAEryHzlUKemnWsu/Mwkj1HmmgdJfOHl7CzXFN+rQ4lhgaEcB0dwerQfbWre/97yraN4srcLG4G+O7FV0RDR7fUtcZ5wGTareMFF+ZIbSpwYcfmwA8q7iziNS+W8QWIRAmpRmsF9PA/iD7rl0+1pyVzbF9FZmOXSzLqDful6FPZH5/ujVWfmekoP9ZijRz0Xafmr494yRPy04+rW1ZviHX8t1pGrz0yfl6t8TyBvhZExZXbDirSftirTS0nav6RPW9kwl1/ChZTTfIbkEp79u62brCLzqwuJYJcK/GZMPChKps3v16yXJUjii0EhnMT49U/kC+xZ8RGGUyoV9+/+zL11aK9xRHi9v1J8vGPwsVBLP9ln5MHfXFT0HoArEHb6ydj6l5MYGMay8HBH2ZD0Ot2SqXCx+VMVk+zAKqk9SX48K9XS2n6rFaKHVvsXga3JtsYzREZbjEal91tViFPkMmoT1AfuMmpfzGPe16pMScAm6qNXWqhl95aumRQvn7j0zXCfWO0jcw3zBm/+LflHE6tq4oF0HtRaoE5qGHRDlif2tK4+X/BC8/Grz8cPDyt8LaU6GpSFIThnPxnwo3nSBRJSMLt8EoHb9LTOvqS+HyK/pkAqX9/ngr2JXl2WoXYVlPRCAXes1FtnKDbPTmrTLJSzLqj5ZlkI9KL77E0rT/S4klgwXWdwGbuJepjR16+SnztjRdlpV6NQOhnAwxuZPWyTIGsu3Empm4j9F7/udhuvJsdh/X+Jd1ZxFhehFkkE7d1DGvZGe6hvNk8UWhQ+c6FCTUHlrGOSAGlDQl8KQwT6X0QBRWxmfPGyEv+WfXoUiNKb7+TdFHX8/HYSYdnCR2SQW97BWGHRsp/yyLxWA3158lS7xZzd6pP43xxJFttYj8nrv4urI919oaYEjMCLGFjaE1Kpqp3jaM6Vt5XMM1jHn3mmY1ygWdqOjILL4EA1ldxCtOpkmtsqW9KGvjohNn6oF++mzr5aAA0e3d3DH7BC7Nu2F+aewzagD51KSrPnv/PQ9Fba0DOdpPf9w6eV6Cg599VRt1qiNKgpRzmd2imNf6//m5Ksd3nA1QY1+TKz+VG5MhQBCQ76cgBAw/XEk7Zn5BMtEdB7MaP/T77C81J/1js1gDagUHaLEcAlGDUFQhAsORlX4Jdk1w6XIBomhhhycfrtrGmFm0cGSsMwkrBNrwTuMXuO19aID3WWV6pVThGeimEvThlibvdnHwS2xJs0TrJHdl3U29IzL2UBXGeBn/Qq2Ur7TXG9hno93vn3rZ8Erw8ld4lrfNPxXc/W5vO5lromhVyS/w07PRR6Lhr+HP3J21+JR7vqjtk7sU/dzDZ/1LcLUfjn1oTV2QaB4uhMCQSv/PdWIvX1rvrWmaSVyOHmNKp3XtYx5wAXaH83gecLRijk07lJdb59pVtyNiWmbIyFEMoiotvcqDDOON03nXOSNfK/ClXyp1+/qr18/CoLoOyaPqDpKVJFH9xTuu/AZgqzY9V6ZwqflCwSVt9P6NQLdcKto2b8u2eIekkJEHU3mhrQ7KLXD4kfzZWoQel7x4Rd59IQFBK8+1tvI4AdchGWU4zup9QJhRvdPv/a6ic15/a4RrafbN1BCW55i1+ruY+YlsgDYNjHMz03OHlMjGhaZjJxKijxTjmYHnIkltFmeaM4aQJHR8ThsXdNo+sKk0pQQ+Qc2AhMwcokSbv6v3Fcz1LoiBNuhULvlSRxEoGT6mNdk4XsSPySUsHHh2oTwefo5nxSoUpjXOj5goDCqXHtFOEOY99cUwvMAvgo0XO8xDp2xmia8MWBSKrkGmJMzuIvow70yAmb6BHn1PRNqZlVxkQRACC9AdHXODGUpBPBDN4yiGamGya+8ujDRJYzXmmi3BK82SmLsM6BUPpSmJJkMNMEXaGjSYttStNCIRc4M9ww6Mw3FVo0Ar5oRq5oCDQWzr3ToW3mYzag5m8YruM9jhGWbkvqriChUkMR0aBBQtFVpccc0s7KIwM15eYT2DBlhr9rYHDs+ruJee5K0sBVs39BX/hwX96nWbvvPXoc9VuECA/m0oeXw4/LFCjIl3aOuMOlqL70vSmkHwq9pQJtVnoqwfV5MWHHD6lkfeSW4D2N+KbKWiGRF+XmthoFMYEeZEWRnTj6fbYWaS2a8AcNeqNbu4i33p7Qx+t+oLXC1tQjxj//QGK+OmbxeXq7qhatCR2Qfjmzkz6+fen83H6GOzEcw58CJaTCSyVDMVP1eIEeO2NNRyHaLEWA85kz8iEsqkBSUN9HWCMxs2Pg5z+vrZILxyJTCBjtQDheDtXcS7JEwolm2miYR4M4mcb2pczPcPlwxefeWJl5KVO0kGOm3jViveLBJ+fUF62OqBZSMwOtSB1zS8v0HgH2VVsUmIxbpIrOUVejIIiRhRxav2zZTVw0Hr02NiG4gZNl1jm7qP9CXmldb6fHhu9oqShjFy79TLQsSmC2KipzGtyEDbPvv/zkar25lHZyNSWbk4wpz6P6ZyTSUbIfDfqoDBBmvaJ9tRrabnSdTG7+V+5wKs0VUfEZOPESpOql8qajFmFc51n2VVsfqpupd5LirINsiL3jdaPushY6ohEw6w3BSgfCFvu67GRewbNBvtXKqn1dSYHgriVAKX1PQMrm4+TG9RFnfNJngibYJkOzxpdUVy3W5hPSUnQbJm0G1cO149UExttB1LJ1p4qAtW7afHFNw817QUgaRZsXqrFHaZylRjP3KJkLhYswVWQTmQS5xlNyxp/OvZ7z6boK72VbOA2MHT19GsF2laFe3TpmzDSHydbG1yAgsiUAFYL6IROKM/sBXYqKJXA7VuVprGGcIFlo5+2Fq659Sxej1LXRpDQdqAAHlskiBOdwzCW3bHGsxjZojS2GLADoeITFJo6nWuB25Dv81irJSbG7yXrlXYkmd69tuXXlRLrVaPn7IP1CItUtSBW5dyx817WY2ChReHxpKEspzIKGWUaMezfHtpTTXRN0yqo7RxRinwuGbu6XrMxlrEtLLIyguz1foeV2aV4Ds6EhqNjA9jkmPcWEO/hjntGnPPXujZSrcHFI0IFJgGWruFeZ9dcenSNO+YJpYAjWE3myRnVYFq163/dBKb10fHIcwzsc59hbrgCB9Z6r9AV+ReQH4emd4Z654xN2SCDzZFM7EI4jwTlRaRB//1kh1L0nuBccw34ZX9KhoW2FAcF7wv4fVfhsuhv/jLP9JDuJfifSJxZ/0pKq3Z/Ep7WZeKyNDxgFCDK/eLpKrIHW3AFWRzxLKMBTP+1+OllOvUhe2VSyEe12xM5uCnqqbXmt7944BYHvwwHOOspmJF5TvF9sHLL0jI4p1pEXYhSn1JrCqxGgsJi9wCgJTszWI5RlEbVk2krrdmV+hSB0O5mI8HqgvgkS0KuyZWtm6SIB54vrc0E6cEwqmhx26qt1lqgmRiuKg9o1uo6gAKJImLTQPgDXvwcpagJgTVsNaboNdy1nqGQEuG6gTQb8DFi8hcfdH8KMwGNS7ZuonD9OCyMbR8wS34BUv7JMXUHfqQtVZfk36+C/O0eIVgBzyqPWBqYM0EJyaAlhSFugTIF/KPKVaeVlGQY+Z7OgXiG9FlQmIEmiTkWtQLvihKLP3+kQLY+VPYJq0+mXEvwM9RbhWsojF2Aaw0EOk2o0/L5Yj3IPa5huRIyhT9yGgW1oK455Z8jPgp1uJUHK3NaKVAjXG2K0bHOnkBx397WWDpoi3F7ia5K8O5d7LI6j4nxVp4InHVTyb68tA1FogiS0/gxHwexEkjSCUrEvvh/kyhf8t4437z3Dp3SgBUwAMu8wpH4IYtiAYL27Iho20gCnV3Dof6uBAbrQGS3mpP51ipKhBwqhLZ52l1bEZwMNlIMsfsgse1NVO8pospWu77Syxce8LTbf7KkBwLT4/NL1vjxZeXXbvS0Yjdk5eCn76kxgfH7GJzxto7COM2YaENeumXCma9GtiLgo9Cdj7SHDiMBYTRv1XEdcWfPDCq6Xh7A3sCBH+yXhuhwg9yjCRVgFQO3mHGYiRmaIEQlMGN20hQol36iXCATJruA44P8yYIulBmoC3DgwRmX9OJTrNGPnSzmFqQ8LBVzqi/7BLz8Oa5Cun6yZL5GYWNFok3vVmHBtdRYd6O4Jz83m2//YtUHNb1wwzlKV2rt8QoHDcgnu89Ic8jKQ2odtJ6kpUtgpLtQcdJvlTdzAA8eWe14ytRU4bMJZCTOM/2qXl6UGg35wCOCfBZKjHvIlPSGtrsVmBXpPyEU9O9kCdO4lLA4JYLeBhYl69di4MWUQegVWBEnrFdxVzE15CSICEjA0W5a33aGcFkkABzHL/zS+w/MqgHNLRl8v5JKax9hMP8Wx6AV8lA9ixRXivpWWOLUdwcfBhJLSeHQntD60OawdOfxT51nyKK5LmDfJIzjcanlIJ6jrM1wQcxgqRZzPVdpxQXwAXFzpyCPI0a3JgqefGiZGnabce5x+pnO4cza+zPhI8nyJIPuU3k3NLX0xIu09Qe3lCHs0LsTDrA6+XW71z6WbFxFObFhad6suCbucJb2S2VI/cy530K6SeKKdlRZdPpLXHcuAjaV3qhjIQBzEc8QQ/y7/Q3m9wdGhLp+knYaPb5eohnJb0yJFkvgiwnzf4hZg7D1ohq679UKj+JDFjxLeIqJJGjWOISpwVaNNcwxCFfGQZ8flQKM/3XeFaMfHQVx7suO3GW1QsqTpthPHCSAhvKNOlxrsYo9YBQ/ZeIOYTsy23mzw4gSeMCCo5GH2vXvSM2NAQI62JLs/0Sk974l+tIG04Qn0Cce/kLjV4t6RTDtc95mhRddW2Oz74zuHe2pzSum0CuGON11G7Wsam4XebufWxDXx/eBR00iQ0AZRDzFPtD6fpOdwar0hGX1r7iPKCc6H3gTKzeOqnxqoJqdIpiTT6jotNcInrc0+dGkXTULXsPojz4nU+ViwZeemAkcW1yl5CKORfR3JogRG+o/KWy3gWcqcTm7NEWhRBWllyT4ekVEQ+hnDBsv0kI/F4rjjvURRbxT4lDtj5UMjmgMG/EosC829Bhh8zKz8IupI2JM3LAqqLBf/A/niGgVB7OAY6pWIh4CQijhVmlNDnngK/qzIPkUZ2S1KENv/gZnJkb683ncGvBigTvmSAkqa8H6gqE/Is1BVmVlCHOGCYlY37JksBaZ256sksNk/hRoOM5wtiT7vjCF4dyejy8CXIqukYeh6cCPqdiZ65uJjjWTP8HDx79cCcc/4X5hSYV2KPD9WvZskQNTZqA1Hvv/k+++qv5/4B4bZCyG7TRfomVCWLdUZPxBa8e6c1OOaYcSZSRawsVEc+UI6EtgXzjXkQCZQNg9CRQ++8kafpQ7kQJRfZQWYuaQFsJJcIu2UYgrEiDFc+uago8K/WdOknbWfy872OenhQfK9//hrM6NXFhNPKEyv0zTnKny4zXs5LuNO/CbgWFwvfnbduiV247r0m+DvYC8W/WXwxUSWj7qQdXNQ37N95RPyMfiZANEm7EoPZxS12qqhUzXBgg5skRo0sb6gkPOxEmtE1SpBxLyMquWL9G0du59vI0XBF6MpiUSyhO5E14sOcnQnIjCFZo4matDj43HvgYxkymrTsRfQjOMCg9jsd92q58KAtMM9IBYU86H2z6c8SOpvY9q+kkHRhlbscTh/kRTY+d6QCiIdZXitCy974dB3KOOvz9KEYapEi26mt5PbM8ebW0YbiM909xnDO1tYPjclwoDcMK27CMXrmvy06B6QrAsd4YwmS0jJO9F7jofLueDr5O5jhU2kXxJxFqTgWPsZ1TPDTBLm1zKYsob8TV9vKN9ZHUcxavO42raSmnH00N1oNTjWeq+DX4IQ6WRjkoH0aFZVnNYlEPWUYYwJgHIOhNNckHIdHj4OWZ8Vd1nW55rEueId1aWYF6u7QIH5DKcszQPBv2T9VVG0IQEABeJCoyo/b03QbWtLBTY+/Fjo3iSFtQt/TSlNWTeT9WcO+67o0Az2kOJIsGhJCmwuTT5XSST2130TLltHm+NO2I89Sz2XS1/f81IFGhlqXuOj5+hcvklLEhaesfMMRcF5Fr5Tq/KRtT9SHfd9QA3NsEOiB/jhXzW7RzkJ+2VwXyIuBE+l4GDDjjbb9/Tk3o3Fky1MW3hhbRQXK9t2/nObt5VGTXC3LJYk9smOb6JTZky8Uk1teUVKFubJuTrzqV6bAepKtQe+YwVBo5Al05vu7xe49vE8dfvTPViqCPFnAeaVCYVRAuLfE3CoRIp/xqyXQgMw+N2hRFTkbhT36v3quVXA+zS1gNfOrQnXKdf8zHE+k8CGFoutVY83q8yi7ADabuzY7iC1INpB/+8RcAdx/V5+jPCEY1fnio7114MP02ol0f09d8Kt4Nz7PFoYrZ5zLElNjgDqkDouFSVVLzS3OmVDwFOZx7A3G/7sMpEwed5uQyylTuzC/LcTmQAjAVLslNNBpaeRgF73b5KCBZJg+pV4tHjofxFzxgTffgGLw6F8Qfq3f4GQNsaIf3P6FdaanPkQbrDAR8DyZHTsrDkYxQtVENXRjWgSR9QJLffTNw0ySNEegCflr/i8OWDsDcmJH+l+XNLbf3vzetxP6gm759YrwIIcDFw8Z7HIhn9vsMCiOQr1AhZN7QiDAQd8MA1TgdRY94L3BoAGLDOOCiOwQAMDLWoWwzQ5arb5SFVUaUPTTGbg7BjgF0QHPPl7cHiHu8wwliwXJYNCAtzj+SZ7T83aWQvF9Fn8zN0UHFCTZHAH9DQ9vQgkNxROgOg5UkEbRLGppIE2icHQZlhxv0NciRfxgkHET7QWliwXKs8k8G9zCoOAxIjgAch8HHsarRhZMRHkfoy85hwXM8rkGQl0fzGDsQPUQHQg8dAjqLvWMCvdvD8aviL+kCgKn0nmyO49FkK0ZJ5WB5mYpe203f7fcjo3Ayk7S8mF284sf6FMGTo+a0PCRGkb4TIJcynMkcUpFgkulJBLDCmNawhmtxJhUl0j+Zu6eu5NQjjp5jZbpCXleykqUsZA7Zz1tNJkIIo0oLlRPhh4ClOiD7eQ6FMmIhiiTNy0qcEPTIPDdLwFvTOc3Ics7azwO06Xx/ZylHpNN5a2VEJMR/Q0t1Iy2cpU9h0Iki5dJMEZ3i54ddopXyDZn3M3bmCruse3CGWV/vnjS4uvwl6rNBFNe1eqPZ6vay8fQ4bT8+v76DNdWjPRkPKQ6CEFa5h3uej3U1Vc1x/hi/CTCgzUJF79WMnP5DOQRAYY4YrV9ERTmT+7OGu6aGRSWAKnM4/sQnO3hWvF6A2IHdWiKOsVOhh+GN+OEqjGUUtIxn62ZVxpfCruQTOwW6Tyuo1R43CqpoV0A6k2INA220rOLX8WldO5VTOoWT2yz4JmupWkVb7b/mEqJWMVTpPhfigJeDEABiQQgSLUp6Wbyu4kdHRvFszceD3GzsStDqqSSgojvsR8+K6l/7td2LplqecSXMVQo1/DHImWyjo/Ga4cmVbtUUVe2HFy4coj8U1+NeT/7l1jOlDeLKCWK+EQiW+rtUOXRn2fWrodpbHa11dUZqPhMtqRwKvu7uC9EfKocqzfKiIqEZ7jT3tlUJVbrlgqu4ITqKD/p2UyVUKi0Ow5QAtMX6SnGijtTx85ovK8OPZCib1HtWtdWlxGnG9yGVF6JFVUMP94pcVFgT1XSnq27dNJj8JVjtq5obU/dFMM9WVTmc70+pFmrvJmgSKGiK0pKbHzI1dPBci2z9s4uVbUgZobHi0Oe6HTYieShQ+ernP4SilhL6JSEVKAKsMpCKJhHLSiUnFSIQBX0DbBNQDPoZ2Beg34EhaCasnqCNiDUV9FFhTxDtA+tH6E90MKxQYKjAMIERAqMERguMFRgnMF5gksBkgSkCUwWmC8wQmCUwW2COwAKBhQKLBYoEfV+wDwU8gWUCKwVWC6wRWCewXmCDwCaBLQJbBXYKHBA4KHBY4IjAMYHjgn4t2HeC/ifYOYHzAhcFLgtcEbgqaC0HS+VBdZb/DgyNTcwtraxtZmers4cFBYIegj6CwgCMCsCYADpO2IQATArAZMFUoUuEvSd0hbB9gtOCEsEZwaeCzwRfCP1P2FnBOcFFwSXBFcE1wXXBLaG+MFy0jLGyLpplLOaiZmyci+42VmzYa/SksRKjmYnV3dBXNqyoLHpwYIcHnBxw9UJvXZjVgKELhtWA4QtG1ICRC0bVgNELxtSAKTXQ7QvbtdA9C6MWOuPF5r9QVAu9/WIJYbRMsKphtGawe4JmBWsSNDvYY0GfDvZ64M3A24GcMHQMmh9saxi2BbaHYUdgdxiOBD0e7IvAl4GvAl8H/gj8Gfgr8Hfgn8DVwLXA9cCNKIu70rgvjfvTqPcSS5P5rxr+wuY7yNP/KNJlZlQsXevQJrQNHSK7RHULeSE/FIQeoXcYkq4wHUuXP0X9Hf4N54N+SLtOZh+i8yZWu2lms3pN85r1bwxsDG4M8eioZuMbExtTPEzzMMujS5sth/aworHSw6rGag9rPaxrrPewobHRo7ub7WscaBz0cKhx2MNRD5c8KPigez52dkvz0WY+hit6t8XWuqIfu2KWLLo+WayoquieqmKaR3PyGH+Kpv0pRvRsbfsTcoEBgJ0B+AG4DFwFbgMikCVQX6CxQDPwGOFJQl+CDwwgDBHoCXhRYLjASIGXBMYIvCLwqsAEgW8FXhd4UzBNIOZAG4FODnQUmCuQ70APgd4OLBH4QMAcWCow3IFVAmMcWCswzoHxDmwU2CwwzYFtArsEDn02R5sTvvG9/5sLLplpj2sZdnKRZB1H/Z9vl04LwTyB9j08IGACY2MWzuOjAs/6HoHsrn5/TwV9FVwIwMoArArAmgCcCMDJABR+SrBOsFewX3Bc5HPrbXVIsS/932+3sa5rk6vOu2Ggwfmc//wcFyKGZw25hqGG8YY9htOGfYZThjOGrGA4ITcIo4JABtwZwd0ZkJEBZyvApQpQz4UGLrQyRF144NMT2uSTD2dJWdfd4qfUMlOuJfwkLF5ZlaS6W0Rj6mHPe9HLXhXTwVrrFET3tdRue3S9lTijj77tD92PBhjoV/30N8jgPBrY74IW/CfomTIKyhSmwYg0KLkD/rwDkYsJ76TLDV0eGPyNwQ90DF3D84LuDzwneEHQM/QJ2Q7UwdDg5/BP+C9cCNGJbhNDJ8yfUCddPMjyoL4H+R4MeAQGedB/IhR6MNqDCR60c2CqB9M9mO3BMg/aC7zlQK4DXQU6CyxyYLQDCx148QnY5MEeD/Z7MMODYQ5MqglHPDjmwWUPiirA/xUg6sMbo3BPCM+6wheucMMVipOF88lCcVXh+6pCLA+FeaT2n8KDvwrR4vtDZVMf7xP95f69JUnCud4PHKAivzK4QItP6+1vgyq+Xx6YSwOts293IvdJl6WZ5rKpN70dOcnAMQZbwrOi3aywxQ57ckjgcLROg5/QnA0b242L3UnxGPsdai90FzOxMqna5KZUVN+nViTcdm66xSfnED+i2yvNtYx8s9XEO39f03bXdrsV7Nza6XNw9qDvD0Ykw8U/z57wxom+eWJuGbR8YRXLQLNCWxY2sqCk0E8K+7LQrwp7YqDPDuzGgFgFtOOFURHyJsyf6IKJ/T3RfyfWsNFGjX3S6GeNfdHoV41RFU36hT10ow/fWK0UNPxgRSnohw+2NAVL0lVf2BtFGnuym0/qP1nzhWYvbEgNWrhgxQt6eME+XqBsqt6NRYY+OOzhoc8Pe9HpO8MGDx0ybOLQScMS6pChN3XvW973Vh3X7L3WwVUeWtVva/6/1vBNztnUF5v8elM3t7y11bXIm1G3I/2ogv/IlJk/KvKTz8Z6oY9EZGBXCRFZblcVIzK8q8iu5a4owo3d7V/q/7JSEy0zsZ4TQz7E+UmvTNbroH0PdupATx/Y1YNeP9jNA5knzTpZzjLsPenJk3130u9P9tZymnOx7y70+ws7e9FzF/v7g1Z/MvtPlb0tq90qcssXbvXSiMy9VZubjjedb9nlVp9CfDTgY0EfTRrFkn20jI+l+Gh1Hwv7aKqPNR9FW/pYtg9v+vC2Dzk+2s7HEFFHxBYHhJKAkJ/Cq74QThTZieS5GfrawQqTxNkkejmJNTXRbGJzQ6ILQmKrSgsvt4q+XoLSHh19esd2THTnxHaXFd07MS1HH9yzXtLesoNEjxA7Sfia8C3R74k1OW15tuzCk9FnY29E34y9HQ4l7L3o5xeLPtAHLyxWmXZ9yFo0bdWhF2teEB5aIvrILfZTNSE7RfSRR2xeiuiCFLFFKaLvpohF20QfXmIFy0W792JXaolerSXmh4WCNbTXiuUxze/MLnVG44k2t409ZDE7T+i8PGE/5WPxTmH0V6LjvxJ750/RnGL4dcNeruI+BZt4CQzfLZHojqFupPraIVb8V7oP42BJCAviYHYI/+/ZhehHjQQFEKL/NAoFBCG6tonKJxI5mMjuRLYkrE1kWRItacKcjMcfGIc0q1e/QcNGjZs0Lf8U398fCGVcSKWNdb7tegzDOM2L/pv8Lr/Pa+d77E+EKIN1i5MLb88c9WU+0vOPZTRFvySeROgbAQ==","base64"));
-var e,n,t,r,o,i,a,u,s,c,l,f,p,d,m,y,h,w,A,g,_,E,b,I,S,R,W,v,T,U,L,M,P,F,O,H,x;let k;try{k=require("path")}catch(e){}function B(e){throw new Error("wasm abort"+(e?": "+(e.stack||e):""))}"undefined"!=typeof module&&(e=module,module=void 0),(n={preRun:[],postRun:[],print:console.log.bind(console),printErr:console.error.bind(console),instantiateWasm(e,n){let t=new WebAssembly.Instance(new WebAssembly.Module(G(v)),e);return n(t),t.exports},wasmBinary:WASM_DATA}).ready=new Promise(e=>{n.onRuntimeInitialized=(()=>{let n=exports;"function"==typeof define&&define("markdown-node",n),e(n)})}),k&&(n.locateFile=function(e){return k.join(__dirname,e)}),n.print;let N=n.printErr;for(r in t={},n=void 0!==n?n:{})n.hasOwnProperty(r)&&(t[r]=n[r]);for(r in o=[],"",i=__dirname+"/",a=function(e,n){return s||(s=require("fs")),c||(c=require("path")),e=c.normalize(e),s.readFileSync(e,n?null:"utf8")},u=function(e){var n=a(e,!0);return n.buffer||(n=new Uint8Array(n)),n.buffer,n},process.argv.length>1&&process.argv[1].replace(/\\/g,"/"),o=process.argv.slice(2),"undefined"!=typeof module&&(module.exports=n),n.inspect=function(){return"[Emscripten Module object]"},t)t.hasOwnProperty(r)&&(n[r]=t[r]);function C(e){f.delete(g.get(e)),l.push(e)}function D(e,n){return function(e,n){var t,r,o,i;if(!f)for(f=new WeakMap,t=0;t<g.length;t++)(r=g.get(t))&&f.set(r,t);if(f.has(e))return f.get(e);o=function(){if(l.length)return l.pop();try{g.grow(1)}catch(e){if(!(e instanceof RangeError))throw e;throw"Unable to grow wasm table. Set ALLOW_TABLE_GROWTH."}return g.length-1}();try{g.set(o,e)}catch(t){if(!(t instanceof TypeError))throw t;i=function(e,n){var t,r,o,i,a,u,s,c,l;if("function"==typeof WebAssembly.Function){for(t={i:"i32",j:"i64",f:"f32",d:"f64"},r={parameters:[],results:"v"==n[0]?[]:[t[n[0]]]},o=1;o<n.length;++o)r.parameters.push(t[n[o]]);return new WebAssembly.Function(r,e)}for(i=[1,0,1,96],a=n.slice(0,1),u=n.slice(1),s={i:127,j:126,f:125,d:124},i.push(u.length),o=0;o<u.length;++o)i.push(s[u[o]]);return"v"==a?i.push(0):i=i.concat([1,s[a]]),i[1]=i.length-2,c=new Uint8Array([0,97,115,109,1,0,0,0].concat(i,[2,7,1,1,101,1,102,0,0,7,5,1,1,102,0,0])),l=new WebAssembly.Module(c),new WebAssembly.Instance(l,{e:{f:e}}).exports.f}(e,n),g.set(o,i)}return f.set(e,o),o}(e,n)}function K(e){y=e,n.HEAP8=new Int8Array(e),n.HEAP16=new Int16Array(e),n.HEAP32=w=new Int32Array(e),n.HEAPU8=h=new Uint8Array(e),n.HEAPU16=new Uint16Array(e),n.HEAPU32=A=new Uint32Array(e),n.HEAPF32=new Float32Array(e),n.HEAPF64=new Float64Array(e)}function j(e){return e.startsWith(W)}function G(e){try{if(e==v&&p)return new Uint8Array(p);if(u)return u(e);throw"both async and sync fetching of the wasm failed"}catch(e){B(e)}}function q(e){for(var t,r;e.length>0;)"function"!=typeof(t=e.shift())?"number"==typeof(r=t.func)?void 0===t.arg?g.get(r)():g.get(r)(t.arg):r(void 0===t.arg?null:t.arg):t(n)}function V(e){try{return d.grow(e-y.byteLength+65535>>>16),K(d.buffer),1}catch(e){}}function z(e){function t(){H||(H=!0,n.calledRun=!0,m||(q(E),n.onRuntimeInitialized&&n.onRuntimeInitialized(),function(){if(n.postRun)for("function"==typeof n.postRun&&(n.postRun=[n.postRun]);n.postRun.length;)e=n.postRun.shift(),b.unshift(e);var e;q(b)}()))}e=e||o,I>0||(function(){if(n.preRun)for("function"==typeof n.preRun&&(n.preRun=[n.preRun]);n.preRun.length;)e=n.preRun.shift(),_.unshift(e);var e;q(_)}(),I>0||(n.setStatus?(n.setStatus("Running..."),setTimeout(function(){setTimeout(function(){n.setStatus("")},1),t()},1)):t()))}if(t=null,n.arguments&&(o=n.arguments),n.thisProgram&&n.thisProgram,n.quit&&n.quit,l=[],n.wasmBinary&&(p=n.wasmBinary),n.noExitRuntime||!0,"object"!=typeof WebAssembly&&B("no native wasm support detected"),m=!1,n.INITIAL_MEMORY,_=[],E=[],b=[],0,I=0,S=null,R=null,n.preloadedImages={},n.preloadedAudios={},W="data:application/octet-stream;base64,",j(v="markdown-node.wasm")||(x=v,v=n.locateFile?n.locateFile(x,i):i+x),T={a:function(e){var n,t,r,o,i=h.length;if((e>>>=0)>2147483648)return!1;for(n=1;n<=4;n*=2)if(t=i*(1+.2/n),t=Math.min(t,e+100663296),V(Math.min(2147483648,((r=Math.max(e,t))%(o=65536)>0&&(r+=o-r%o),r))))return!0;return!1}},function(){var e={a:T};function t(e,t){var r,o=e.exports;n.asm=o,K((d=n.asm.b).buffer),g=n.asm.i,r=n.asm.c,E.unshift(r),function(e){if(I--,n.monitorRunDependencies&&n.monitorRunDependencies(I),0==I&&(null!==S&&(clearInterval(S),S=null),R)){var t=R;R=null,t()}}()}function r(e){t(e.instance)}function o(n){return Promise.resolve().then(function(){return G(v)}).then(function(n){return WebAssembly.instantiate(n,e)}).then(n,function(e){N("failed to asynchronously prepare wasm: "+e),B(e)})}if(I++,n.monitorRunDependencies&&n.monitorRunDependencies(I),n.instantiateWasm)try{return n.instantiateWasm(e,t)}catch(e){return N("Module.instantiateWasm callback failed with error: "+e),!1}p||"function"!=typeof WebAssembly.instantiateStreaming||j(v)||v.startsWith("file://")||"function"!=typeof fetch?o(r):fetch(v,{credentials:"same-origin"}).then(function(n){return WebAssembly.instantiateStreaming(n,e).then(r,function(e){return N("wasm streaming compile failed: "+e),N("falling back to ArrayBuffer instantiation"),o(r)})})}(),n.___wasm_call_ctors=function(){return(n.___wasm_call_ctors=n.asm.c).apply(null,arguments)},U=n._wrealloc=function(){return(U=n._wrealloc=n.asm.d).apply(null,arguments)},L=n._wfree=function(){return(L=n._wfree=n.asm.e).apply(null,arguments)},M=n._WErrGetCode=function(){return(M=n._WErrGetCode=n.asm.f).apply(null,arguments)},P=n._WErrGetMsg=function(){return(P=n._WErrGetMsg=n.asm.g).apply(null,arguments)},F=n._WErrClear=function(){return(F=n._WErrClear=n.asm.h).apply(null,arguments)},O=n._parseUTF8=function(){return(O=n._parseUTF8=n.asm.j).apply(null,arguments)},n.addFunction=D,n.removeFunction=C,R=function e(){H||z(),H||(R=e)},n.run=z,n.preInit)for("function"==typeof n.preInit&&(n.preInit=[n.preInit]);n.preInit.length>0;)n.preInit.pop()();z(),n.inspect=(()=>"[asm]"),void 0!==e&&(module=e,e=void 0),Object.defineProperty(exports,"__esModule",{value:!0});class WError extends Error{constructor(e,n,t,r){super(n,t||"wasm",r||0),this.name="WError",this.code=e}}function X(e,n){const t=U(0,n);return h.set(e,t),t}let $=0;n.postRun.push(()=>{$=U(0,4)});const J="undefined"!=typeof TextEncoder?(()=>{const e=new TextEncoder("utf-8"),n=new TextDecoder("utf-8");return{encode:n=>e.encode(n),decode:e=>n.decode(e)}})():"undefined"!=typeof Buffer?{encode:e=>new Uint8Array(Buffer.from(e,"utf-8")),decode:e=>Buffer.from(e.buffer,e.byteOffset,e.byteLength).toString("utf8")}:{encode:e=>{let n=[];for(let t=0,r=e.length;t!=r;++t)n[t]=255&e.charCodeAt(t);return new Uint8Array(n)},decode:e=>String(e)},Y=n.ready,Q={COLLAPSE_WHITESPACE:1,PERMISSIVE_ATX_HEADERS:2,PERMISSIVE_URL_AUTO_LINKS:4,PERMISSIVE_EMAIL_AUTO_LINKS:8,NO_INDENTED_CODE_BLOCKS:16,NO_HTML_BLOCKS:32,NO_HTML_SPANS:64,TABLES:256,STRIKETHROUGH:512,PERMISSIVE_WWW_AUTOLINKS:1024,TASK_LISTS:2048,LATEX_MATH_SPANS:4096,WIKI_LINKS:8192,UNDERLINE:16384,DEFAULT:2823,NO_HTML:96},Z=1,ee=2,ne=4;function te(e){return"string"==typeof e?J.encode(e):e instanceof Uint8Array?e:new Uint8Array(e)}exports.ready=Y,exports.ParseFlags=Q,exports.parse=function(e,n){let t=void 0===(n=n||{}).parseFlags?Q.DEFAULT:n.parseFlags,r=n.allowJSURIs?ne:0;switch(n.format){case"xhtml":r|=Z|ee;break;case"html":case void 0:case null:case"":r|=Z;break;default:throw new Error(`invalid format "${n.format}"`)}let o=n.onCodeBlock?(i=n.onCodeBlock,D(function(e,n,t,r,o){try{const a=n>0?J.decode(h.subarray(e,e+n)):"",u=h.subarray(t,t+r);let s=void 0;u.toString=(()=>s||(s=J.decode(u)));let c=null;if(null===(c=i(a,u))||void 0===c)return-1;let l=te(c);if(l.length>0){const e=X(l,l.length);A[o>>2]=e}return l.length}catch(e){return console.error(`error in markdown onCodeBlock callback: ${e.stack||e}`),-1}},"iiiiii")):0;var i;let a=te(e),u=function(e){let n=e($),t=w[$>>2];if(0==t)return null;let r=h.subarray(t,t+n);return r.heapAddr=t,r}(e=>(function(e,n){const t=function(e){return e instanceof Uint8Array?e:new Uint8Array(e)}(e),r=t.length,o=X(t,r),i=n(o,r);return function(e){L(e)}(o),i})(a,(n,i)=>O(n,i,t,r,e,o)));return n.onCodeBlock&&C(o),function(){let e=function(){let e=M();if(0!=e){let n=P(),t=0!=n?UTF8ArrayToString(h,n):"";return F(),new WError(e,t)}}();if(e)throw e}(),n.bytes||n.asMemoryView?u:J.decode(u)};})(typeof exports!='undefined'?exports:this["markdown-node"]={})
+const WASM_DATA = require("zlib").brotliDecompressSync(Buffer.from("W+vxUcPYpnLFoNsACMwk354nZyNsd6tCSBxkUIsO1LBxAEA+NJj4/z8mN8bAH9SqGjKy3APOIUqeaBTXXBjYHfjkrJJ1YUtYBeOHsC/U1EgHGylzB4dUNin/xq5GcpLpYFCiY0marNKT5KLOQK9taKEosZ2iA8vcXMGCFRxov+KFag06Vekr/Ljimg/UdrCwI0Gx6fCNhIz0vV+KBEd+nu/7+6sAx8mHSIgbXTz/f1rOv/e9N7OzybzNtM1vly5y38Vsv4UefpDHFzP661MjQSxkJoJ4CvkQqkHEU1isosHTn1BS81Q8n4V/a++XanX/P+Fqdx0yOlKVAQ35XUfkMuEzyNyIGhBg6N/+1fLyvdZMy90c9djEggAJo3qgD9IgMfwQtIJWHzwDhThyCLGfw+Ygh7yb5RBygKg0UxLkvTsLAsdd/NT1QLIt/RkVj1wkD/cm+SLSE2QuB5nTzJGz1P5/c//v3udMMhfoE8+89YWEAt0UJi83BeG6/GkKkzeNeujqRBWgUaRRV/jyAFz+3q0/KNAwawPQH3uCRG2F0jPpnf33pZLU3bYcJzPn3gVUssC/wO5F+EWaWeTMAhK954dO60F+mAFNlvCyGV9X5Krb7tKvUiwzPIBe9e9AZcBkRQTeJCMs3F33O/Uu+9+AgSAirW+/ojIjIqGqfv+GgQXqHiPP4Syg0XNq4fk7R+AIlCcAhbENPGFEm6jre/sBrVYPNCPZibNnJ013HULTE/RXtN0H/P97U7Ptfe+/XwWxU7EUndnyJE2I6znnV6HAbttqd5wYNgv+e++rx3rv/Sri/1+A8KsKaKIAcoggmQAk2STVUwWQ7AJIu0FKtqFw5lDtnjlqR01MorPaKW9n8mbjuJt09pNXK82s2BPSambn3WL+T6fVakYGLUK5ByVwL0sjL0J1xx23u9JX5tnSJPscLRGIvLLshJVDqACwKa+rsGiubELOElfFHfPwdtN7W7995TiMMGm7rQXZbUFAiYcxpxyIRiC/n9qmHblKm52McF/5ITlLmPFTarb29lUYBc3xzAhNO3t/7XKowt6xFRFphO6dZZjanKZJ1ndXG/MISQghcExvEZ02jAI7Hd0gcXzkL8uSEhtjtlfLFRnfkxzI88zGMncQhAh0TlFdHS7v/9DgxvF3IwLwqXLNTeVFFOHFWGfQsi1Wi/BgTMNwolAKaN0/G27ipQU1xl0BXpOK9wIIHTd+XxJpfwLf7KX6jqC6GOtb3TPp6lvd/QYap8I3+Pdtt0z49z33ToajadFrWRP1B07/1/M4cPp62SICdwSAR2zTgseGAPdM5/n/kWwNOeC4CgIAFGHBtGEgh2EcI2IY8DStEJBsw8ShzEXEIBkGPGHNhUayzHOZ8XZdNnaklINsGQ8v7VgZcJ/NdRgGM1NtjUPESDO5MyzEUZETXp6IepA9No1Lj7Gsj9eHqXA7hZfxQZbdjLq3ZZVwctV+tzd4WTRLC+WSVrbm1NrycVolD1l9mI3ERzsOWHuinPzyVX3WH1GmR6b12HjYJ9DDCXtsPg77witK9dl6tKQHFfbZfjLTL5f2BDtPiKeto2sVM3R3nx6bONnegzzPXlsd72T/WZBf+aqP/LgJaAK5+vAI46f07fojethdH+PB/FljGQPzKanTwzufoztYD9yMTmbWvhfSYda5e6+tmCXcWHxM4QoH96vvhbI1q/MXvdoovjJ/MzbGCoUJLj40bpV/OMZsnSva/MthRo+v+3HzH4ceY+jGoxYld+/df/zkef/6zdt3F6D/cf4QQuFINBZPJFNpUWpobGpua+/o7BoeUbQ/8Hkc/79Q1/K1pIAIi60ToR1XVviLou17nryXgTX7hHV+dzFEFtn1ANC5aEC3eXG5C2pQMHAGK9Dfql5HbOn56bGezsahX6yCoT7lkdr/qptrdbWb0ozRZ+aYDTYvz/FrLNKnnso5GoL5ltI2LjKOVLXoqxrRVbWio2b6RA6WsKg4UBGSWoA4XOFUsPLD87uypkEBCCrPiOlPtD5NESUS1G8qgUvexhY4OiWVEYYu9I9LuHroVW/PTZz8/Fx1jkb+vo9x3QZX7flMLJWWQ+QLuvjgpqqZVdIzED5IavWdDqoyGrXHQlFoRZ+ZZGBNpN+rSwPyilVjCQ0teZ/VQWUZK5h0KR2thEyt8d2qY6xcSQNWpgSttBG4ZJUDFM7llu6HGrnAD79z9cKBr2sAYauZPjazBaYUa5EkpdQTFM3H+D4lZErJJDfk5Qqn8yiReNKl4UrsbHNQKFjxL1FvHI0JQXZhzFggqmmSOlwEmYvH+6zjWFEBOkFYZ4AnPERTZn9qyM9du6tGAUk5ciGKi/FJVwuz60oEf+HLhdxH7e9yDLD09YqQpclH5ZsYqHnMsuuBbKfWNBHMPPg6TpA/2TL+gA70unjJALGrEtrgUXlWziERq9P+gFvt29GHDquXENeTMYipsjwIn3NgRWtl/tFVhimPpapKjYQwePqBqHZKBFfwEpMWERqSUkou6sV/Yakufh/vUtpZQ9YiIknZjUsQNut0U/fLZh55frj4AGbYsFd9ZRIfm9tGtEipcYnHjgm3aBRGCRf/rqXHcXZxAZkr++Ug2xYpg+I89rIiY7fEDWJL6La/1lUpjSmjvukcbVXfHAOO0Qw9CnrVzaC7XBnIThDc2iEBP75s7a5lX/hoYykHNBl6BDbSwUHchWa8mdvlvgYhZaaAQNeqRe4JZ8OYNJMrQW1YN4U822z9s8kERVrn11YZorOpZSzPsopRL1PEbRnFVoRb7O2LVN10O7UcL25JLrlepgrhU6jdjDUXkRKsGP5MgXC1JUV2xlwVIlrvPLKZcTfLNSNdgZrW4q0ymitlx4HxQk8a3k4mVRVZspIGFUU4qpBPzMFFELPZNqcOhyqwaZMbUhfhpEMJ56trTC4t2Pk/R9/fpO3xtJlaLw3d3xtf0+yQgWcKsurFQo5qISjPTDY2Y0xdH9M4J47h5e+fiZAmNGMEKkZQUchsozQiXWoyKchouY50hVQUoKxlRANUEfxXTCA0hmJqNZRGFlOHet14QU/TTwhLiY561fiAqlcLDYXIT8kh2vX4NdpSWCwG/K8kijwmCF+KM9TldWU90t6Ftx7cqwlzr0qR36tJc68WmHu10NyrPtyr2tx7KROUKBL4RAVuxK76U1JQ1rqbtnAlpPJucSPZHwe1hAdW/QAGANAxcv918yGr0/cJcGvZDzUYX7dFlOgwY4RbgNQUNi4/tvAbldyLc1Q59uUa96iw++kaLC3rCbYlDM7ldlYzWqu/Z/1FeecctPw6xDFGVxqo+Eh7XMZC3JrCKcvl5gC9c0GU8qWwjfOyTzrORUNaO17Fb8tTA6attcxhJdfstHXDHRbkwpEhuxYBVg4EvqiR1lVvCgKuHa0Iy9RJ1bt8flO1cVHLeh6spT+9SQNDJDfzhnEgXkhxYAfel7VdZ3cI54AtoIcdx3rTR755oZrUqQ36cu4uFiYAJL3U23IDaO7/nAu/Fyl7eS4uSDAflUYFmMUtKr0DhDSMtSG7W4/GJ03dLTC3E0w+6hLwImBnMnqg0EEinOgnqIujBMXWJgnKowBOpAoEzzB9MTjw361xyjxBDeNcdNj0nTU1r7rQZ4ZLNG16TI8hi1VifRemXGhEtTEYYLLZ1Wrm6Ou/rZP9/Gq/VoaMEIfvFeN8veR1/IYGZEoMffcB/29HsjF+z/GHHtD5DT6NF7xeSRX8+IxXy+xcbQa7JjJTMKj6JZwmtGb90dSXdWbVqHwMhnoB/exQWMdYHi7TEdWDGCIvjqA+5yiV51Vv2tVpzEOnGtm6OzAv7Au25FS33v6q39yQp2qhGLg3922oGjC8xwXmfHuDYT80U8jGGHpqD4ppSJXfpEilROJvWxjUxnjwVl7k4++OCV/QcSEgOxkDs+SyrCw4AXhj1DUNsuSGyHqaQb0QCoRFen1AF0IR+rWu0AoHUgQs2ickklTsdWdKnNs03JIZK466gbJrcmENKtQUEc1WHjbSaKdK6N9YDf8O9L3Y/4cNb3Op7VOZzc31Wc3WIymvjK4+1BDHK0vFp4F2xGDO29SnE33Ze8kYxRjzbZppPao68kaqZx8fF14Z80BY4piWCnavcFzwthXCK3tDgbcQiPtlaHXdB62MLXm2mAU26K72C7ByPt2LQeq+OIKIpZGbl6W6DHX0Nmnl6lAXvDLtKwQrSsZ3tDXmWoK+CkGCsIEb7j0lnFhBvNDMMeR1Y8aGTORz6t0Rr+y1LPS96sm6GwHc7XyKlp0mpaLVUXH7ORPAUrOVOYyj6HevaKITv13qkBRG5sste1e01QXp1iUco+J/YQdjmB7BiumZVENyBEJ4f0JI9kyWo0oSKRJoCsa0mVs4pYmxmW7km4Unp7Dilbb81Ls34cQELh4X/gLJBZUT8C91pwTweQN1CI9wtr2QVsFfnga5w6+1djFow5WT9Ur29XKAzFouPKGRDfjXE49Qv18mdktaEUkSFIzckFKKcE5pRcKO5GGsA4PqQppmHLIJjlt79QXANipJo8p2e2WSueHMqcZ2K0A7d5JVySbjLTTDew5rbGZzM8V1qIULCOM7SA1dzx01PDQuGpK3ZFtUGQcpcy2fmJAWOUpGvOCkJStQw90vKFy2Gr0Iv0YaoK8C40j7VtZ9hDa/mJT+yqZReg/7tzB17yq43LR2KW+0HVArTU5Rou0N6iNKKqnTr5AMFkZc6Qq5gC3DMIH9kDXvPvSsrT5eKgAkksSx1YtlwzeG9Lo0nicUE4VivVGocgvv9WHFXg7YxgffSdTJXyK6pEuF18N9XKgpN63MV+X1qIXfTL4Zfw0r3rwZc6Iin5NdvMCLt5qjd9MDSUwEYNruDHwA+ZVLaqxgkCPVCiQNEhNHFA58CFa8wWp8kGfyD/gz5Gfwu3Dx5s14JjnyZ4y2hbzNWLaQLzPaFok2kLxDfzlpgNE30GFbg6FmHhv7fDV/1ON4E57qwYrHRahdAovHJbsqErh41Nv4sdQYSqIwxkqVNToisrq2h9tCm5cGyAEDsKmudJ+6gj+rNoXUgGbUHrAmncj7GposnKaovJd37EMKSh2PXmIxoVix8u4o3Qj0KOxGHl2S+aPVo4QelTkF6YTq/pHvu+lF2Xn0ghV3BoFsC/cth4sTi7hStp0iKURvnKWh9FnoLzV21q2MPis6ZKmjGZplVStiEQsWe0Hie94Lm3HeG/l5fjv5duFYH1a8kA4XoXUMi/uCVZYcBxnKUYL51OKHGKSO9gvWBDHFLK1wKwjbHk9w/b5hp8Ljpl1WjtyYp8LuWJyVmQJPn8ubtMnacHM6EICLTOFshFB5YMThpaLKtPaiUtkW/nny5/k55HP4deTrjMVRkS/mO8k7jVZv5K18E3kTfhlWHHmSMvxFDEguv9KuWTRUw1IaKNhxxbYTVBHaisrUyN5gbt251newX3f/DpLoo+Ym1SxVT+8sMnZIkGfdqgjkV/NhnYein/m6fLDUHmSbs8lYicFiA7Lvn8aSW2zuJpOzlcFmdtTn5SzFIkix6DK3gS0rcBF7Gsoz23aVE1MqhgbHaOeeC7zWNM/e4GfdBiJI3Wp7f/s+F2PZjEaeIX2vxgN5zLcjEo6vKAY3w0i8TJcP8MrueEpbkG3QDQ8Luh+IYjQL2Uklyyp6i4VGs4b2FkL3bJT0etJCJqy78AZqIYi6xmwwV4+0bOWfslJ1P0Zf/JbGFovf2FqAlQgl4vw5LnavoLufk4MdKuQ6V6rI1iySO+uSgPQPJc7EMDF+EjKJqMcvzju3rIxC4wp1pexgKQswm3QAlXnh4BL1pYx2uSpi/Yo/ZQvjBbj/D7dDPVpfn2i0mq7RKq7RarxeWDVcG/Vn1w0DrBphBIZwmmGiWz4p0GLhSAxQPNUCsfJq5DFZGQDW+UFjLfs6NKONFrRfOm5zZRoOou5tYeDiYZGl/2uZqkGvihhRU6lQQM0Yv+mr1zZa1Wu0Ktdo5ddoZddopddoxWu0kqvt6JZ2ohXSSdyf0OdJBU1zUMQ4mHC7TO1tKAdvo3QWdZOUByxdgHSiXN4+zntMOqBdESoyAYuF88/WoW2tGLyvsde64fk6sCc9YalWbtKlcWX2o3l8RD7uLVd+bbmyS8PSq+4uy7qVD5DsSHGKGCdmf4N4xEcBn4ZJzDNbamSULRxwUX66dBb1SXSaL9P/26EsZylbOBDk6qov55/W1TyyD90qO+mLOSP946UroJ6aLgraUZ1F3U1lAksHtTPq9zwDx4VTaGNhhX86eXbI6wWLoKTunAxECN8o2iTaLNoiuzXpkh2c/J2sUZ4NGU6m+IoMn6upEXjnLtUVMJ/t73qREIvjutcuiImK84dDgMouneb0QSfIsoSosJ84C/YE+vE2bF+xsfqZq1/Eed3ejfq0/i+Ki00MzO5t7biYpQHAdjsIG7H1aey8tyvrGnhFYkaaMT4RBNbqRkI7ehtAD5bjQLF2ZTtJ2WxKXmgRw+/NCfPxHQIx+Ra8zzk7ls22hV8NhtkEyNRdjcxdwALQ/jUOZDUmDFyz+/3CChVXdH/jR5cGoVDY0OG4285wJ5P8scPmNE+GylvQB5PymBQJyJN6SKmqhh8bOoS/Jul4OsPQDb2YtqGyt0uqmjQe6m1b7IbbCHsX4Bqc6QmXEWbVYWdfLO4nDipwpwUyJ+fS7YRB86kjqa5A0nuQquv0yJnv7luo4OgvHMQTOATkjI46aHj9KqtYUxf0/qRJG0bBhzEQJm76eS1dmB2Df1j6YRkY6NjFnVBl2TIWaaBVmvAxCOxFFzd9F0cRLKa5kAm+085x1XdR7G/uC7fZcRiD06qd6mr+PK+vwU/YCM/BZzGNV6P4qGUr5bqGHtzBzzjEXwHHS3VH1bBgVK0t9lW8NMMmjB/8eBecP7QGFQfwp9N/Wi9bI37e1hJW+w655CNxviktTbPRs6iaLiFNi2ml2TPc5CzeRB9yZe1ehJpFsOJ/0dibbhvLn7BLejn1TCWI+AEgrgIVLndhxePibs92JzZn2g7+LHKofApbC1yElquRx5nSPNA+IQ2Esp1ynNnhhbC9wpM5PkFssGuR0MSC11TbCkm8EUqlTKzUIm0/uaP3LOELsJJnHhAuNWHxupywBELobMHF63LCyh/jIhrILvqvbOY8T17tVYoUCFAJHSuOVMRQBTTwOxMufJUoOWjyQxiwBHEWMbwWtaWI4VNk9vmN1B9MP8RdCYJvfQNPlRMIoAzgh7ebT9+9MQV8TWJQwxeBntk9o9Azx4yI3hydYIwLeNXwI45BzMtYtsZm9fF1/Co7TfC6dRoMJ9x9R93D//xy6lMp83Uge1cthmf/jVTY5f71OweVU/VxUtXOQZadoywMijlNr0h9AuCr9tCQSLOyIfIA6etVWjLP/iu9FNWGUXJcuNjesLGUQqUM0XwPYpLolUJ+IAi2cNmMMpgrxrlVp87Zi56epqJsO1Yx9IbbjPOXUBM4PIGvLJmt1idvE70QCLQ5ka+s+fe75leQi7V+FtjYWr3nuxpvG2Ordqz4REp4wuLl34SGAXcmzTRJbhUVab3oIdsHspFZ6DOmBIjc4/0s+rR96hvU7ZAxKJK3qTLLtLvZn9qNEVFHo/AUYjuvfz9zVf1mGwr2SibWC1QcN41WlRP/8tBp57gyG++QbeNEF1mN6fzr0sT7iPLoM0CZrk/ncLtVoz63MY4IRofPdSc62NyiWRHBbfPSd1CBH7Q3w5rIMPHxMEENV0/foaMciwTUnVzs2pO5OmFKdKVaXX6SdADbJ2dWQkxTX7++XDrNivoryiOnWVh/oWKk+2308Kdg7cNCRN9TBXAzpIarcPB2i82bdl+Ws4J8Ws+W8wBgWfrjXjIkUkx6kKXrZrttDPdD7oVYd/MXlQlQbLLce5L+5v2phHybuMFEeivSK5KNlB56xmukRYNhz5M8Rt9lfXJvr9Zc7TH40LknKHrVeKZDKwukPcMiOByR+Sy/sMu2bZk9HxPVT26eFY+uQJOXvnxv+CoeTiJ8TXwKistAKPBgqzyepo6obd4ecVR+NYWKQCGCS0vwXDfXYMpz0sHLFBdybbPNtkaR2u4Hvj3e4O5EHGzIfmUBQ9ov9CgCJKTytzfpkWG1kOJarXxMxxNRqlJWX9xmXTEydQ7KV3vF0XLJ3vsrw4AWm6R2DOaUo6IO6+7v/ghBiTjWzZZ6zPokrEPaih7A+r3WJmhUcXnKY3cofQmij8zu6mGQQqsKSJ87nG9mI6PGP3pdFFAkuI1R4aacsoVT208D7HhM3pIAYwJxvuofB57iNhWpo5P7M+uoGk7jlXsfb6p5vW8KDAuPJtBpPXIP1ycbjcFGb2uNCle1O1Ao01+rPGgd6r/nQsUvNMnCg+n8jYjE7e0NkrfJe1JyMofHE71rEUeR66eOcSokefC+hnKCQ876n2rSxeLEJFlQsoT9YPgOz95ToSGz99Qai72GOuTkkFkvRDLs8QlLEwY4Rjg78ZNyodSnxEcICoJEKsSUIn+amJLlpvMZvGxMFqcoMXePwAY5ImuDO2U8xhezwlRpRbJ/nieHqbvmSOS/ZWRkcD0TI3sK5k/Z8aenzy4O5P3f56Y5bHGTEkaH9TLO3tNBrhSF1OR5fDnrtlQLzTaA9P1EKhzLjsFhn1MGr6qhffoIi4sRwDLpAz2iB93WaUdp2LsISN4yVd0d7/QmtyLgunzPAq5ov1ItVLxQHIQ/8j6jiPK5ii/jvgYpRanTx3iokTnnCY1JVBpYXp/jPf3xHgNhFiEQitUgo+G6SGJoFoETIQ2rwa5chQoVyiNedg4L87yUgjdgExiTi8ed2H5tHAuxzLU4fN2GH44oJOSQGNtJXjMN/My3ZkOVgDwWhcVRGPGajbdnuN1s+JF2Q075GLW5M8um2t4ywC7NslrpXkv7sfouIkEp8ZhcrFKUhl27bfDYozBWfPQW520504ejqP0OYjO1Hby4yxEmk3KYMEaWDpz1K/4mjJvPCrQZeXZ3LCVaeS5Lww9i64/YSR6K7tN8r1yynDjnzF1p/mGHGSRQ9ZwjtouYN8Vj8DgYkQiiPNujV2LQZV4sR+XMpHKKybgfmIX0o9LCoP/doCllnAxOx3DKngWx1fgT89dQuf7wwcI/KBAMEsOIXVEqj7npTu5rlhN7sbrilTz92AxSDo5lrKbduO+yCMzwVslIAbb3PDmZ5bg8npllcuuTs2isyb6BXn2n9jNh2R7uM7Sq13aGjFr96RleRZZ9q21o51rZc84NZtpxHgo+deym1QSFD1HYuTO45atxckEbCdcudaBxIUMNiaEi0dziGGAgvtINfT35jAKqCBFI3a7WYAhF7feAecbCNcwmCVqUcbVhK05tisqdElhdk93q/iYJal0zdKFALUpvDdl2tPxlquyFPxNbU2S9dY0vdmhvzYTvk9geE+wEyGxRKsW85b73ZnJRJV4NWVVDlC2b0wkZkoisIHiqQlbYWmRVEnhpX1rzgMhFxs6ykK86e2Z2YsC3PNW/LrnccbkN41WEULlKBS0E/ccbdE6ZKsN+UIRUW9S3tYS18mOnl5D99qBbVDlvmD+7qrrWG4zwNqXF68LhHrk1OS2FTGaHR4gv85pqQVVI2l+TmCxfGS4le9rLorUZLo+yB0luZ7abDDfb4OMSoqZomR687VYHCYnNDuFiFgejYt54XLoh/PxzEXTL+bzeWwixQAbDIZ1Zpm3H2ExDfJsVvtXs7ZKf+t3DTpL7OtCcbqL71Sgtz36SjVwGtzJ3vWyIXog2FrKvcKZxx0NCa99htdkquknBAc8E6/LwFFHeH88xtTz4buOcJ4+1c/Ti0atZn7M9hPY/9WaaezPF5y4f/7NRVJuOziRzLKH3RJGtWnl7dlw7pFnFEltgn4PXbivZiykmIrpbLMJ3CH8vNjT/MKvFwgDXP74qhkEbBuGrduiSGuYcGrtpwqrUHIseF4AiM/jlnAk2Jdw2C5iKAnxmU3CFgg8zV+09mfKc+WQmJ5j+vqTU7WqPYmsmWZnJJMqdtpOxKY9gyqPLWBRp8lSYNC0dY0hSfzCxlIgTdh3EXRSghKnKlBQEVVlOSUWrPs2HVjIHhs1JU1Y0V83zcSqhhXrvR7Ig8QAn58QK9nroir7Btd0EkiFY+owcWa6GE9Csz8wwZl0R8XyJg5DIJTx3nTj37QbWu+oA9g93RfPz0Y+mklPImnJUETokx9H1lkHMfC73KKBeQsnJdqap9ONceFaELnIl8aKygQisQ43hhEufUrZMOVamzB8Tl1Gm4CsmaEgKXtj2q9ENTmzLjnzfnu6m7w2+MDxORq4M9R30u8jTSgSHbW9njL3aAWP11BBU3ryKSskGHej/LfaQPpfVvtIIkDA1ROv2KWUhE4KB7qNpjVGrmWqWi7DNmE12ns5dP5NiROCtYNk1rjk2QC8q/c9ud4VnhT86fZ+ScJ621KJEtnMzzLm9MlGNS4YuKV04iGKZ0pWDNOiCdMu2PjXIPd4eIFQOrONAZGgyMrkAOdbXJRSDIOSYVbj62ZXkZLZOnF4GJXoSJhoVhIUaTUqgqSiHlNJpk6jKLl2GdKlp9IDjZT0oXHoQ9wfq8LGSBphNv1FG+31GmUETMEpn6SGkSwgAlZddQiFhr6iPaTZzKxhM+cRMkRkGqLan3gBZrhr2bgw4vzzXFTQSYeNlBvUaihrbfYbv1xyoElWbmKaEhWA9PtIc4iFztvwvE/7jE23iOArBpsGdnMhH17BODF0oMKBnMjJcekCMk5nCekl/gBkCJwyCDwO87AoOmMa4vkIkqik9K01ZSBU7RKiclUlVivmoZNGlqkgGNxN3h6vtBelGLjjV4EuWZaSg0pUys00mz/MDbBU3WaEnzYdyShcdadcsbMolS6rh+jBCYckKFKoXDLzomxjPj0v3c11YX4b214XoLwhRu8nL3RkMKCXrEI223EMjuyjjiGtxedAx6RGTXnWsalRYc1m3Bx2TZppa3OoYad+UStUJy8Cb3eG+mu8UVDflpAmIeb9ju6Ykp51LtOpAYhLaRJM+hib7rMA/GJjn409mZAtp4bfNv5Z38JsAf0PiDZVj6Pt/alJlE3sskzQK9OGZ8wT06BII5PGmsF9tYsxeQizOJW8BqR1c9WySjwqHEJtG5IyyZKPN3gdJZKaHbsRICWGPIJy02NiIe85ELxtlFKTLgfLGWhWIpglwnY402r4ISOsCaVEd43DYH7Nw0lkEzg0irFBP3/fmJ+fu2gmwA5LA7llPixdZ4syu8pN8gd6Uz+9u4i5f+MLcWfwecjfv14JsAM5nFnxlx3jyxZ4fvnkzE54CIh8HLz9NtnqOyZn/Tdfg5nXumX09NwKkP38Gf0lmnBxKf90Z/O3QBxPQM+2aGr8eswVRt4q8mqHnzLF8QajGO0zbo+Eft8rncA1W8VKd0uiXFpjg4ke71UABXZoCbnzAIBIUiJz6wp4eBILLURFvG2yyebuBnrD7hAU33qSauwsxGcKNUbh7QuW2DmPz4kC29HUFYO0rLjohnVltJm/rGIiDPDxE3sI59v21t0oGyp2vv/TWW71g/4NpGOSkdm7YKGfL/cqk0vzlU6ZVjHjlrjm3kfQeecidXTT1YWhYBX5Sq2xpVLuxu6Lh2/u0EKlmWP52GvH9XzW1ooTtWqa+r3HAhYVHBsatzHukRZpqqqmmmmrVhvebdvSmteZBMIBLW7VRqk1QbdRIUy1oRJ2PoKXHHAkagnN3GGCdA3LAa6fQ4LRMOwnQY3o6CpK1V/1gGeeesbd7LjDE75vpmfUinNPbC0rP8fLL/EWmGE1OIp9VF8EM1IiWs/NGraQt9w/3xgPUudMr5I2ojA+9iv/rrkbU1lb9TVHIjJ2sYizIOCKNa6wYzn+F7AjmUi2qDdjQZJ7/iA3XTLHAvmZKyoxYQjMLzw7XNBSZHErUjLucrXIktXJ3oiMtEMCbA4GLiQNCELRjqqcT769igw9MXJ4Dv+wP6qUqhS7MWbWgO2l99UfciYwtXIV8W/oF6cHLpEHENxpdNsclDadOo0Bu4qMQUFb3Srm94cbXMYSXCs47FuLQnmECNSkZ3Lb00vTbm9Opl/rdwVm4FTk7cv6hA3sNb+ahP/7u9lq6bVoL8LspGch0Pg/l4oFEf66/gnCP53cz3sYgo/27oU3e6liEWhsUFn2wLVslPebgikroWfbTwxx7z+R4zeIXXaDy93pGC5pK/jtTMc1+ATbf0TF4+hyWfmw+VPslfrd+dcU5+QL9A0wNCceTz7DgD3rTZ2ERYquKWyCbiYZcuzuJ7ZH6d9o0q5f/PeVUZKgbw9RHwtRyGctnTbGQ+VzuUD4A/iws/cKUHt6J4Hrn4yoqT4wP2gJF0iHi9aGliMJjZwZHDTwyh4P0oNFPh1wBT10OfMjdYdzdmNKz5dm/3oCXl/DyhQMrWdjLR6+3YRT+bD0/FTwfWelEWeTdBduaEb3ejzB297Zu8aMri42QVVLdAFacAdP5shMkYS7uL8cf2jV1+O+VqwRFVgUM4rjEwV0yF+WLLSyB2dIT1/3Vdlu2H67FGJKvHLGxmAk975uykAhExKC4vFwlvoeQsCm32NzybXukRFonjmxNHg4bWddZueDa3NXS+7FRFKsy5vdXfJGIjDMh1a5JvGttLlS1h9qx/9ptg/g43EudsVi8Ivvqoe8fLfp/+q4nsk0mInpac/7o43geLTaOYCOPnbFR4FmhJcpHUwwPlEADnFmuHs7WtnH2Ldw1Rbo2GmJudTKPURUkYztORcP4e66Kp6TYmMY1qD0yVxrhNLIVaY48EclFDkR2RDZEGiMNYd1RpQu/x5Tws/c395nf+kDJHd8gUy6xNCnJpEikQIBDkTdD5Nj37tI94celxiKrGKE+T4R3R1bX9+bCuJNeMhAvq2usGHlmuvifK+ServIesQtbraht0g7su2PNs++b/fmxbZc8Ujgw1JbXS6/Jt7uO+hWZPXmdb0bRrbFnt/7w13XDphkoxvH1DKFglUa/Bi3ZanlDmDJbUUYwNPe/5ykzAjkiNJYNDaFZAhecc9Pj5Rvd9WNF2GfGGaevgarWCIPXtHxvP9RYDD/kW1dLMtZnqU4uQ4JGCPH+U55oLf0x5PnTAjzymQZg0e/oxXrRiqAe54N99JUMKOHCRq52c1SFItbNhVljx7VxDCiECCkZYLqoM/evwIn0M8Oi0ALox5BlfC9ALy/OzpMWehCoZWRrlL1Kc68UbXvU0NrhzJWxMSlMuTgyN94Cz4wyRs+CkXoP4SB9qm+tNNqlpDByQ264y12vg4EuBuhu3cr3OuNyWU0thtvZHAzWXuC91aG4l5QvSxuRS45KsOyPVjRF6xVje1CIljVrApdrzi7oT5w2SwNg5tI2H1B7ZjbFBhG8zI81MU6ISfscl395F7RGFBEzpDJnWPP56xLsQbxKsvCzfr1oDF+WlYOfRIMZ/kR0E7ciYjHjBAf/Z5VEieMw81frmcG0f3imFOJU4hA0UqoJK2IWEwtp11fmSuWTQmztSw16H/z2mY8SuY5xA1FlGerHQa+4gbTnNku8lq2OKHXETgtbHMUc4TQxgIGZbkounRkEZCcTJZyxlFhYIV8Vx4zClHIbKTIh8+Mg2dsLIiH5bSQvC1976z/VGolX7nBP6Sro3dMeflbwLM2JeR13cb2UvVkunZqOHMK+OQ4N4mgJORuFbE8zXQWPG5Wx/W16vcxo48aknENPk6NPEBmlxTWb4ld45GBXtv1r4c1+H6au5frf1hVi81UODCk8ZZMd3M/Sn3k0I2zyxEDyFSNmGFffx+tC6Igy30UXJerlwwknPbrP2afoxEwWmomn/iAWNU52mWIqE0EnwRh3ZJ6F2ljLzshqI55mSoQkuK3rQYs8/xDoVdbi325+5u8tkW7SLIMUKXN7jC4DyZYjZvqkA7J1GMbNUMTrOijshaHZuuhHFjNrM0WZhbKXBL7qNJmNSF5u6KhMb6PJjzQPw6NNTp2d/KYc4buWChAQuMS/bjzQRJid8goVFgk7xNNsfJ09YRSGmCpcaiGagm64icouuCnAvWewejoPfscVYGOcsquwoOZNU61RPqiOwCiWl1Yml9R8DiEsu93aDDe+q5X1NcyEZIpI5YrtRNEgs1zBo8PVfcxwgVWbylcCzcwNUtNZlT4Sg+OSIxtVInPlcI75kRj8b11I+waLidO9t5RIRN0YrnIVMTsksgYweBNSbHqSV0jNZf5v3ONtXoow/ZyIFYTzix/8OUzVcV4fsni48ABbViEfSBAvXHNwUk6KZLcW+yYTrxeJNy5uay0wLiB6QA9dbFJmH4uYrVjRmeoViiCSAJGHOsTqbCCcfsiAfBztV4QKsAS7Qgl5wDolV9yD5vi+oW+RoyK94f6J6s0nhyy67pUWY5Dz7dK4vUL5Zs/z+7p7qnWlh26dGWQFLbXgtxrhb+EsqrepSp9qrKdXfK6o2tGi5jTwaTYY0W6HBCucLpfrnajyAo6LHyjwXfoROyYQgSl6wwS3gzizaBw2VTHdl4sai0CzFAnVQQDQYFv2COyIezLi83MjdiCRKRMLQNxXJV0rolSCFWVHf1YsdEikM7ph+4oJIohFrutMlicMGZk/UCjJShJr+p8wNiRB9MixpdqqcRaIGTRCTJwgFIkzhDLxJKHCzcuNEV4JnTnnKFdZVQKcsowxaRCSzR69FZwBo78YnbSiolMt49pN6dnKcxdCkXiBUBY8kxmlyqvJaenqhdgbzDrYTGzbwdGBiDEldbig35oXy9lRAUCiIHQSF+HKCXrxUxH0QSd+Ro94LrRKVLYt1p5q5lM8dLzDaYtkHS1VPwnJq1y7i9vIa6zEdJvr6GWTE6H2Fwztkw2AcS8XurzSFFDokWhJ6f4ve5pZSXz4mLexo7NTKSNS5urWTv/fjp9ebCSdSfMolO6gESTCiiVemeWftYMGtgct+yJ8WgB5XjCJB8yJgzAnYYY30kV7B60aWHXQEQgEHouoWbt77IgxIcONMaVjRHkUSBSn1dg5VkNEpygaSzDVXKuz+HZlsmAAqXSVbvCHmsIVbLibDrw/A0hjUM+ahiaCJLkgedk2/mLawjuKveHV37QwGOddIoFVySa4xKjPVl0l8FGVoCkFVtrGlWwGg2ti5iBUt49uVv7DryGskyDWn0bZ7484HN7Tc0b3nKiCMCLCP99Gw+pOFqS1xf0d3mvZ1H6j+3Eq2GQgyIXXkmxapkaIl+/xtg8xa8zLvFSZLomXUtOhksMTuC0EEuLXEUkzlrWy743VbsH1JoUDLmCToDsIibY0P5k7ZlvZl8NXp+BJHju6PEpegiAv3ZdXW+r7CAXFy8wh0VLtQOkQGlt+6+1X35SBtISh1ICGiTC2WmidnY7hKCHelNToMDeTtKJaeADNQc0WgzbeGI3Ugwv3aoJzA3/i9NlsZE+IWm1Zu4/YPIyON8dQTiFlkmTYy31aUU9SjkBJbBMlzKh2WFEcwBLuCAngrMMwTiAJ7HIbQxCG25zMRIUn6f0Tjk15gae8E93ONm2/100oS1uJt5mNftqt9oQXEx621ZI9s0cGW7UoEIqiUSSypkZt234xZIAhOYjGNVFEAaiS8CtNAzHoKc0Vuwfpixkl2MRLOgR5U1mmAYWVPYUaTywjh9NDKyoizg8prT490w5z25huKfYiwkgWQRxu5yfxNdYysRpHo7g2Nfq4x+kK7HVktv8sKj2Lj5o2BPCWMxbeJw4W3map4+rQHHsjeXXp44hGGrDriVD8b2iqmIFde03mdEwzFRs+j+Bt1llTrdLKSs/8skDHYsoDSQ+Umb1a9cN8cjj4O965vOw520Y3z1iUbVyvEY9AXGI4EZKNc5XBvfH03PXKrgxlxX/RTaJ7cU3at7qDy6JdWmw522ALc1iS4ZKNsSQJAGHYSYiem0IoJXPkoFhHgOtS8eKg3Wdi6G7OtUKVPDhaxQHkmm+WK4j/OtA/KofWRLO6P3q72OO7ZrLCKI/Tt+4vwJnwpAdPzd0eKsl0hFG5TWviFhMEdhyc2eLSxTGQYPEM5kbBx1BZdxtWZdICC6x2G1qtfcBDPar6IY221kq1YrTKohWsWmNgy2YxvRJ90nfrOK7C1YKV+LljENdYvN1dfHTZn8MJbHbtN9OXNaLqqGtEuXpG14NVhPRABrLjcnObdnxFd3J+T5cPeKynUplBEynlpk4RXvVoWyDc9qh/ZBEfs9UuqhIrd4dDdy99r7DdYeATX4odL2/BRfiwSSpJchWlj2K4qnLxia955eUtuIhatevfqsTXI5s2pLW5zFNe+LvadJf/ZNSelPKNU2ZGHmKtk+ftO9tHBjVcZpeqQZIEC8sx5+JZI8SGzMiRkWqZrtI/32O79a56/15Lgi1HYtxtmvtqgq1MmPDrfp/dTAUtg7GkqndadonXarJNmsz5SJw7fIT3DK7yLp43UUBJ5o3rUIkzaVKDfJYQYKTjSTcN6Nt3J7OBn3TfA2utijXWX1PsstK6d5UVcINL/jwkSiVTdEi4FtrRPyriPQfKPaaxsqiSkdupIZy+oZs7K9xk7ha93GqUxmXvvtxKAEerJyLsbB6l7DANEdM7q9/2+O5lxnkN/EqHgaeJWDwM3KBjpYv6yXBdlvfooE2NDdKLaJOSJldcqRZCGrQzP7IzOFOyQUos9sBe0OMVpP38entVlP54+QD6ip5nan7Lf4cyhYIU65nMxmz3cXCbN5XQBl4/GiXhslWCZzABNul3bXqEjh6RhYl8JiDI8HjyEE+HHU92nIwa+1pvNJQq/MItu+vVZhFHEtVoKjD+r876vzfS/4rkdTIS8+Flk88lxFysdF07YczgPXygz3mlvZikom4yFT54p7AYWGAcSU/QxYqJPrnrmTpVQMnwjQH9ve3/zEY72uE4h5tBptzE3rIfzHkUIkRbLjArfQ8ezhLG3GJ7ie6b69aC94e/7McoNSk3eoC63Kh1jyYyuGYqKLe9c8CYNO1aKAQBLJuW4O5p6BWkd28SXQZjoSA4YCVlSeK5oIEI0PFZzE7usYik9gargL37UzRphuVtZl1w6Xv/hWDTR/FoVvWg953xzDzYDGYlipHnaDHKzB/skcg9n2vYCTfc3ATV5gZ7/2vGdMWkJv83ddhHq/Be5cVuKerUdF+Cr4ODUoKRXJARkdczqmvGwWYuMpr8xP61D4pzB2VD8aKlvvjO0YOlsXFoaUfFSBlq/FkRcmkCR5BhCUQY2GQ+OMrfyNwHB3ZujfFQCTkN5IeSBIGiZPlYLdBu2ZyStpjiC3FqWg0rubB8Z9ZgmsYtBlAysJmJEbGiqbwdoUY7lWyaf4YnSAWTjcZbzCXFc2I+OVbfDf6U4mQlb8GkRg2XYzXgliNul+O2mIdPlVXTt9Il7zDBXtNnxETFBKDdIfQE8KwiPOp/X03jGVJRRdhhN8g2c6SZuttDJY0/NFQ0hdSFaECmTx+u8unAb62uO2JYJJf1Br1G2LQOeivAtDKSpxZBXlkbYcpQV32vISUMQL0yral3LHmcJKydv+OoqdpLhI97C6atSCzGVhp8c55zR1DYePjO7g7RYVYRvBjn2GJMen4ohfZJe8DCPmP14Q3VvNVXUzJgEC+cdXWiJyG2YnuKwNQcRvQYdXVov3CB0QWYIr1pNYXKjeJhv0KhH1u2MtcCSdkFhkrRE8FlrwJas0zgEZA078PeV2ghJ29s8IlutvcS/ESbbiEVJJGx1jRTdXmngGo+couAkJ0yBMK4oEX4FEjNmty1GZ8SElbUmsynHeVm7Yojg4y3IcvDlML4k3Z7Q41wv8S/Sx53g6dQ7JWE4ylnb3mELMTTSqzVt7NSZb+2BE65uOmHLhlPW2QIgnxGVHHgBx2W3ZrVF4U898Fez/5JkynzRQzxYDRqYvXKd/AEYTk+ltTjK9E5RuzK7AR0BLvQkf1SKTazmqseo+bOwhhEUSypkJgbIlpjVvFLEr+lrGknBuv0ffo5ohHxmdYm54aJgjtmoCK1f3Sm4BtOE8UmzH6R3tko59xB4ElaQ+LBPZGEpGpwWYYkCYUqMslQuB8gUnqkkNEIM+2I8cVYnBK6QwmSqgQeQCaJKjLhft1oWD9Di2UHqoBcj3ldUtjZ/Gj92t3Sq6iXpK7pOb6PfImBHhgSHTrnJ+JmrVQKBRTsdbCUU4HTIQyIPJEmtOyT2crL2vDXRkMO5hDSwgUhtuYI5AojWMNG3O9GDi5XhzSYRCsVo6h4QsNfWzUHKYXCTEOS4WfUuMXdBXAWazkwh4eu75+OLWygbpiWBOXUpj4oqaBSduSm+KuIOUitb6Qz/WcaZ3Vj33/066zstHi2EvfDWV1fIt5YfWPxtuds6H5RILb2lGJ39ft6BcnLkEi3trJ6GvdOqeOpniWXYb0PIQqxXUkZgUxXYSWNk8iQkw8tlLdF1jHsMVYE3p7LPdKxgG8s9DcEVOmWUexgx4u7u0TDjchgzBcicmXsmXKR/LRmp4YWFxReGyTFSCGUy/L+YGkKIBK/gcmq3CAgAvZnGAvc5Fs+gYfjt7yC8QgT+eWj7hCzguRvM3ef2eoj85YiiCCKWkgokfIgkS9mFujBgXR8tst8XMaf5LMDfuBtR108U1LErTkta2II/o5cLB18UxikV7pulkW+3/jNereU2eYvAZnco2UxxrN9w3WHwkXGWTJ4X32/kZjjKVpkpfw9M6aZS3+zfsJBFPGIRz3iNKUtBvilOEBc+LPX/DntkmcLx2/4v9sjJGYQHXq7iaVX/19OlSrFw7moLVc81lPmDnFamkNG/Eyfh/o7DkdHman0zsRinyuisi5KGrVOhhCaURwQ8iEd79mhV/kzA5Gf9TkDGZ6YgQrPzMAJn5yBGzbPIBGem4FnRy6OQNwsoRlZ+nz2eSA9CedOwgsn4ZmTcMrAquTFeg+5Hyeh+SScqT0l8QoBwlZ2J/WwE+dTD45KmhYSoqktdOOMvrCcHqzUEyuqR5eI1/CfLBE1NxbtzLpnQW1zV0N+u/BNIIUoJLvrAe6BkySChhoxExmIxuRJwmPzl9bgTESAjamTJD8h9cCv7zRTgen9U0m9asj0xG74dy7lWazGld8ky95C9t/+xbuP4BGqBZJVkpwswahHc0JwFlokUoQZjlY1RYJ2MRJCa9gRct8aGMSTgo8tXtZOIiqFxaD68KXsJJVUH4RPbmvy8V4kiyvx0dXyLjDQmZKcELfQO5mnIW8BV3oKGDXzBENPwdQu4TVFstdJXFyECoYwkXJE7AdDfZeZsT9yuurTap9hh26TqjOxix9E903y/wkLszTBsh3MkAZjG2goS3htyL5G/iFPUPrYEuHZlQNxRXp6aM0x0ONBIPH7k2F3Qgmj8mYy/JMOfT65Aihx5HpeSGzaht1s0giHYvDtTrnqqgO4D8CuSmTbQnCsdOaOyAKzd4jG+CM9ZJqBk2taADv5bIvQjTnkteEkTF+slfz+kec0c6+p/u+Z9/7P+NYzFpnurV43x7GxyLclZQvRc8fPsa+67Zlcl10kARP8HipqdNCA66i+zxlEUgyUzFnBDgrLXQB2tdACA8wEucBQISQfKYnDShvMHNdn3gdp3Q54P6stAp7fo2kx2YlZL/jI0vQYSzeYsXF6oJn0Mh3+bgaPiliRGUiY04zOkOpEK9bXtOtXEB9+MDweARShBjIWclJMaBBLhJnzXjcj73cdK1AJ8twWOTXiXe2N55KAnRgYU/g7Us7X+ittg4y3i3ymb+oeLXPTlINQoa72AbfqH8a4d7f0r+8SrGnJjbWuhd6MRjlsg91mcqIEjRgEZMxSf9tw/e0WbSt2RCAIXX0I3JLhT2Qtnh2Vtfr45DND+dVM1UkV34NOaTO5mGQzYJ3Y1yi2tFlkNNmC5XbcbV80HiC0dZRBQDrvOrO1Xbzy0Aiffmj6UwTHXlJOT/Sxhw2YgWDVrohGPiueqSMhITRTVm5KxzixzwjANdiO+Sp52Xd3sOpRk86JAy6RBp2G1Y14q5UbCJSsyaWuB8i8K5fxEdVBzrWaupV+s0ZGdtCx/is6hPeXEtxhlwp2T+zFVitZmX+6FtETbVIxtkn8pFCCUz1MtAG2vcTfjfxQxiGTlBgSk54yRlbYChIBAtQyRBR/GNs2heoPCboWpa6AVog24MQ8QQF6IEmAAlUFYZnJm4yr7DAVJQMGrNWQDVLlhyRZy1JWSCpGU7JCGnichKPr7cojLqlttZGniBqT3W8lwZT3e6qGkGPEk22FcwaKqKw6Ek7FrKrSTXnwk25MMGPec4Lv/dkm5qJHhb+eeMbB7Je9A78Kml98uIV6lM3IAF2B4oC02XEIQLfYTfOzI7J/D2uQfB5Z3rhCKjlmFrJ/xLgeC7500HmSeX1CrVl7PrmESyLUtszrsCIjEn0lnEfKhmFvZP+PuYBHkmvZS0krp4eF9lL4+ULWnM9W6+5SgizTZmu7O7OKYDPlGAfWSTjyLe3u/12VyyK3vftba1KY+hJqjf2torF9zUaIA8EbFKx3zRF8fc1TJLoLt5R4hPX1+UWALDABC44yVGT6i7x2ICD1sJe7Lu4lxKyM/oxmmy1LP3Cb76unYUXUZ1zu+jio1+OjwAH8cS8rKw3B5eR2IH/2MjgeiMfHLWyWS4n4TxCohyy7hbZJfIDxgk4Mw4uOsH0ayes+QOw6RkQWWpxvdNMv5dRtDmSs4ouwA1RdKBxwWTcpHXoAXNhB6UMCrh75BMWNCLlpfKAWzGnRB9BST5GdeNwAIfzRV+vfJrjpTbZxvWzUvp3CXfxpXT+W23jdKFAKfmltGod43vZKI1MbfWPhJRSfo042DmYV5QlHpO1op/x1TBu5aEWJyxsm4cfD2LZTIWM0Gz4bTUpjb7D8DXWOzpA6frMNBxoa234H6Vv1UxYvBy/B70EzEwa56meC743CykjOlK8LAQ06JKGswTDOhnCdKxrxZDYC7MiTPr0qOkdkzySOV33b5igEh4Em7ZUtn4OHc9C+9e9voki28SYjKKHsP5wG6iJRUorxb8f+KI3Da4tY7v72Io5dGHx2yEWgNPEDNfWdz7C4hBRjRTL2RpaOjCLfgj/j5KEkuLfLrAiuw51Nf8+jSi9Ekh1utvO9no5rJuugYEHKRhiYCtFZYmwzC4t2770qkwgFtiYt5/EuPQrbg77yQbfXORahpIZ678GEdITa/HdKR6YART/RFYDdZGjdX+A5aD0szVEtuQGsJ0x/oLVqcad95nmO7ju5VkEqk39u04WJ8CR5zgyc3T+Jv2NAu0O4f8PyG7aW71ylbjkz72quLTamVm1LcG1KWpupuyB5BcFVNYfBko2TSlCYoKJv1u9pyJOYZXZKHW8oePMj7kAtZe1Mj1mcjyMtt8xYk7KJoPlgCZetgrkFu2gNWUrb8teynRX0chFfhSRGfuSEYsj4S/toculnTauxFYory2xSh/LO6UjJ14R0EWO/+Zf76AdJU1vqB5uOcXiN5qNESCWpQIFqTcqQCHTY5gLtc9dQR2xUtCh+SMFalVgRVIoSdEJTAJRolkVEb81gfvboR0kMRzIjzWHIIQfUtAcOtMXp+Un/eZeZI5SI0nOus8Tzae5oGNfJRNRkMqrSO8rAXThYQoEU2A3lr07L3nqf5oPOXeaU2iHGMkfwcGz8bvxP2v7LHBqsgeToSLfOPxN+zwCC7S6MIGcQX43oz40v4DXVtK7iIRBzzHstHgj5FRDKogKrujRre50L72l7dPK95IXu3tGPmXl1BJy3N+Bzl4Xi8Y6Gl2YS+Ctehfoez0UHqAxBHgIeSRwpRNXQYQO2LPhBhZ5E80yFijBklKJ+TBNBQMjoaJhhkITyIwgLkJFr20+9f1StGaFwhZP38GkA27mVg0GdLB5rdvSZ19jnoB0JeXTzPwkM6Xd16vLn1//vte7/YP+Y6uDycVV17Rx7eu48qhkDd7GoyxCgN2fbA/aLZrxdWhN7A4XQtjUkGpINqYachtzpE7mRCEPffdH1yKThtazIQG3CZADhWjS/ZiHLpc2IlUNuUUd3PPFAiK6NkIqKISVLrM9pGBAoOW1DhNHnQu+6RLE7LwIIrQb6QCwvid562yjFvgnd9F0VBWG8rWxr7yp0jyoCgudXiF+m0xjimvbAwdQfRd65Tk9U4f7zGgnTlcQD/s74SNur3xZtx+/qXBWQnXsxIzScl/sYJVkYVMsvMyRufd8Rheyw1e5ccXM4hL+YHKlDyBcWBkPfIXwVSVOm+pRrGZ9j5o1gVRVRkEWfQKKfdyREFDuPfD7VD59LwRuhjkhpTqNSrS5cz+v4My5ixLPsz5iHFAX5kNQvbNWqw5Zd6vo9TQcNLbtegSqDa4mkp3ejUQXx/zSJD06lIVvSkOyMzh4k7hgZw02ElwZcTS1y5mraH4RgO2z8QNKODgxVy2633l019z68G409H433n+Jw6uiVzi8/fuP5F4z6dsz/3t658LrWfe/9jeGKmjHy1eUH7fMXgn7ZcpDrs/44WA+uN1yFP0QRLiYeEO07wfyrV5EkmgePlsFeQfZzgQRLW9BoO37fTRpa8ioNFZMotI0kMFLMYJRd8hW9V47qxa2mQHXbUhR3nE0y6QKQRWGq3s5eHxPhGWtXW+KfFa42+QtDRpU/C0WxCGkZ8x4NAPLGJo1ld0C6PmRVFjik+a9D+bN9GKGoTtxFJWtgDT31nl0G6S0vXn4bW7XDmis71M5pF7ekqGhiVGc5/2/vMjsARNsH1ZL2CNbtaiiVaAnK/BBmBXmhCIEX7uLkv9VnFB7766cVvnFogvENW6a9YSs+HjkoZjYnGwPWfZo5xwEbtIbnju5d9obkK2l19StsSgE9m4zKY/ocwiQVtNJt500P7sKEXGLThNYwXXv3gwO+w3WhTcccmnWUSQlQUzLZbwhwyxWkVDEdTVXrR04beK55Hl6hsG8C1TkkooPNqoo2brtX2I/sHmFM+GE3GaF5rToZMeQ0F/z7K0WU0ajMNab55G/nnLJzRbnMJ2/6GBbKUD+cXzBAOfTp5I6/a+KrU8/DCNrBPZMhaEOfDRm5SS6Dr/n+SmxbZdNb8qKzqP+5Joys0ZpNCIVzGfnVrSlQwkgAcH4rs3FwYLrByfDLjxPiC1+N6VlUUFbfTV7PZVs01qzqwRZEnVu82Sne7YsAaD6zen5HBU/uiQ3vglpJ+wsbvfZUsmALuzv1/MLpvTDWpkkmDob1qrFum1t9OdkmcBrwhYYQnq0IbVQ7EjfN8PtcUZ0zBwYBdOFiNyNlcSX/sJLNHXt+XAnz/Kafy4stB9XiIylv9URNMHBTCksv8dC0Z84cJuWskWzOt2tLfA0xJHtP8F0NBbZ8FFOzrVW5rard21Ck24Fm5JgnuW7/8nbmGjj39JvwJ5xFEkP9BYboioMaC4cOgZIlawRUx07G1Ev18m9MOkjg4NfOPUwzY3IuNvmUspQ7BSneOBxC9s76LgInFEOPVN+Va050KkkcYa5SJjW2O1folObABGixI4gAoG7WZ0Dkz9Ecq4VAh12mYEB7zFRTc9WmtoWJpT7ewYrk+efxHq/RP0f//l4HJbyZE9LX6uvwS0zVBPeJqWIw15ypm1+3wuNWHFUVUUmxAjEvQvrrf4yYA9/xnFG/7egwGQ71eX6Vtnn1RYaG+uA5QLEbZWU7iBinl3kjmOsWangMWC02BOiaMQ76xDhRcMimwzGXIUrurDBkd7LMH+S3PCHbLzc927xcYckhq0oKhmpZcqhRHbkk5XhsMxh0RGtHvSqXjPNWNVwgGUe8wppvTL1SjMBArF2Cuxulgey9vZGqDdZv0ISx15vCuCJBLprabCQRLvYAIWKnhEUSrQgfSb9wBR6KoYW7xAWg9yTgglSCmdhs2U71FTg9pMy77S8LXb4pvKSIu3kr0lOr/l2QT7F9tg160Ate6HqGDwbjjvT1yOyYjVPPFYWPTIkyVgXtZwbu5vMoZRY49JyIaTGkn2Kyj3EN2jnfbN3OkM1UhIRlq2gjur6NBj/QPLcYc8meLRiF/Lr21DJZlwHZ6yV/ekq+ZhFqtY+HuN6hVKtDA/tM6pkqPQeLyhsffW2CT6tJcK8Gw8JixBk1OQTlDwOB5tToTJQ/WkEro0GDb/iURzXllNPPJPGlPTU1Iw1zph5aeNXlCX3/pGcKNl49+FXMw7KIyzxoph1LnKJtP+kuIvwz1RKsb4XG8JqNpBiEMnHaLExJKVAuXttFz63f6E3mbGMQfG63qzsncLL5u2pnZIQUdcKUhAMHI/ivdMj7KB3sD6WCx+zhnUrvEqWgJHPz+g1jfFLN0Q0Sq4Wfv+p9FRuyjr9qzAyjHuH88F6gKY9dcj9KM08ffH8q0CKdmta8byTjBTlBulibNIMHfKID5kyjfNYpyL0q2jdBOJMyylRJ/W7jjeenvcA7rjcmaCdsqNedED72sNmjktCN0ecvxYj7p5au3fvMtaW1IolEGJPs9U0x+juDz78AFX6WHNoSVBtmLT65VMgGSIdFQiaR6T1eDE1p69jg7kdZtjOYgqS/Zll2RXV5Z9o436s+r1lyPbix1JxmyVXegilmdKKRpPIQa+wrXId9rclrN7lKq3bJhfuvKHxQ8MJ7hZwsVV+8D29Oi9Y/mWNVfT1a4NlyUPGLGd/F+WZbK8428Ar12gCs8qLHnooh5Rtn+AJmcWORJ/SXIto7v1cURCetZ5i8EKtF282NNjneUgg9s7aEcdvl6njhUj+d8eWsB8A6MjzpCOCYXjNg+lmUJxUhXRFyI17BXKAb1slDEJs3tgR3FiAe69uZK5vwdetF0xisusXq9rCInH/NEAhc9ae1MBqL4/G55JGFes8YUGqKD1hy8OqN8kgW1ienxhIweUfQR5qKd9HjZeTrjvCyC/MOeGlFyj+bDgSPUJk68krqpJnOAxvD8cKn9oYii4bKqM3f8401gmPpvKg2Du8MTYWKMkGawz1ksTfq97NUpaFJG65xn2gdde70TvDOXFAyor284mBHpxRD/95ZLR/45RynOUQpxSSl5I97byRWkHFMctTgDbpEa0H00AMV0br8gvmwEUvIarqwTx3I+PsZjEow85Gr/ueXBNXI/O48Xy1uvl4sbZ6H2YOpmNt1C321ypebrHv/BW94nJUOrIwHe+ifaVogjQhaLHxGqX8zZ0QKYB8cdIS2W4GDsiPZ55vJTsGevX4DDkolQpBur6HuAMhXKR4s2Cvw1s7GMzLCgGA9fI2HJib3zda9f9ddNbjJ1nHLTfAQmJvtnJCMf/QaslKfhy/rp54lnGUgd2/ibKUvGsPQJ6vD6G7kuJXmda757sRTToq4iq1mwM5LNRCkj7x7Pnlcc+uv2fvKbSQRdNZLBIkQTITQ2vFLtF93CetGti7PkQc2tbkzOXqPXp5AxBSzDOXaz8sVTjUSHQRWQrZsOEvxh7dkgGw433/uq0qy2mgpubx/WSkZMYASRNRHKSR4oISLQZowJEcG4VW34CAOnH/d5CpB38SUnZyZZeTVgQGlnIq8mUu9qeaGAa1PkmsAqWMJSg9zQ1iEaU/4RD1Shu8dvLqzBqcsIjWs7UL0+ZKqW5fEwLo5TaKdbyQfa+w1t/p2RmP9T003k4aXqRVvbuWLkSaRsO8uOrYy/DkRbgSXbCac2+S6OORSsX1hSV40nfoGfTHcZmspa8LOsZAC/7xeBH531O/C1A1rfXv0iokMJOVL5N07/5xTxLy5qyPtLjSkpfNzZ6PZOCrjI7FTcNdRVZes/o4vzhc/B0d/Zy60/V06syTAEdXFXd+P+9RPrWgGVedzUqYkID/EN/LI2NqdBly2HgCAz37nqlK6bZGRWhEoE7a6Jn7SPOnOp47P6537JYnvYizoxlDTgBbCrgmswpWQP7AKA+I8XeM1zSU9BuMsnrGBS4++210eK/fH/IDL5hzCrvFKb5Hut+EMPulfky/vSx6uQbpToIBP3ArB/WSF7+2Sp3fR8/msR3RJNsBddkzns3aAlmk+ZO+IfuYDTEjil/ECyyJQRyP+hiyDXuxL7B3tl+XDwFup5cP8gPp+Glt8iOOxs09WDJBKCcUSooJyERt2irGjLza9i0OMv3lrZSPCUeY5cyUtsMrcZDCeXOayom2pSj9tYKwcqAiEIpfXfF1xsHOFCYc8NlviaLyiP+RE/Us2/o3JaCxmmzipi+tWDQ77WxV5dS5E+3UdtEa2fmJq00WpRpzgfD1HOhqMJmiTTlBm0m1s7se7udVYK3u7AYv26+pNVvBPlpTEfn5SaFST7K9fE0XJRhQfNMtBaqlRUWy4D2MjW+WQSctITvQVdYiYNsp34l38oZagfVwT2kyej9i9AJHGgTKhuUcQT+/bU70oNNyF1shcWTtY+vles8qghfddXfxcXbt4+njfapdMizKuW+7XM/jMBfjLKQNko/dt3X0nJdlgPbA0851qUDSkd/x4y1E39FxyALMbfB5ZbdPFVuytY+k3MdToYn9CEnqwsvRBwuWT9BfvO099Rpl1WgBpXrBkjgihufmydE6qc5ucVZ/1zto1cZ7wyR4Ezf4dwgVvk2ZUSFee4raC3ZAzIcHrcXo/kBD23gPYc1m36DIGmu/L81HhvzYCGd0b2GuynNOL3bX39kVVKLvznNo5oFnsmzsaeMIr7YfysKHs5i1ZRqJLFE4QUj5FuWHvI9WVBuvp8gGxzN4GspqcALoc0pmegkUjqd+/WfScuQnyRY8QmEWp2XItvt0N01aGCLBrr0Yy33hMg+DGM7stErOJPn78cg/kn5s04C5r5BE2inXGEcZ6PTBXSq4Ba1UXDSqQGH96L+YchtOYR+VE9nr+/0Wb7eaJ927puyyArMtZrcqer7e+SDr0LlmfuOfc1Bi0wTX+8JEm0u6arR+EKa04kE2MKN3vQ6Ch1Y5gwI/uhfeGNJmPV7v1KB6UxeijVvN1wvxowk9l1FMDz6lkgk8Y8K1aOFXNU+yplMiFiY6ODM1SovFjyO3PQNfNmxPf12wEk42PhB9OtZ8CejazlEeqGQalv/AaJ7KaxR4f6FHePHJk7+xY04qKiIPS5fzhGmh8aw1et5ERrYFo+705qitjaEq+JB4zm5nhf6G35aQYB1gakKNkb0J9XV52ssQyGyYt1cGSqx8d2AT0j7XMs47TPJoMwF+bC65rHU8Tcx8stUkLBqUczyb0fXtRVUVq9L43D1l/MU+rOzgtD/nJhbOPlE2wcdK0LhmD/3IZEdxDJtvvaD3MrG8tRCC+FTaGazZCY0/rG8GQ3+y2IHdha4WZS3nQae0FkpkhHAyJ3HIjDVa9yNXAqDY+++ODvf5KzfGMNT3MSR365RRC3HCZ8DaNy99hFufg3kaTQFL0s+0kads5CglRMqDZo/ixhsMOl9kQTfUpmiYfiJsQ59LnwgCjvXQcJBoBlylVLQSpQkqmympmyZL52CBJIlJFPgxZ9TJMlCrG8pTqAi+lVFXkA5kl8/7M8nbmLEbCmgnAjAIQHyn8Mb+VoT9KpNmkVYyvAm/A4wv8kw2lsOWQXZ00DFU3aCIB2eUZlKi6Y9nrdbsXEZnftVN2qWs76UU2hm4Ox9hyQEx1eQpE4L+G8QDCO4UdN+TWw9QMrcyJBMM4R/lgwfDBLh4TmJTZKintgjMaf6La4uQfn7b5dtBOe1Z4mlL3+npq1TiZqUqcmCQrFeXSItT0pqznpTMT2ZY2UsRrPiuSrOf3KIMV5dKilHZDd6a+JPOYnQPJhMW7s039zCd42dXReuB1H1DvYsQXgfJieTnp/lmqtxH0/eTRoi+z1vWTAIaxUqIBGUfCKy78T8e/khNYgnLL8RzHyJQSaqoXelDOLG3nLMoOngjFnpV1dZ7CG9IPniGU+owIZYeeQiYTY/b0ykzGTMn7Q0lihtgl7kockNMyPxBk/ZwmS2lCcJ9IN5LHp+yBtzNQnw3+TM1yDo/hXCoxfcKbfwfnPMwGcxKHreHtwXFmQEvrHGqiybKlJPigN+CVg6g82B0xUhQrv5GHj3924/F8IyY45t9xxcUkgWIcLZnr8B+TFI0QrOQmaUygzPnSW3SaxUnPbVdXaa43yWrSKkJ3Tddga7ZWDGNaMcpCunnKXGeTSNCcS1cYhxNUC62ENkaSPTabUHbMKxaagcZFA1KLrWY51k6yq4PF1fs860+61XF90IYWteR5nWo24UBMVA/bdfyH28uDA9KO4Ksc9e8wtU9s35YNQZjNsoBbeV7YuF52NhnW1HUs/eisjLSjV3lAqgh5K3bjIhSd/PuhHcD0ZHJzXS+BxGo5/Wmjx5pv9/1H6Fl6NltuAc3NzXVeJPcoWzCD+frWgrl1vPtWq7F312yk/a4DiQxfQOJ0fPBZbwj+Kl4u1TV9/8jVdjvB7YoCa2uZhAy5gatPA+tcdIv3dBLHts6z1BSr9JptV7zlWXtK62GQU+AlrElsj7sJqh7S3857LtrQI/3wSezBsMkZdUdSsaVzy55Eyu3i1iFPRTe0bkfgvqios1jKQ/iRTTi3Zuad+j1rxXIlbJiUToXLcvJYjpTjGHHW4+Oqz+xNpiNyJpvIZpPbV9m3E6IgEDfd2U/sJUvk87si594z17Nr1LD8KLHhd6GBvSQXZMQCcfqKpfluOzFVj9Brc7k7g4ZvjT7oW0dL0K4f2B5Ygxq+E1byhrBD4pZf0IhX8pa+XYUxvYJIS+9JbLBrgXuwDmqnN1T7ivesOCLZTy2qHq9ZQdMRh8crR8qThZYUvWHb4mqdwFDQ+dgAGEduY7UMjNGY0P4pOpt6+LKNTTGNjSsr2Wh7JO3sLe8CAdd9Ms35elvMbNwmE3JkPajp4wbaso0/JXUIL3keRx38ONPPcEHYj+UWW11hBMX71ctBC9XnXDyC3ymJFBv1oHTHIsNyWDz5FL8m5WQ2lc2b7PZtxvd0dwXi+SV+Ub0nLG0N7Jzu73ESrQqeHUSo486c1JIW5z5Q7KOxVCcY2Vx1ShlInJF8DfJr3T282u+8UAofF2BMScBaPlSBVkEQLYTF2iUXM6syZHljsU2ejTpe6aS84LrkyT196zRtxH/mVb4ZsMozlryiPcOpuuO0T4zfGj8uh8SdL22dCJEkbrKXuOIesvyBEhm/kd5H+rzRwbMc4+eKDivFAcfaF4jy5EN9Uc7ktKUFQ0b3luNQbvlzDlyd9CBqa7GiJ6BeibUvkNacKgebTwLYRiVBHprj/D4ik6wsrD+ztpvPbd7mGAe+eEVvArLEW7IAwJa/cxxhdCya65Xhr/WioG12QFnfiDjtdkwd8juCcl9sa5ZJRbBaEjDDLAOLM0FSWyLlKxHB32Y2SsyMmE05abi7pS+ukPZUnDw32d5pSip98u+sN3I7ZS4Ts4KXmDjTJAX2WY/Dzx32DgdEXG/CI3Hl+az6mbLWSJveIvKNWafu94lL3DiLrw7Jeto84fUZLLdH84W48faTFH8NsKlba+OyuP5CLsVpWrzjZohA5qmeqDJnN2Dm6PtYaoBTIy+jte0hoeFxHSwYyyji+ttzIah0JrzGFC60RGAy0vJb+cHuz1tJ+bQ3fTrHejcNrdei2ecHyeewRtF1n96+/ZBQegD76nHo7Xk0A7LK4XTUg6a3A4/NWhg6HRinr0Xkcn+nndYpyDuBPb7/D7QAgToymHFs26K6sr78L3HFh0mXBwsWXh6gX37rFpw0no4BLUuq8aCKTbhNcY2CPrhBlQY6X3ETz7v8s0KndnC1cTRJ2ZtKLkwDtWnHvpyOfP8xzv2cOzq73Sy1tU/1vHq/rdvOXcx8/zH2be8bOru8vN4VrXYi9KSF09rWILuKLCozItZRADmW76hMH0NBumSF6q+0la1PL8vewBkLxNmEGwtIksDXaBGltybFjSUt5ynixakI760qNNZNhO3r++CONO5kNCalvk/jgYOu6JqGbdwQbskIgKJId39GBeB0rA+knH2spCxLLi1PnTTpuVMNPtvriqzwURWeTLuDDvDVaPtdbQXXboNUkqNp7uA5PnVXQz+FNJGJVY7Pno90JxcrD9vryl0dHB+0b+0J2D0+SRzjbxZGM0+I8jEljWpYuUdKDW52HDADben9azDA9vEp2D8Zr7vZvY4fy6jje4vVDMA/BRjERrCRkpd+60g5itknfZI4UW35N4cJ5TBkyW9xp1RpIH7pDUvec50tvdpF9ppe/JvkNW/hy/7V6e3E3oS3BrOtzuAohOaG78J8KjAhaIhrKee7sx5wGf6jNpMuISZECCUpL7mzkwPKtWxSvdj/E6bkpcgGQdhGz0vAzfLhNp6kiKGfT8sSb2q2T6TiciZO6uWfq+Mz4zLJXA3KPme/3Nhb7OCd/y8y64d0giQkg9Ql3EeLfbthS7DJQNhmvwiNOpZtUlnHF2HfcbUbJgH2IdxmVNNk4MY/QkdhB6kFoJmlN8EJ5ZPdhf6pKl5fvXRSb69KG5Hx2vr7OKuSwfjhkgLy8NUOfog2mRodbApWd+5B9l60L9myQQOGo1kOzCpJlFoecHgg39RNxEae+2pKzejDEFMiSpXZOHOBlglcgB7Ba8XDr1vV9W6iSTLPnAxlI1/bANRy3rHS10T2YV1W8QKi1doTBSM2Vl169flxj05IKXzBCvtHCEBawRoRerBdrEzQixs3Wp/pYA8wSmF2A3Ok1rwd+WZPfHGE9ABrmTFWbrCuFw4jG/QmIw/uSGqEnaZ6Goqi8Xl4mXiv/BlOtJj8xUaObhrmtJrlgMa2IeLt/M2JZZMisfXwppE6ol1Pl74YIeAV82E2xgpDFDMaxzSnShXE5pcK3JpGvdcLErHptRmikdC+KifKXvtnFZVYqO8ouZoOs1h0j3R8Bk4g2BuT1IhKBU/jQxmTMt5RFbO3N/WbDgA7A4WxWaRPa4eO7OoZqYFIVRqoFMv2rNdUrBk4LYlqBXEOvfGFRUKMYqlf7U3cW2pNrDIe+rOvNNckd7XgoF/P0S2ec7Un7/HOxs9EotetwkaE7AuKPbg4ENo+UCoVHWN1dSs51HF8e01UuzjoPLAYsuQS1+dpOGDHBTfbSrUh32/WvHWdUfpekNBtweR7eHIchmYxT714WUAqAe8CK7ksoMmWSyXK7xTfedJVFwR0/P7Njx9WsisvFgvjl7Ubgw2q975qWTmz6BMxulWkzCHI6vzVlwBOOxzJF1pYxIxKzpjG3DoWo1wyN572wXHTXPI4noYzDdXfXHvll5s0vmikTgcJ5HQU5xtTBswkv87ZTPjfmTMnXzuVo9wOrvuPQ3sivOe2mz/bYnF+VxZ7ZmrdqjQ5/vI5g/78IFiuMgWz8rDN8VbpK4K4Lu/91W5laAJhLy/mDI/IdNX+eAzeCKJAeeBjTTmncNGEiQlJYR8rWQTeng8wHOCumYVHZlccm6L9J9zI+ncdXt7MBcPf81KRM819684DL7nndeBjAFpcRM+baV904WY1tfAJAoW9hvhZJsS6fD4DjrqNUDCGgb+iqTCETSrFtqrDQITRpaYlqS5vEjyGoL/YIR0La96m5uxLgduN5RvZhut48GR/jCofklwwEeiD50BiA0y0zKqE94KWS1O3C+LQa3qO3XiFaJVocElqe/ZNyg+X3qPhvkJX5omL+4ohP+cFJPDxgyLnIM2y6/OI2NmBGxWENhnO1U4OV7WuDzbFk5nn4sfmbF/Va9W5yC2cq2j9MvbCv3rMAmd43vHMwG3v14vTovGhfeU7ODQV5UWcWZzN3G7NTPpC5Kg+jNzXmUwmiBq0refinxTNxKST55MWhus9x2OE5FLMMwko2jRU/mE91MK6R1M4Ach2JWGR7MXHFcex70pH+q0O5N7rRl5tB68yzb4htVFTbnfIgIgbNhZB+jc/PI0OiuIf5cFpe8l5ym0zjXrr4+yvCY1J1LiuNZEOOe9GNT2pm1Vov+T50ivUgC8zpf9TYvIL3ngE1IfW7iCrmaRqE2teiU9285u3CJaeW8X11lOB0FmEvN2/c9nqVzccmQoTSK3it0VQrw0ISE7HTg87Qkcsl0JtKIb5infWIiXHNSRh3KebRJw45kq5sC3j7K2Z3BZH2jrp94zuqn2yiw0p632l/xsNhn6Jo3jW+oajt/OM1N7YkEm1akK7BS9gTlPKlVfeZulTeNl4BgcN1z+N0jBiplNSGrpGJYIObQzq3IMvggaoz4PfbU/Q5FsA9V8MbsP1Uq9YALphdgs5LfjpgiedyQ8Zfn8zob6rjbhkhwUFTibNdTK0MYImKH5KteGKMXKaKdU9LjIlnqwYQQIUoN3bTXHjNdFVKuAY8jq3ZflmDq3CIRoWRtRzdz6+HvEtJlb7g9RSwUhhYtorAv8mMbLIxTpyTycRa84LaeFrQ9qmdjERQHE1e1KG9OiROi1Vio+2+MNTtlI1c7OHvnU0bfqsgpN5sHbCMq9dvdv5p87Cjh+yOoBlmCkrlgAKLF2Bcgqw1sZgHVATP22ZuXvs1UURdlj8VCyM2xHx9dPt8xnmtLuMAOH8ehrD5cogv9Pt+VHrAVWe/Md8GX47/HL46fDD4bvDN4evDl8cHsL1hPHGCjplNBzO1gj+ozWO/migxS23DtNB28Kqy6iRbZTFbjLvNyoMTfxayWzT+HnX7AX6ZI2bzWNBHldHm59v9b+9otqvbr3CMjLZqHLH/P8pQrmgUU0LIzh353g+T1qJjEGubJY1HmO6ZP4Ds/YswuBIACgTBx/FYBPLpIPq6mHBWR0HtlKmzJVqiAfySV+aEYVjVCR2HB10ZBzAMVap1+Wc/0qTJk2aNDDpVUeBDifzJm1+UgFxIx77p6IwGSWEKhtI+gfFC6pUSL9aA9MLXkCtYEUlLx8QuETEpAKFBKkASasaPJ7EU5NF2ueQgN32u89G4ud6nPffuiFdVt2QLqtuSJdVN6TLqgYuA+qBhv2k6pG9UvtyQ9z/+zjgJwHw17FkLzoa+abCL0Eej4TFStWxo63gFbVBycM1mN4i2mUfXQ+iq+AIiKRAwNDSiLeFYIPaFaOvEWymGCas4kuDl0jHtuv5I0h4wyHueZTmZLg0IlkAHhtG5ka4i13Tdq2VDwNvHT82iZ8DI7zdWPbkAtKxZOQc0zDARpQeXnGsZKzRQx7eIIpJvkPMgGkyZnT6tOEgluNvcJ3CxcJu1NFIHJmug07LGen2LYcp9XpHjXtLqj0li8eEQT9kvqcVYbwDTiwGeF7obTmDkxjnYARdph5/9sPcGPqVPfBSzHTY5PwxL8CMIMGrrTApueeIkyB7DstXisNTCQkNwbAOTgQxhjVfDLaY4L75LDmv35d91g3j8akhH/JNtkDQ/ntC7nsD3ojS59Uj/AqTOSKxRETOtT74vzZbx7IEy/UoUzCg1+SFUWsGjsKfjYsrpALuLB32ZDZjBhS42+xVvLwTrEX3kdnuQeLGGVGedsCeCeomJMhCAsdsryk+QDw661GRYTB+oArnGZ5G6aHc1Gbs3jwDmeeB+2z7IhEgQESjANRICSnMPaKIEIDpXReLPNF5ZYB/MHAtSlPixQBP4c1bRo5RAe95eMhMx8scKwxFY2RgPKULoAVo42dqCBiPbBxmTf/ynAdlZnQp4zlcDvsFMyZjgldbl3E7glHtmKdVxxKQDk36fC0fVl2rtTztKnRtPx+H0Z1fubEnrVFpRIO4VdO70WMM0eLaoOzQDhjqTA2WRpucg2a7JxzNcfKqc/sE2srGxbuJrYzvhMeLWWY6csoVyhHZ0MU7fyyvZ+X+wvCa401Q2d2DQc9U3HeP3HhwyN/tY/DNm7TWdBFFNvM2qHsvLegL1XYdslnr2Z77PuN9qF57dzTYZtn4+PuGQHLRxzfvUroR99BxI/s2t3f7YRV83z+EPOWHc8X0XD4g1/rVwr5Fn3nXd6ZkTx5H+WfpkWgzoXvGnXNNO8mqIcajQz60Lsz/zJ358bbraWyBNYfVP3NV2Se4+/zZ+5WuQ4s5QhLCK/BofT1A26aM5JSyfvC46FLSB9brfEjrSrddIIzXDrsEkDc33L1Vh/L0bnpxn2eEpHPa38FUAvRmkwyMMOGvnR5FQr2nNPKMNty+U7Q2LPMb2/dqD5mPIZev2de51d3PfOAv7FPOuIv/czYKbuG+D6i3ZEWb0uu5Qon0Qx4dWmdK1RwURxjZ+dXJRw4PjooJR8SCGbGBEweoLzmy8/r56W4X2avFlElB1coCLTglkda53RtdMC9DtAg0jxc3LPFuZ0lEp+/vJW4+4KLiLC43UCdajLONK05AtxsfNIz98jEHsLnv4ZCuEsZ9mqqL6TxzFI4+1U4IBPS7DIMTueFJmcaXlCoNae6Kbg1Qtqxykr/NpnrMnLDFzR9Mi4wn6euHnol4bf01yW2HCSrdTUNTz1rYzCHRltjkcoFUdhbv8G4ZQfOyadTbMgic/eQUHThl/zh5UYooG3RFRUVFxRKll11FRRHj4lt/z2T1fxm1mZbEyJUNJOu2Gxe7oPZ4Sjk/LMt5DX0d0Uqbuc0cM/acS2mCVKOIMGojLRAmLpVcdn24IM530iUOi758ZQ5kwIOnNDBVeg1s/U5UeKu7tF3LHjM8C1qsDDKuvYlYNDgSgaWwn0KD5v0579sxkYDEJTbUvuvGDNwVxdzJGCI85NSZ8eXd8isG/g03YqYaSGQnu0lLMgHG5aVOkWuBGn+pYCtJ4ebmiks65vSrlp2ydOwqy024qx4qsLuoxJvkyfOSR9EgFRQUFBRKkCxTBQUZJJVnADnNln6HHGC4VsaUmygpFgbCa67o1AnS5tOi8EFYnkyvWxiIlB508yaOYtpYZS2HXiXS/gNA6C8sCc1Ul6xf4QQeqESUH2zEKMAUQlOogphvvbV/XANzzhMWFAVHs4vUCCNSjAqhydH+MVCap8dx2hBDL1PSJrcLP+aSW5KKYxjdX5cj8xV6QyAQ5O21qRyRH8vbm7Dr/3K14+2mfokUH/qKPLj5ENVUY70Za1a4dlorPanBrPvp0kwUfOBaV2g3jLPDF+9cMDIymDHwjOzBNa1stH///2gCe+VTs6QWE1zHealdPriT9YekTTuYTAEbTSOV/LeNgKe6ehNE2ll/XxjylNHznrYjzGb5W5ClgdGaFgi2bPUa/XxRYw98sYBp/rI1VViku/k9nh2RpqmL/icwNDNxlk4nh28QNFKqs6qnGVMxo0g9O/lXP5uuzxdrNyUqkBFDM56UeBUc8Qnh3YvGCj0dlPMRABwep2WC/zfpc7wdlfQlCWPzi8goDgxlE9xHKZqrnKrzryXoPy2875Knx6sWGfZU4etVpcU1I7Fh0ljRVVT6wwdxxejxyF3yoas38KGRJXcFDmh/ODZr2T4f00m86HfiyoFeuM3pJIFdnTjR2YE9nXvfbfbwNgAnwA6O8mCWWkgcq7qvBmb29joyBsO7AuBCFOeGPA1NYdCziB97fgRN+YmYc/852SsKk+OgjsyiWDaokq1MiDhHp+Fy3O6bkoxKBmkkvGEaXF3za5dTpRxAsav8UQvchPTGJDXbyXB5h30jAO5IGp3m4uBEdH0d91+5/PSXZWj0WTUcC8AmB1e4+8vr5WuGDKQylkfdZc574bQeW5bcLH0XTRCEPXetmvYF20OGFtJay5TOSXyw/HxticobZPy7Jjn+chLX1H35jBtP4pa6r5/xhpO4p+7bZ7zjJDbVff+MD5zEk3U/PuPcSXym7udn/MRJPFf36zNuPoltdb8/45aT+Grdn8+w3bNDYUp23yp207BFzmE1zR+atZf5VE/WSvYULChJrTdH6R0qbP0FzCs3GizozLtN0broZR7sdMTm1dwHiI+AxWt55nvxSpAl8YsO+TXrAqoP/vVGmkDDdlxdSq9HX4P7Wiu3469NR2MPjogJM2KBg220dfawcSfP3DrJI63IM12KgVVZntmKoeaRUPn6sSt7rya5YfVq/9U8CyfvyUTrBq00IL/+2Kw0vFGFfeXRLMiRJzC7HZIAw4JtWhaGEmsQjxPBwjHZlf9E7Sg74H+9d6JSWzrKmdgoiQZZCN/Xx5EKDOTjpv5mLxX5+OXG1W/LSupprnzWk9w0VRy9Vx3+usqkcKE548xKf+IIjSqDykRqalcp5X2xDkEvsiKTU93r05NiNIy3tdcMVcD7Itwa6RXHg6mYYu7cY7dVW+qt80YecdBM2NoDVcusHAiB2O4Rl6V9Cp3D3nRh07rqLhmdGfI7+wdebUlBikdj1lYKrBLfV2E3oTTopLKWzDwrWTxgbutag2y8PoRk1THd/L2nkbh8Dx3lwCkP6dNjx7j0Ah5Z4cYudyi1SJ2V4tj8CJaOSB5qWZUHtqsnHiIC3alwbXi6A1Ox6xwmaCjynefPcbSDDvmTf7IZWgz5/RaWC0GZvfy0sU0O5guG3uh9Pf08VK/ur5jr+tInFu3iAXxA9GStGcilk8LCTmKnZwydMTaDJleEqlizOfefy5IGMPscIlnzqrRNAwerDQKDG7tMpV+l0dTd5DqZXAYc+TZX+n2NgN00vdyaT+p/tnFkVYvEpt7K+szZ3t/82PMugvSZ+kPOkEstOq3CF3v0wiHaYoHc5tALihGvGknErG8KoaE9N5vok4mSvvtTVBqQGc3UGD+yjYHdyVKoaoRbvTcBKL09YBkyEco/5z31FCUT2JyJYH1MFfZExQlTB5/yg1QhiB2PAVv2SlfROAS7w2IZxZO2WzhdAoMUUcCbAINmQQ19CX5NI157zWdw8mAZu/1WB+MgQtvf5Pluwyoj7T7IBPeSJN5SboM8EtFMozH/ndcbQiJqcj5/3kQb2CzFFFdM/V7o3h0kfR1LPKP1OljkCT8enFLLdH88+K7X2hiKzpNQsiiUFcmEo8KyXvQeAP4rBBCOpaKF/VW4BYuOD2tL/IE3cB4ab+j+pSJ83mRWKV0fJeyT5zyX0g2SWY2UvOuRXHK6syDEno/0pCxuSTMHk1XOCFdv2Tx4xOU9lIubUVBlO2IpaVmmL4H4VklZ1YTWPIt5cEF7l0+FHjTt5oV8mhtWqbrmit44oYGB1XevXo8m6jGRo4Zk0YYWXkD7D0tqgrgZtNCtWH9YO5yoS3nVLxEF6uLccSiDVNdJPitjGij5+ADnWVj3tZD8VbNW4tLNeaY2tS80xcTCzTJlfKluZLbLQcMLwWPZYiL5lgb0OEPyu2a/2yzbDupIyhsqFRdG4XJojMU8TVCLpnc+ivTyCb3j+RaeM57LrrzkXdcezzMTuhCOCE+Tx8tIN6OY0qlBiFxhXXAhmhoQn71wIsBX/zkDFYqtFyPokLgTemBrnMVE8xH7BCTPy94TRfxMO1qDwcQyAql1jGx4Dcy1skOdYmGQ3uGOGYT8imzCPK8x7lmNDzpGNTFLl6okILWbozW8G2UnqcdbqFTPEeRHF0GyaarWe/rOTXv3JivTm8Ao9KSnOneXvD7VeunAOxMmo5HZDs+9HRsuXofYHdlZv4YXwsYQwgLMMu4FIMTiVubpK3G6YhFeGhD4hlzEHWKb2Hh5NwEUShhLyNX1zJO9BCDy4RJk3EZgmTBSILbnDj9cvhTvVEPI3IlAhFP9ihujMTvN+BOErRm6omDOyt79JO5I4VpJHwb2TcTjjSUpH8b2+PBxib4cLLE4I3Hbq9mvwfqUSbNKUwX9NtNNQRvnuMW7c3yCgu+XHAeP5wCPvdNmXzzgEO+Ycq40RWSn1i4g6JB8r0D3upW1wqEEBOWXTvaZYN+9b4Jqx/Fe4ng3LV21gUOQwnOFEM+Bd40qRovdt6jglCIKeM52x6HWTZke6UXLNPumyPLT7nzSZpRXgXqOXOIgqggiLf6WsT9cByGa9BrQ2RQEjf1JR6AZe8lGaUt33NBDO0hClqZJvZEvBV9cCPizdPiUqsFjVz8ezhQbi26xvtT5zssjMZ3emGO1Cf9APnqaIQDjj/HUh6OAY6/w5OEIeN8ZEAEffOBRGKHQnPNvHnaKfIohA0x0Gn7t4eB1jXYQfxhuV6HOGgc8k7cWkcrkCuVeVas12uj0BmNMZos1NrvDGZfb442PPEPCIhEVE8/WB1uDSIr47tP7wA8p3Z2UT9k7QTjhmLg5QNGtYyaWUgIRSzASO0P1iMMtFTJqBWwxi5WYw04speRJZtEWO9UhQ05nGYUJEcUcKsQk40W4YvhmcbFVjBIeY/sIulwCulifTJaPmN0G432D726mHvkosR0f2+JgRgyUGuOYSMquKFIqEBjfNb4Ie/I07I0CTgG0M49c2WGMEE/iCiOdTaH1srmSCdkQPesXOstZrAV1yjysZatYrq1alqBTZpEnc2CgLbOb4RropoGbBZimFZT9A1sI0RzoZCnGmPrQnKGOmcPG7DSRRRdtll5htDMPf5nF6KyCG6AbmoW0zMFbRoRnDmozeiYeBzOPx5lDvSxBu8wBI/YEvTlK2t/rXZaiYph5NMyeordkEM6HSdDM0BLNiuRmVryk3TDNRiyNm76WbUDV1jAMSjf4x06xoGNkdVSEWF9vv4IkyvzYGUmg4yJpgd//dDfw0aR8Gne29Jb76W0orVydr4k2yrhhvCI1gw8tFIbpr9KMDZs3N5Yp36VLxo160Wpj/BkLZuVF7O31MyCp0z7INtkqW2QzNJ0RGuqtonhS+lboYHEdgH3gPtKkcCAyaR5xtIKoP0r7o2ouWzSiTJtEwy1BUe7pCN04TcSALsGNbom1DL/cqqq5ct6pegxp9Qigh7/huXjCUXO3BnROVjZiu7pmZM/528OHou55LfNe7VzAUBajHIerl6RgloP0gr1me3iwW0L6AU12Sr/Thr6BfVk5Oj45FenITdy1S0VkqVtEFPvhmRQLJIPUM6QEUYRdOBhPN/EdLxBzu78eojfrJ0k/QQjuEL1djzhE+a8PNybqvh0Q2hKM4g4GnnMrR4IsdAt/FYWQFp5ZDOj608znsrP3g9rmd8Kt1haBiNh8YaIl55RAO9aQy8r+Ks+A9dmthtx3M0tnpGOh/XiMbkCnvCxXsNilcNJowBoravwcZVzutDvVplpVi2r2Tfz7hjna1ldeaJZdTpkGceNmbiT+H93gL/wq+GWIn+JanEDFwMkTt0tiY1NzS+ufsqZjfxqqphumZTvugecHmWwuXyiWypVqrX6IcNPy8uPulXqfbhYMuf2NTLZfLVt+NnWxCHExtK4tR40i8B6Gj5cfulbKlK1C+V4BgUvsLuYHTu/iHhCOjxKDjRS2C/vWC/UKgPATF3nCExUVPFiXYqGYJSV0usgVJiWQRFTMs8JtHhJsAStoPXKt90tWNmDQmltR0fSgIMHuZC0+kr0I6FPksn+PQuZ1QQ76j9izjg8krTs9VKYt+giJ2DTqzddQKFhdWxR7gMWwuizst5Z9S2RhN4uCDRnFZhwsIuo5OcGuyxo2jAUhWxFyd7tfIWM/rZKeVzUzEDW17KusVroMsi5VwsZE9VxTe4Yeehc5VmuBsP8WbY7P4s2vow1s9EDjUOOm+HCw9kGBDnK/uSoINjsWuINMo6BcsD05A4IIjZOL87YoGaP8uG55z8c1irPkCSUppGSYgoq/rDDX0r+peW5zcPiX3Old5Ad5yUtd+jKXvdzSxX+Af//HP//177Eo6uWuotEoiQnhkITiBUIcjT/bdQXi7R3ZQmw08e09Wc5m//97r4jBJ1eiJmcA0HN6Vr/WU3paz+usTuu8Luh/ekGtWYSI8Jev0D0iou4Jq8rBwAtC908U9dOI4ofQ/Rg0QX3UW6PTqK3uMnSmV6hR+VRg55HoXma5e8PqQ72tp9Ssk8rpy8lvwEBFORti4xbnV7XDYGxX130Bxa5fdLudmnREj+qk2kYnHlWFbz5xIf65HQy+qTYmZC8m5wJNjRt/HaHNjx0LFTi+xr2TDlIYY0JcQg+12iXZoZWQlJIjVwmRjFg91Uu91Ud9NVY36j+6STfrFt2q2zSu2Kmbt2yhrI45lbCFFtjtaxLLr1/ZUsGHitR+bdN+7Z9veqyLCjgSUfdI7KIcjYEKHtSpOLZ6zZGA+yR1KteF6CpGWU/qOT2pJ3Mc2FVHFat/XNjLOjTpCgMFun6Q/Lotrv9T1wWlePVrknqpe9nqWNE5sWi5vpq0U3t1VO/rgt6ZNCpE9yh0T7C8zN52q4lund2P0h2rd63ILbRd2IXdi3jvJjS5mTOY5Djdku/8qDJL3L17kQTo+tr+Er9LyHfg3jWw6ylZTgElAH9RVnizvhepFQHr7o3KMSxgTd0FN2MuzgVzBWDFkJkTE1Mzy0FFUo0SqE2dMGed57XoSZkB5kdS9yMykeeCoqxEXtO0Ak2H2Y2DDAzmxnFTf9LV+1mzTh1no0bGgtl93XxDsX0Dm/WHnFcpT7qfd9bxsuPmA8SUUOyb+796hOWhEiEajd0opE1Jx1Nu90skU81Li1Wakxpu9t6L25pv49Mh1aLkhhTHuIlR5PyfhLYqfWuG6LTN0snlaDtGeYdFB/7pMcB3ntwY9ZZlba67WhpyGtQlcOq5Pf+/Hh4ZHRufgFuF2VTCvtQjXFG8Z9l2kimmmWlw4sVSOGx2bn5hcWl5ZfBOq2vrG5tb2zv0boUKyMH9tLe2nc5O1zU52NbzAzLZ3NvdZ6t8DApFyqxS6U7ctfEK1Ro0oF5v/k05PDrm5PTs7Dw+4oQLDLj8YQXjrEiqJOPyOmbIyumUztc8dzGrKtWa2TvWG82WuNIv+HbbUm5OrFjj8rjJI4l2wDqy1QqqA5aFnaRXG+sq5ifs9QfDntF4MjWL72dz6rCzF9aOdDon0sIPT++2XK03290O/iLcH46nhKwDIMNTPkw61g9/OPGB5VMVgGgDBF2iODg9Apvm3qdNMEpw+KHjwqJ/ULbx9AWMFMnhq4EIkAgQMOz9f3iGoAO4312pbrnvj+HoGHda4KLyP+XSQ0rwa1RKbfcAU5p/y8JYYYcuoowGaDwLDZYgqdFSOO1iFAVBblnp35GPIqU8NdajCNDVj+hh0nliXCFAAsl04obYWDvMGpd4CKh/GLMsRpVDCVG1N9GJvLAOCP2C3OI8coHp74yx4oP072hcHJeoKLILZ9dHNLax3P9beDhaEIkrydboxQrL5n02Oi/eKZgvJPX/f8knmIRinlfxp/zz7L0F9C60o+KC1wULYrCujEpwz0+J+LlHs8BDJwErr4J69Z/nd+vuq+gGGbZsAr60uHFJxv7TCWPnBi4RJyLxlUjd4UZHqG5XWRNoSCy/0BZMviiQJRjcdu0NAQi4T3uGfAEjv/25/qhnCijVvPyTQrhx+VC2OPilIVIjxPvRtdXuI1GrcoslT3pVmz2KqInbGVdSSS20DthWUhOAVV4bkvTaezfBoSXwJAEDfyHGTMRkmEMfpj0zXV38gWXOdnbcEX55D4BnKpxQgO/qfd7zYYAh7gR7/kM1bMkwn4uzYFQ9aVM9Jv7xPtqCjfk+xGCMfwAj/xCqfvRPlGPoCD6FUn3jz/0WYaG9dYIA", "base64"))
+
+// ——— wasm runtime ———
+const Module = {
+  preRun: [],
+  postRun: [],
+  print: console.log.bind(console),
+  printErr: console.error.bind(console),
+}
+Module.ready = new Promise(resolve => {
+  Module.onRuntimeInitialized = () => {
+    if (typeof define == "function") define("markdown-node", exports)
+    resolve(exports)
+  }
+})
+
+function abort(what) {
+  throw new Error("wasm abort" + (what ? ": " + (what.stack || what) : ""))
+}
+
+let wasmMemory, wasmTable
+let HEAP8, HEAPU8, HEAP16, HEAPU16, HEAP32, HEAPU32, HEAPF32, HEAPF64
+
+function updateMemoryViews() {
+  const b = wasmMemory.buffer
+  Module.HEAP8 = HEAP8 = new Int8Array(b)
+  Module.HEAP16 = HEAP16 = new Int16Array(b)
+  Module.HEAP32 = HEAP32 = new Int32Array(b)
+  Module.HEAPU8 = HEAPU8 = new Uint8Array(b)
+  Module.HEAPU16 = HEAPU16 = new Uint16Array(b)
+  Module.HEAPU32 = HEAPU32 = new Uint32Array(b)
+  Module.HEAPF32 = HEAPF32 = new Float32Array(b)
+  Module.HEAPF64 = HEAPF64 = new Float64Array(b)
+}
+
+// emscripten_resize_heap grows memory to at least requestedSize bytes, overallocating
+// by up to 20% to reduce the number of times memory grows
+function emscripten_resize_heap(requestedSize) {
+  const maxHeapSize = 2147483648
+  const oldSize = HEAPU8.length
+  requestedSize >>>= 0
+  if (requestedSize > maxHeapSize)
+    return 0
+  for (let cutDown = 1; cutDown <= 4; cutDown *= 2) {
+    let overGrown = Math.min(oldSize * (1 + 0.2 / cutDown), requestedSize + 100663296)
+    let newSize = Math.max(requestedSize, overGrown)
+    newSize = Math.min(maxHeapSize, Math.ceil(newSize / 65536) * 65536)
+    try {
+      wasmMemory.grow((newSize - wasmMemory.buffer.byteLength) / 65536)
+      updateMemoryViews()
+      return 1
+    } catch (e) {}
+  }
+  return 0
+}
+
+function emscripten_get_now() {
+  return performance.now()
+}
+
+// UTF8ArrayToString decodes the NUL-terminated UTF-8 string at ptr in heap
+function UTF8ArrayToString(heap, ptr) {
+  let end = ptr
+  while (heap[end])
+    end++
+  return utf8.decode(heap.subarray(ptr, end))
+}
+
+// addFunction adds the JS function fn to the wasm table, so that wasm code can call it,
+// and returns its index. sig describes its type, e.g. "iii" for (i32, i32) -> i32.
+let functionsInTableMap = null
+const freeTableIndexes = []
+
+function convertJsFunctionToWasm(fn, sig) {
+  const types = { i: "i32", j: "i64", f: "f32", d: "f64" }
+  if (typeof WebAssembly.Function == "function") {
+    const type = { parameters: [], results: sig[0] == "v" ? [] : [types[sig[0]]] }
+    for (let i = 1; i < sig.length; i++)
+      type.parameters.push(types[sig[i]])
+    return new WebAssembly.Function(type, fn)
+  }
+  // a module which imports fn and exports it as a wasm function of the right type
+  const codes = { i: 0x7f, j: 0x7e, f: 0x7d, d: 0x7c }
+  const sigParams = sig.slice(1)
+  let typeSection = [0x01, 0x00, 0x01, 0x60, sigParams.length]
+  for (let i = 0; i < sigParams.length; i++)
+    typeSection.push(codes[sigParams[i]])
+  if (sig[0] == "v")
+    typeSection.push(0x00)
+  else
+    typeSection = typeSection.concat([0x01, codes[sig[0]]])
+  typeSection[1] = typeSection.length - 2
+  const bytes = new Uint8Array([0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00].concat(
+    typeSection,
+    [0x02, 0x07, 0x01, 0x01, 0x65, 0x01, 0x66, 0x00, 0x00,  // import "e" "f"
+     0x07, 0x05, 0x01, 0x01, 0x66, 0x00, 0x00]))            // export "f"
+  const module = new WebAssembly.Module(bytes)
+  return new WebAssembly.Instance(module, { e: { f: fn } }).exports.f
+}
+
+function addFunction(fn, sig) {
+  if (!functionsInTableMap) {
+    functionsInTableMap = new WeakMap()
+    for (let i = 0; i < wasmTable.length; i++) {
+      const item = wasmTable.get(i)
+      if (item)
+        functionsInTableMap.set(item, i)
+    }
+  }
+  if (functionsInTableMap.has(fn))
+    return functionsInTableMap.get(fn)
+  let index
+  if (freeTableIndexes.length) {
+    index = freeTableIndexes.pop()
+  } else {
+    try {
+      wasmTable.grow(1)
+    } catch (err) {
+      if (!(err instanceof RangeError))
+        throw err
+      throw new Error("Unable to grow wasm table")
+    }
+    index = wasmTable.length - 1
+  }
+  try {
+    wasmTable.set(index, fn)
+  } catch (err) {
+    if (!(err instanceof TypeError))
+      throw err
+    wasmTable.set(index, convertJsFunctionToWasm(fn, sig))
+  }
+  functionsInTableMap.set(fn, index)
+  return index
+}
+
+function removeFunction(index) {
+  functionsInTableMap.delete(wasmTable.get(index))
+  freeTableIndexes.push(index)
+}
+
+Module.addFunction = addFunction
+Module.removeFunction = removeFunction
+
+let _setOutbufMaxRetain
+let _outbufTrim
+let _releaseMemory
+let _memoryUsage
+let _parseStats
+let _parserCreate
+let _parserReset
+let _parserDestroy
+let _refDefsCreate
+let _refDefsDestroy
+let _parseUTF8
+let _parseUTF8Stream
+let _streamCreate
+let _streamFree
+let _streamWrite
+let _streamEnd
+let _parseUTF8Batch
+let _incCreate
+let _incFree
+let _incSet
+let _incEdit
+let _wrealloc
+let _wfree
+let _WErrGetCode
+let _WErrGetMsg
+let _WErrClear
+
+function receiveInstance(instance) {
+  const e = instance.exports
+  Module.asm = e
+  wasmMemory = e.memory
+  wasmTable = e.__indirect_function_table
+  updateMemoryViews()
+  Module._setOutbufMaxRetain = _setOutbufMaxRetain = e.setOutbufMaxRetain
+  Module._outbufTrim = _outbufTrim = e.outbufTrim
+  Module._releaseMemory = _releaseMemory = e.releaseMemory
+  Module._memoryUsage = _memoryUsage = e.memoryUsage
+  Module._parseStats = _parseStats = e.parseStats
+  Module._parserCreate = _parserCreate = e.parserCreate
+  Module._parserReset = _parserReset = e.parserReset
+  Module._parserDestroy = _parserDestroy = e.parserDestroy
+  Module._refDefsCreate = _refDefsCreate = e.refDefsCreate
+  Module._refDefsDestroy = _refDefsDestroy = e.refDefsDestroy
+  Module._parseUTF8 = _parseUTF8 = e.parseUTF8
+  Module._parseUTF8Stream = _parseUTF8Stream = e.parseUTF8Stream
+  Module._streamCreate = _streamCreate = e.streamCreate
+  Module._streamFree = _streamFree = e.streamFree
+  Module._streamWrite = _streamWrite = e.streamWrite
+  Module._streamEnd = _streamEnd = e.streamEnd
+  Module._parseUTF8Batch = _parseUTF8Batch = e.parseUTF8Batch
+  Module._incCreate = _incCreate = e.incCreate
+  Module._incFree = _incFree = e.incFree
+  Module._incSet = _incSet = e.incSet
+  Module._incEdit = _incEdit = e.incEdit
+  Module._wrealloc = _wrealloc = e.wrealloc
+  Module._wfree = _wfree = e.wfree
+  Module._WErrGetCode = _WErrGetCode = e.WErrGetCode
+  Module._WErrGetMsg = _WErrGetMsg = e.WErrGetMsg
+  Module._WErrClear = _WErrClear = e.WErrClear
+}
+
+function callRuntimeCallbacks(callbacks) {
+  while (callbacks.length)
+    callbacks.shift()(Module)
+}
+
+const wasmImports = {
+  env: {
+    emscripten_resize_heap,
+    emscripten_get_now,
+  },
+}
+
+function run(instance) {
+  callRuntimeCallbacks(Module.preRun)
+  receiveInstance(instance)
+  Module.calledRun = true
+  Module.onRuntimeInitialized()
+  callRuntimeCallbacks(Module.postRun)
+}
+// ——— end of wasm runtime ———
+
+// WError represents an error from a wasm module
+//
+class WError extends Error {
+  constructor(code, message, file, line) {
+    super(message, file || "wasm", line || 0)
+    this.name = "WError"
+    this.code = code
+  }
+}
+
+// Get & clear last WErr. Returns null if there was no error.
+// Uses a descriptive name so to help in stack traces.
+function error_from_wasm() { // :WError|null
+  let code = _WErrGetCode()
+  if (code != 0) {
+    let msgptr = _WErrGetMsg()
+    let message = msgptr != 0 ? UTF8ArrayToString(HEAPU8, msgptr) : ""
+    _WErrClear()
+    return new WError(code, message)
+  }
+}
+
+function werrCheck() {
+  let err = error_from_wasm()
+  if (err) {
+    throw err
+  }
+}
+
+// bytebuf takes an ArrayBuffer or Iterable<byte> and returns a Uint8Array
+//
+// bytebuf(buf :ArrayBuffer|Iterable<byte>|byte[]) : Uint8Array
+//
+function bytebuf(buf) {
+  if (buf instanceof Uint8Array) {
+    return buf
+  }
+  return new Uint8Array(buf)
+}
+
+// mallocbuf allocates memory in the WASM heap and copies length bytes
+// from byteArray into the allocated location.
+// Returns the address to the allocated memory.
+//
+function mallocbuf(byteArray, length) {
+  const offs = _wrealloc(0, length)
+  HEAPU8.set(byteArray, offs)
+  return offs
+}
+
+// malloc32 allocates at least size bytes on 32-bit boundary.
+// Returns two values: original_address and aligned_address.
+// You should call free() with original_address.
+//
+function malloc32(size) {
+  let ptr_orig = _wrealloc(0, size + 3)
+  return [ptr_orig, ptr_orig + (4 - (ptr_orig % 4))]
+}
+
+// malloc16 allocates at least size bytes on 16-bit boundary.
+// Returns two values: original_address and aligned_address.
+// You should call free() with original_address.
+//
+function malloc16(size) {
+  let ptr_orig = _wrealloc(0, size + 1)
+  return [ptr_orig, ptr_orig + (ptr_orig % 2)]
+}
+
+// free wasm heap memory
+function free(ptr) {
+  _wfree(ptr)
+}
+
+
+// writeUTF16Str writes str as UTF16 to address ptr.
+// ptr must be aligned on a 16-bit boundary.
+//
+function writeUTF16Str(str, ptr) {
+  for (let i = 0; i < str.length; ++i) {
+    HEAP16[ptr >> 1] = str.charCodeAt(i)
+    ptr += 2
+  }
+}
+
+
+// withTmpBytePtr takes an ArrayBuffer or Uint8Array and:
+// 1. copies it into the WASM module memory
+// 2. calls fn(pointer, size)
+// 3. calls free(pointer)
+//
+function withTmpBytePtr(buf, fn) {
+  const u8buf = bytebuf(buf)
+  const size = u8buf.length
+  const ptr = mallocbuf(u8buf, size)
+  const r = fn(ptr, size)
+  free(ptr)
+  return r
+}
+
+
+// withUTF16Str takes a JavaScript string and:
+// 1. copies it into the WASM module memory as UTF16, 16-bit aligned
+// 2. calls fn(aligned_pointer, bytesize)
+// 3. calls free(original_pointer)
+//
+function withUTF16Str(str, fn) {
+  let bytesize = str.length * 2
+  let ptr = _wrealloc(0, bytesize + 1) // +1 for alignment
+  let aligned_ptr = (ptr % 2 != 0) ? ptr + 1 : ptr
+  writeUTF16Str(str, aligned_ptr, bytesize)
+  let r = fn(aligned_ptr, bytesize)
+  free(ptr)
+  return r
+}
+
+
+function cstrlen(ptr) {
+  let end = ptr >> 0
+  while (HEAP8[end]) { end++ }
+  return end - ptr
+}
+
+
+// asciicstr interprets memory in buf at offset as an ASCII-encoded string,
+// and returns a JavaScript string.
+//
+function asciicstr(buf, offset) {
+  let str = ''
+  while (true) {
+    let b = buf[offset++ >> 0]
+    if (b == 0) { break }
+    str += String.fromCharCode(b)
+  }
+  return str
+}
+
+// cstrStack allocates a UTF-8 encoded version of str as a nul-terminated
+// "C string" on the stack.
+//
+function cstrStack(str) {
+  var ret = 0
+  if (str !== null && str !== undefined && str !== 0) {
+    var len = (str.length << 2) + 1
+    ret = stackAlloc(len)
+    stringToUTF8Array(str, HEAPU8, ret, len)
+  }
+  return ret
+}
+
+// used by strFromUTF8Ptr as a temporary address-sized integer
+let tmpPtr = 0
+
+Module.postRun.push(() => {
+  tmpPtr = _wrealloc(0, 4)
+})
+
+
+// strFromUTF8Ptr provides a pointer-sized integer that can be written
+// to by fn. fn is expected to return the number of bytes written to the
+// address pointed to by p. The address is dereferenced and the written
+// number of bytes are interpreted as UTF8, returning a JS string.
+//
+// This is useful for efficiently converting UTF8 strings that are
+// already allocated inside the library to JavaScript strings.
+//
+// Example:
+//   strFromUTF8Ptr((p)=> _FooGetName(ptr, p))
+//   ...
+//   u32 EXPORT FooGetName(Foo* f, const char** p) {
+//     *p = f->name_ptr;
+//     return f->name_len;
+//   }
+//
+// Synopsis:
+//   strFromUTF8Ptr( fn :(p:int)=>int )
+//
+function strFromUTF8Ptr(fn) {
+  let z = fn(tmpPtr)
+  let offs = HEAP32[tmpPtr >> 2]
+  return z == 0 ? "" : utf8.decode(HEAPU8.subarray(offs, offs + z))
+}
+
+// withOutPtr facilitates the following:
+//
+// 1. calls fn with an address to memory that fits a pointer.
+//    fn(outptr) is expected to:
+//    a. Write some data into heap memory
+//    b. Write the address of that data at outptr (i.e. *outptr = heapaddr)
+//    c. Return the length of data written
+//
+// 2. withOutPtr reads the address from outptr
+//    a. If the address is 0 (NULL), returns null
+//    b. Else a slice of the heap memory is created, starting at *outptr
+//       and ending at ((*outptr) + length_returned_by_fn).
+//       A free() function is added to the buffer and it is returned.
+//
+// It is important to free() the memory of the returned buffer when the caller is done.
+// This is implementation specific, so this function can not help you with that.
+//
+// The return type is as follows:
+//   interface HeapData extends Uint8Array {
+//     readonly heapAddr :number  // address in heap == *outptr
+//   }
+//
+// Example:
+//
+//   // WASM module, in C:
+//   typedef struct Color_ { char r, g, b; } Color;
+//   size_t newColor(const Color** outp) {
+//     Color* c = (Color*)malloc(sizeof(Color));
+//     c->r = 0xFF;
+//     c->g = 0xCA;
+//     c->b = 0x0;
+//     *outp = c;
+//     return sizeof(Color);
+//   }
+//   void freeColor(const Color* p) {
+//     free(p);
+//   }
+//
+//   // JavaScript
+//   let color = withOutPtr(_newColor)
+//   console.log("RGB:", color[0], color[1], color[2])
+//   _freeColor(color.heapAddr)
+//
+function withOutPtr(fn) {
+  let len = fn(tmpPtr)
+  let addr = HEAP32[tmpPtr >> 2]
+  if (addr == 0) {
+    return null
+  }
+  let buf = HEAPU8.subarray(addr, addr + len)
+  buf.heapAddr = addr
+  return buf
+}
+
+
+
+// withStackFrame saves the stack and calls fn; code in fn can then
+// allocate stack memory. When fn returns or throws, the stack is restored
+// to the point before this function was called.
+// Returns the return value of fn.
+//
+function withStackFrame(fn) {
+  let stack = stackSave()
+  try {
+    return fn()
+  } finally {
+    stackRestore(stack)
+  }
+}
+
+
+// ureadU16 reads a (little endian) unsigned 16-bit integer from buf at addr
+//
+function ureadU16(buf, addr) {
+  return ((buf[addr] | (buf[addr + 1] << 8))) >>> 0
+}
+
+// ureadI16 reads a (little endian) signed 16-bit integer from buf at addr
+//
+function ureadI16(buf, addr) {
+  let n = ((buf[addr]) | (buf[addr + 1] << 8))
+  return n >= 0x8000 ? n - 0x10000 : n
+}
+
+// ureadU32 reads a (little endian) unsigned 32-bit integer from buf at addr
+//
+function ureadU32(buf, addr) {
+  return (
+    (buf[addr + 3] << 24) |
+    (buf[addr + 2] << 16) |
+    (buf[addr + 1] << 8) |
+    (buf[addr] >>> 0)
+  ) >>> 0
+}
+
+// ureadU32 reads a (little endian) signed 32-bit integer from buf at addr
+//
+function ureadI32(buf, addr) {
+  return (
+    (buf[addr + 3] << 24) |
+    (buf[addr + 2] << 16) |
+    (buf[addr + 1] << 8) |
+    (buf[addr] >>> 0)
+  )
+}
+
+
+// export function ureadI16be(buf, addr) {
+//   let n = ((buf[addr] << 8) | (buf[addr + 1]))
+//   return n >= 0x8000 ? n - 0x10000 : n
+// }
+
+// export function ureadU16be(buf, addr) {
+//   return ((buf[addr] << 8) | (buf[addr + 1])) >>> 0
+// }
+
+// export function ureadU32be(buf, addr) {
+//   return (
+//     (buf[addr] << 24) |
+//     (buf[addr + 1] << 16) |
+//     (buf[addr + 2] << 8) |
+//     (buf[addr + 3])
+//   ) >>> 0
+// }
+
+// export function ureadI32be(buf, addr) {
+//   return (
+//     (buf[addr] << 24) |
+//     (buf[addr + 1] << 16) |
+//     (buf[addr + 2] << 8) |
+//     (buf[addr + 3])
+//   )
+// }
+
+
+// asciiStrToU32 converts a <=4 character string to a u32.
+// For example, string -> hb_tag_t
+//
+function asciiStrToU32(s) {
+  // Note: Should match #define HB_TAG(c1,c2,c3,c4) in hb-common.h
+  return (
+    ((s.charCodeAt(0) >>> 0) << 24) >>> 0 | // "">>> 0" u32 please
+    ((s.charCodeAt(1) >>> 0) << 16) |
+    ((s.charCodeAt(2) >>> 0) << 8) |
+     (s.charCodeAt(3) >>> 0)
+  )
+}
+
+const hbtag = asciiStrToU32
+
+// u32ToAsciiStr converts a u32 to a ASCII string
+// For example, hb_tag_t -> string
+//
+function u32ToAsciiStr(u) {
+  return String.fromCharCode(
+    ((u >> 24) & 0xff),
+    ((u >> 16) & 0xff),
+    ((u >>  8) & 0xff),
+    ((u >>  0) & 0xff)
+  )
+}
+
+// interface utf8 {
+//   encode(s :string) :Uint8Array
+//   decode(b :Uint8Array) :string
+// }
+const utf8 = typeof TextEncoder != 'undefined' ? (() => {
+  // Modern browsers
+  const enc = new TextEncoder("utf-8")
+  const dec = new TextDecoder("utf-8")
+  // TextDecoder does not accept views of shared memory (i.e. the heap of a
+  // threaded build), so those are copied first
+  const isShared = typeof SharedArrayBuffer != 'undefined' ?
+    b => b.buffer instanceof SharedArrayBuffer :
+    b => false
+  return {
+    encode: s => enc.encode(s),
+    decode: b => dec.decode(isShared(b) ? b.slice() : b),
+  };
+})() : typeof Buffer != 'undefined' ? {
+  // Nodejs
+  encode: s => new Uint8Array(Buffer.from(s, 'utf-8')),
+  decode: b =>
+    Buffer.from(b.buffer, b.byteOffset, b.byteLength).toString('utf8'),
+} : {
+  // Some other pesky JS environment
+  encode: s => {
+    let asciiBytes = [];
+    for (let i = 0, L = s.length; i != L; ++i) {
+      asciiBytes[i] = 0xff & s.charCodeAt(i);
+    }
+    return new Uint8Array(asciiBytes);
+  },
+  decode: b => String(b),
+}
+
+
+// Converts between 16.16 fixed-point number and 64-bit floating-point numbers
+function fixedToFloat(i) {
+  return i / 65536.0
+}
+function floatToFixed(f) {
+  return (f * 65536.0) >> 0
+}
+
+
+
+
+
+
+
+
+
+
+
+const ready = Module.ready
+
+// console.time('wasm load')
+// Module.postRun.push(() => {
+//   console.timeEnd('wasm load')
+// })
+
+const ParseFlags = {
+  COLLAPSE_WHITESPACE:         0x0001, // In TEXT, collapse non-trivial whitespace into single ' '
+  PERMISSIVE_ATX_HEADERS:      0x0002, // Do not require space in ATX headers ( ###header )
+  PERMISSIVE_URL_AUTO_LINKS:   0x0004, // Recognize URLs as links even without <...>
+  PERMISSIVE_EMAIL_AUTO_LINKS: 0x0008, // Recognize e-mails as links even without <...>
+  NO_INDENTED_CODE_BLOCKS:     0x0010, // Disable indented code blocks. (Only fenced code works)
+  NO_HTML_BLOCKS:              0x0020, // Disable raw HTML blocks.
+  NO_HTML_SPANS:               0x0040, // Disable raw HTML (inline).
+  TABLES:                      0x0100, // Enable tables extension.
+  STRIKETHROUGH:               0x0200, // Enable strikethrough extension.
+  PERMISSIVE_WWW_AUTOLINKS:    0x0400, // Enable WWW autolinks (without proto; just 'www.')
+  TASK_LISTS:                  0x0800, // Enable task list extension.
+  LATEX_MATH_SPANS:            0x1000, // Enable $ and $$ containing LaTeX equations.
+  WIKI_LINKS:                  0x2000, // Enable wiki links extension.
+  UNDERLINE:                   0x4000, // Enable underline extension (disables '_' for emphasis)
+
+  // Github style default flags
+  DEFAULT: 0x0001 | 0x0002 | 0x0004 | 0x0200 | 0x0100 | 0x0800,
+    // COLLAPSE_WHITESPACE
+    // PERMISSIVE_ATX_HEADERS
+    // PERMISSIVE_URL_AUTO_LINKS
+    // STRIKETHROUGH
+    // TABLES
+    // TASK_LISTS
+
+  NO_HTML: 0x0020 | 0x0040, // NO_HTML_BLOCKS | NO_HTML_SPANS
+}
+
+// Syntax tree records of the "binary" format, read by ASTReader.
+// These should be in sync with fmt_bin.h and md4c.h
+const ASTKind = { BLOCK: 1, SPAN: 2, END: 3, TEXT: 4, ATTR: 5 }
+
+const BlockType = {
+  DOC: 0, QUOTE: 1, UL: 2, OL: 3, LI: 4, HR: 5, H: 6, CODE: 7, HTML: 8, P: 9,
+  TABLE: 10, THEAD: 11, TBODY: 12, TR: 13, TH: 14, TD: 15,
+}
+
+const SpanType = {
+  EM: 0, STRONG: 1, A: 2, IMG: 3, CODE: 4, DEL: 5, LATEXMATH: 6, LATEXMATH_DISPLAY: 7,
+  WIKILINK: 8, U: 9,
+}
+
+const TextType = {
+  NORMAL: 0, NULLCHAR: 1, BR: 2, SOFTBR: 3, ENTITY: 4, CODE: 5, HTML: 6, LATEXMATH: 7,
+}
+
+const AttrType = { HREF: 1, TITLE: 2, SRC: 3, LANG: 4, INFO: 5, TARGET: 6 }
+
+const ASTFlags = { TIGHT: 1 << 1, TASK: 1 << 2, CHECKED: 1 << 3 }
+
+const AST_POOL = 1 << 0 // text is in the string pool rather than the source
+
+const DEFAULT_CHUNK_SIZE = 64 * 1024
+
+// these should be in sync with "OutputFlags" in common.h
+const OutputFlags = {
+  HTML:       1 << 0, // Output HTML
+  XHTML:      1 << 1, // Output XHTML (only has effect with HTML flag set)
+  AllowJSURI: 1 << 2, // Allow "javascript:" URIs
+  JSON:       1 << 3, // Output the syntax tree as JSON
+  Binary:     1 << 4, // Output the syntax tree as binary records
+}
+
+
+function parse(source, options) {
+  return parseWithCtx(source, options, 0)
+}
+
+
+// InputBuffer is a region of WASM memory holding markdown source which can be passed to
+// parse() and friends in place of a string or byte array. The parser then reads the
+// source right where it is, without copying it.
+// Call dispose() when the buffer is no longer needed.
+class InputBuffer {
+  constructor(capacity) {
+    this.ptr = 0
+    this.capacity = 0
+    this.length = 0  // number of valid bytes
+    reserve_input(this, capacity || 0)
+  }
+
+  // set writes source (a string or UTF-8 data) into the buffer, growing it as needed
+  set(source) {
+    write_input(this, source)
+  }
+
+  // bytes returns a view of the buffer's memory for writing UTF-8 data into directly,
+  // after which length should be set to the number of bytes written.
+  // The view must not be used after any other call into this module since the WASM
+  // memory may have grown, detaching the view.
+  bytes() {
+    return HEAPU8.subarray(this.ptr, this.ptr + this.capacity)
+  }
+
+  // reserve grows the buffer so that it can hold at least size bytes
+  reserve(size) {
+    reserve_input(this, size)
+  }
+
+  dispose() {
+    if (this.ptr) {
+      free(this.ptr)
+      this.ptr = 0
+      this.capacity = 0
+      this.length = 0
+    }
+  }
+}
+
+
+// Memory retained between calls, see setMemoryPolicy
+let maxRetained = 0  // bytes; 0 = no limit
+let idleRelease = 0  // milliseconds; 0 = never
+let lastUse = 0
+let idleTimer = null
+
+
+// setMemoryPolicy controls how much memory is kept around between calls for the internal
+// input and output buffers, which otherwise retain their largest size forever.
+//   maxRetained  buffers larger than this many bytes are freed after use
+//   idleRelease  release all memory when not used for this many milliseconds
+// Setting either to 0 (the default) disables it.
+function setMemoryPolicy(policy) {
+  maxRetained = policy.maxRetained || 0
+  idleRelease = policy.idleRelease || 0
+  _setOutbufMaxRetain(maxRetained)
+  if (maxRetained > 0 && heapInput.capacity > maxRetained)
+    release_input()
+  if (idleTimer) {
+    clearTimeout(idleTimer)
+    idleTimer = null
+  }
+  note_use()
+}
+
+
+// releaseMemory frees the internal input and output buffers. A result returned with the
+// bytes option is no longer valid afterwards. WASM memory can not shrink, but the memory
+// is reused for later calls rather than the WASM memory growing further.
+function releaseMemory() {
+  _releaseMemory()
+  if (!heapInputBusy)
+    release_input()
+}
+
+
+// release_output is called once the result of a call has been copied out of the output
+// buffer, to free it if it is larger than setMemoryPolicy allows
+function release_output() {
+  if (maxRetained > 0)
+    _outbufTrim()
+}
+
+
+// memoryUsage returns the current memory use of the module in bytes
+function memoryUsage() {
+  let p = _memoryUsage() >> 2
+  return {
+    memorySize:   HEAPU8.length,      // size of WASM memory (never shrinks)
+    heapSize:     HEAPU32[p + 2],     // memory obtained by malloc
+    heapUsed:     HEAPU32[p + 1],     // memory currently allocated
+    outputBuffer: HEAPU32[p],
+    inputBuffer:  heapInput.capacity,
+  }
+}
+
+
+function note_use() {
+  if (idleRelease > 0) {
+    lastUse = Date.now()
+    if (!idleTimer)
+      schedule_idle_release(idleRelease)
+  }
+}
+
+function schedule_idle_release(delay) {
+  idleTimer = setTimeout(() => {
+    idleTimer = null
+    let idle = Date.now() - lastUse
+    if (idle >= idleRelease) {
+      releaseMemory()
+    } else {
+      schedule_idle_release(idleRelease - idle)
+    }
+  }, delay)
+  // don't keep NodeJS processes alive
+  if (idleTimer.unref)
+    idleTimer.unref()
+}
+
+
+// parseChunked renders source like parse() but, rather than returning all the HTML at
+// once, passes it to onChunk in pieces of about options.chunkSize bytes (default 64 kB)
+// as it is produced. This keeps memory use low for very large documents.
+// A chunk is a view into WASM memory which is only valid during the call to onChunk;
+// use chunk.slice() to keep a copy.
+function parseChunked(source, onChunk, options) {
+  options = options || {}
+
+  let [parseFlags, outputFlags] = htmlOptionFlags(options, "parseChunked")
+  let chunkSize = options.chunkSize || DEFAULT_CHUNK_SIZE
+
+  let onCodeBlockPtr = options.onCodeBlock ? create_onCodeBlock_fn(options.onCodeBlock) : 0
+
+  let chunkErr = null
+  let onChunkPtr = addFunction(function(ptr, len) {
+    try {
+      onChunk(HEAPU8.subarray(ptr, ptr + len))
+      return 0
+    } catch (err) {
+      chunkErr = err
+      return -1  // abort
+    }
+  }, "iii")
+
+  with_input(source, (inptr, inlen) =>
+    _parseUTF8Stream(
+      inptr, inlen, parseFlags, outputFlags, onChunkPtr, chunkSize, onCodeBlockPtr, 0)
+  )
+
+  removeFunction(onChunkPtr)
+  if (options.onCodeBlock)
+    removeFunction(onCodeBlockPtr)
+
+  if (chunkErr) {
+    _WErrClear()
+    throw chunkErr
+  }
+  werrCheck()
+}
+
+
+// parseStream returns a ReadableStream of the HTML of source, in Uint8Array chunks.
+// The source is parsed by a ChunkedParser in pieces of options.chunkSize bytes (default
+// 64 kB) as the stream is read, so HTML is available before all of it has been parsed,
+// and a reader which falls behind holds up the parsing rather than the HTML queueing up.
+// The onCodeBlock option is not supported. In NodeJS, stream.Readable.fromWeb() turns
+// the stream into a Readable.
+function parseStream(source, options) {
+  let chunkSize = (options && options.chunkSize) || DEFAULT_CHUNK_SIZE
+  let isString = typeof source == "string"
+  if (!isString)
+    source = as_byte_array(source)
+  let offset = 0
+  let nchunks = 0
+  let parser = null
+  return new ReadableStream({
+    start(controller) {
+      parser = new ChunkedParser(chunk => {
+        // the chunk is a view into WASM memory which is only valid during this call
+        controller.enqueue(chunk.slice())
+        nchunks++
+      }, options)
+    },
+    pull(controller) {
+      try {
+        // write pieces of source until some HTML comes out or the source is all written
+        let n = nchunks
+        while (nchunks == n && offset < source.length) {
+          let end = Math.min(offset + chunkSize, source.length)
+          if (isString) {
+            if (end < source.length && (source.charCodeAt(end - 1) & 0xFC00) == 0xD800)
+              end++  // don't split a surrogate pair
+            parser.write(source.substring(offset, end))
+          } else {
+            parser.write(source.subarray(offset, end))
+          }
+          offset = end
+        }
+        if (offset == source.length) {
+          parser.end()
+          parser.dispose()
+          controller.close()
+        }
+      } catch (err) {
+        parser.dispose()
+        throw err
+      }
+    },
+    cancel() {
+      parser.dispose()
+    },
+  })
+}
+
+
+// ChunkedParser parses a document which is provided in chunks, e.g. as it arrives over
+// the network, passing its HTML to onChunk (like parseChunked) as soon as top-level blocks
+// are complete. Only the incomplete part of the document is kept in memory, unless it may
+// refer to link reference definitions yet to come, in which case the HTML from there on
+// is held back until end().
+// String chunks must not split surrogate pairs. UTF-8 chunks may be split anywhere.
+// Options are the same as for parse(), except for onCodeBlock which is not supported.
+// Call dispose() when the parser is no longer needed.
+class ChunkedParser {
+  constructor(onChunk, options) {
+    options = options || {}
+    if (options.onCodeBlock)
+      throw new Error("onCodeBlock is not supported by ChunkedParser")
+    let [parseFlags, outputFlags] = htmlOptionFlags(options, "ChunkedParser")
+    this.chunkErr = null
+    this.onChunkPtr = addFunction((ptr, len) => {
+      try {
+        onChunk(HEAPU8.subarray(ptr, ptr + len))
+        return 0
+      } catch (err) {
+        this.chunkErr = err
+        return -1  // abort
+      }
+    }, "iii")
+    this.ptr = _streamCreate(parseFlags, outputFlags, this.onChunkPtr)
+  }
+
+  // write adds source to the document
+  write(source) {
+    if (!this.ptr)
+      throw new Error("ChunkedParser has been disposed")
+    with_input(source, (inptr, inlen) => _streamWrite(this.ptr, inptr, inlen))
+    this._check()
+  }
+
+  // end completes the document. The parser can then be used for a new document.
+  end() {
+    if (!this.ptr)
+      throw new Error("ChunkedParser has been disposed")
+    _streamEnd(this.ptr)
+    this._check()
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _streamFree(this.ptr)
+      removeFunction(this.onChunkPtr)
+      this.ptr = 0
+    }
+  }
+
+  _check() {
+    let err = this.chunkErr
+    if (err) {
+      this.chunkErr = null
+      _WErrClear()
+      throw err
+    }
+    werrCheck()
+  }
+}
+
+
+// createParseStream returns a TransformStream which turns markdown, written to it in
+// chunks of text or UTF-8 data, into HTML, e.g.
+//   response.body.pipeThrough(createParseStream())
+function createParseStream(options) {
+  let parser
+  return new TransformStream({
+    start(controller) {
+      parser = new ChunkedParser(chunk => controller.enqueue(chunk.slice()), options)
+    },
+    transform(chunk) {
+      try {
+        parser.write(chunk)
+      } catch (err) {
+        parser.dispose()
+        throw err
+      }
+    },
+    flush() {
+      try {
+        parser.end()
+      } finally {
+        parser.dispose()
+      }
+    },
+  })
+}
+
+
+// parseBatch renders many documents in a single call into WASM, which is a lot faster
+// than calling parse() for each one when the documents are small.
+// Returns the HTML of each document, or with the bytes option set, the HTML of all
+// documents in one Uint8Array plus the offsets of each document's HTML in it.
+function parseBatch(sources, options) {
+  return parseBatchWithCtx(sources, options, 0)
+}
+
+
+// Parser is a reusable parser which keeps its internal memory (buffers and lookup tables)
+// around between calls to parse(). This makes parsing many small documents cheaper.
+// Call dispose() when the parser is no longer needed.
+class Parser {
+  constructor() {
+    this.ptr = _parserCreate()
+  }
+
+  parse(source, options) {
+    if (!this.ptr)
+      throw new Error("Parser has been disposed")
+    return parseWithCtx(source, options, this.ptr)
+  }
+
+  parseBatch(sources, options) {
+    if (!this.ptr)
+      throw new Error("Parser has been disposed")
+    return parseBatchWithCtx(sources, options, this.ptr)
+  }
+
+  // reset releases memory retained by the parser. The parser remains usable.
+  reset() {
+    if (this.ptr)
+      _parserReset(this.ptr)
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _parserDestroy(this.ptr)
+      this.ptr = 0
+    }
+  }
+}
+
+
+// RefDefs holds link reference definitions which are shared by many documents, like a
+// common footer, parsed once. Given as the refDefs option of parse(), they resolve links
+// to labels which the document does not define itself. Only options.parseFlags is used.
+// Call dispose() when no longer needed.
+class RefDefs {
+  constructor(source, options) {
+    let [parseFlags] = parseOptionFlags(options || {})
+    this.ptr = with_input(source, (inptr, inlen) => _refDefsCreate(inptr, inlen, parseFlags))
+    if (!this.ptr)
+      throw new Error("out of memory")
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _refDefsDestroy(this.ptr)
+      this.ptr = 0
+    }
+  }
+}
+
+
+// IncrementalParser keeps a document around so that, after an edit, only the top-level
+// blocks around the edit need to be parsed again. This is useful for live previews.
+// Options are the same as for parse(), except for onCodeBlock which is not supported.
+// Call dispose() when the parser is no longer needed.
+class IncrementalParser {
+  constructor(options) {
+    options = options || {}
+    if (options.onCodeBlock)
+      throw new Error("onCodeBlock is not supported by IncrementalParser")
+    let [parseFlags, outputFlags] = htmlOptionFlags(options, "IncrementalParser")
+    this.options = options
+    this.source = null
+    this.ptr = _incCreate(parseFlags, outputFlags)
+  }
+
+  // parse replaces the document with source and returns its HTML
+  parse(source) {
+    if (!this.ptr)
+      throw new Error("IncrementalParser has been disposed")
+    this.source = typeof source == "string" ? source : null
+    let outbuf = withOutPtr(outptr => with_input(source, (inptr, inlen) =>
+      _incSet(this.ptr, inptr, inlen, outptr)
+    ))
+    werrCheck()
+    return this._result(outbuf)
+  }
+
+  // edit replaces deleteCount characters at offset with text and returns the updated HTML.
+  // Offsets are in UTF-16 code units when the document was given as a string, and in
+  // bytes when it was given as UTF-8 data.
+  edit(offset, deleteCount, text) {
+    if (!this.ptr)
+      throw new Error("IncrementalParser has been disposed")
+    let off = offset, dellen = deleteCount
+    if (this.source !== null) {
+      if (typeof text != "string")
+        text = utf8.decode(as_byte_array(text))
+      let s = this.source
+      off = utf8_length(s, 0, offset)
+      dellen = utf8_length(s, offset, offset + deleteCount)
+      this.source = s.substr(0, offset) + text + s.substr(offset + deleteCount)
+    }
+    let outbuf = withOutPtr(outptr => with_input(text, (inptr, inlen) =>
+      _incEdit(this.ptr, off, dellen, inptr, inlen, outptr)
+    ))
+    werrCheck()
+    return this._result(outbuf)
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _incFree(this.ptr)
+      this.ptr = 0
+      this.source = null
+    }
+  }
+
+  _result(outbuf) {
+    outbuf = outbuf || new Uint8Array(0)
+    if (this.options.bytes || this.options.asMemoryView)
+      return outbuf
+    return utf8.decode(outbuf)
+  }
+}
+
+
+// ASTReader reads the syntax tree which parse() returns with format "binary" right
+// where it is in WASM memory (see fmt_bin.h for the layout), without creating any
+// objects other than for the strings asked for. Nodes are referred to by the index of
+// their record; the document is node 0. Like the result of parse() with the bytes
+// option, it is only valid until the next call into this module.
+//
+// Text and attributes refer to the source by offset where possible. When the source
+// passed to parse() was a Uint8Array, textBytes returns views of that array, and when
+// it was an ASCII string, text returns substrings of it, neither of which copies any
+// text nor depends on WASM memory staying as it is.
+class ASTReader {
+  constructor(outbuf, srcptr, source, srclen) {
+    let p = outbuf.heapAddr >> 2
+    this.bytes = outbuf           // the encoded tree
+    this.length = HEAPU32[p]      // number of records
+    this.rec = p + 4              // index in HEAPU32 of the first record
+    this.pool = outbuf.heapAddr + HEAPU32[p + 1]
+    this.src = srcptr
+    // the caller's source, when offsets into the UTF-8 source are offsets into it too
+    this.srcBytes = (source instanceof Uint8Array) ? source : null
+    this.srcString = (typeof source == "string" && source.length == srclen) ? source : null
+  }
+
+  kind(i)  { return HEAPU32[this.rec + i * 4] & 0xff }           // ASTKind
+  type(i)  { return (HEAPU32[this.rec + i * 4] >> 8) & 0xff }    // BlockType, SpanType, ...
+  flags(i) { return HEAPU32[this.rec + i * 4] >>> 16 }           // ASTFlags
+  a(i)     { return HEAPU32[this.rec + i * 4 + 1] }              // details, see fmt_bin.h
+  b(i)     { return HEAPU32[this.rec + i * 4 + 2] }
+
+  // end returns the index of the END record of block or span i
+  end(i) { return HEAPU32[this.rec + i * 4 + 3] }
+
+  // next returns the index of the record following node i and its contents
+  next(i) {
+    let k = this.kind(i)
+    return (k == ASTKind.BLOCK || k == ASTKind.SPAN) ? this.end(i) + 1 : i + 1
+  }
+
+  // attr returns the index of the attribute of block or span i of the given AttrType,
+  // or -1 if it has none
+  attr(i, type) {
+    for (let j = i + 1; j < this.length && this.kind(j) == ASTKind.ATTR; j++) {
+      if (this.type(j) == type)
+        return j
+    }
+    return -1
+  }
+
+  // offset returns the byte offset in the source of text or attribute i, or -1 if its
+  // bytes are not found verbatim in the source
+  offset(i) {
+    return (this.flags(i) & AST_POOL) ? -1 : this.a(i)
+  }
+
+  // textBytes returns a view of the UTF-8 bytes of text or attribute i
+  textBytes(i) {
+    let a = this.a(i)
+    if (this.flags(i) & AST_POOL)
+      return HEAPU8.subarray(this.pool + a, this.pool + a + this.b(i))
+    if (this.srcBytes)
+      return this.srcBytes.subarray(a, a + this.b(i))
+    return HEAPU8.subarray(this.src + a, this.src + a + this.b(i))
+  }
+
+  // text returns text or attribute i as a string
+  text(i) {
+    if (this.srcString && !(this.flags(i) & AST_POOL))
+      return this.srcString.substring(this.a(i), this.a(i) + this.b(i))
+    return utf8.decode(this.textBytes(i))
+  }
+
+  // textContent returns the text of node i and its contents, like the DOM property
+  textContent(i) {
+    let k = this.kind(i)
+    if (k == ASTKind.TEXT || k == ASTKind.ATTR)
+      return this.text(i)
+    let s = ""
+    for (let j = i + 1, end = this.end(i); j < end; j++) {
+      if (this.kind(j) != ASTKind.TEXT)
+        continue
+      switch (this.type(j)) {
+        case TextType.NULLCHAR: s += "\uFFFD"; break
+        case TextType.BR:
+        case TextType.SOFTBR:   s += "\n"; break
+        default:                s += this.text(j); break
+      }
+    }
+    return s
+  }
+}
+
+
+function parseOptionFlags(options) {
+  let parseFlags = (
+    options.parseFlags === undefined ? ParseFlags.DEFAULT :
+    options.parseFlags
+  )
+
+  let outputFlags = options.allowJSURIs ? OutputFlags.AllowJSURI : 0
+
+  switch (options.format) {
+    case "xhtml":
+      outputFlags |= OutputFlags.HTML | OutputFlags.XHTML
+      break
+
+    case "html":
+    case undefined:
+    case null:
+    case "":
+      outputFlags |= OutputFlags.HTML
+      break
+
+    case "json":
+      outputFlags |= OutputFlags.JSON
+      break
+
+    case "binary":
+      outputFlags |= OutputFlags.Binary
+      break
+
+    default:
+      throw new Error(`invalid format "${options.format}"`)
+  }
+
+  return [parseFlags, outputFlags]
+}
+
+
+// ref_defs_ptr returns the address of the RefDefs in options.refDefs, or 0 if none
+function ref_defs_ptr(options) {
+  if (!options.refDefs)
+    return 0
+  if (!options.refDefs.ptr)
+    throw new Error("RefDefs has been disposed")
+  return options.refDefs.ptr
+}
+
+
+// htmlOptionFlags is parseOptionFlags for functions which only produce HTML
+function htmlOptionFlags(options, funcname) {
+  let flags = parseOptionFlags(options)
+  if (flags[1] & (OutputFlags.JSON | OutputFlags.Binary))
+    throw new Error(`format "${options.format}" is not supported by ${funcname}`)
+  return flags
+}
+
+
+function parseWithCtx(source, options, ctxptr) {
+  options = options || {}
+
+  let [parseFlags, outputFlags] = parseOptionFlags(options)
+
+  let refDefsPtr = ref_defs_ptr(options)
+  let onCodeBlockPtr = options.onCodeBlock ? create_onCodeBlock_fn(options.onCodeBlock) : 0
+
+  let binary = (outputFlags & OutputFlags.Binary) != 0
+  let inputptr = 0, inputlen = 0
+  let outbuf = withOutPtr(outptr => with_input(source, (inptr, inlen) => {
+    inputptr = inptr
+    inputlen = inlen
+    return _parseUTF8(inptr, inlen, parseFlags, outputFlags, outptr, onCodeBlockPtr, ctxptr,
+                      options.threads || 1, options.stats ? 1 : 0, refDefsPtr)
+  }, binary))
+
+  if (options.onCodeBlock)
+    removeFunction(onCodeBlockPtr)
+
+  // check for error and throw if needed
+  werrCheck()
+
+  // DEBUG
+  // if (outbuf) {
+  //   console.log(utf8.decode(outbuf))
+  // }
+
+  if (binary) {
+    let ast = new ASTReader(outbuf, inputptr, source, inputlen)
+    if (options.stats)
+      return { ast, stats: read_stats(_parseStats(), inputlen) }
+    return ast
+  }
+
+  let view = options.bytes || options.asMemoryView
+
+  if (outputFlags & OutputFlags.JSON) {
+    let ast = view ? outbuf : JSON.parse(utf8.decode(outbuf))
+    if (!view)
+      release_output()
+    if (options.stats)
+      return { ast, stats: read_stats(_parseStats(), inputlen) }
+    return ast
+  }
+
+  let html = view ? outbuf : utf8.decode(outbuf)
+  if (!view)
+    release_output()
+
+  if (options.stats)
+    return { html, stats: read_stats(_parseStats(), inputlen) }
+
+  return html
+}
+
+
+// read_stats reads MD_STATS (md4c.h) at ptr, a struct of u64 fields
+function read_stats(ptr, inputlen) {
+  let u64 = i => HEAPU32[(ptr >> 2) + i * 2] + HEAPU32[(ptr >> 2) + i * 2 + 1] * 0x100000000
+  return {
+    bytes:         inputlen,
+    analyzeTime:   u64(0) / 1e6,
+    processTime:   u64(1) / 1e6,
+    scannedBytes:  u64(2),
+    marks:         u64(3),
+    rollbacks:     u64(4),
+    blocks:        u64(5),
+    containers:    u64(6),
+    refDefs:       u64(7),
+    refDefLookups: u64(8),
+  }
+}
+
+
+function parseBatchWithCtx(sources, options, ctxptr) {
+  options = options || {}
+
+  let [parseFlags, outputFlags] = htmlOptionFlags(options, "parseBatch")
+
+  let count = sources.length
+  let bufs = new Array(count)
+  let inlen = 0
+  for (let i = 0; i < count; i++) {
+    let source = sources[i]
+    bufs[i] = source instanceof InputBuffer ? source : as_byte_array(source)
+    inlen += bufs[i].length
+  }
+
+  let refDefsPtr = ref_defs_ptr(options)
+  let onCodeBlockPtr = options.onCodeBlock ? create_onCodeBlock_fn(options.onCodeBlock) : 0
+
+  // Everything goes into one heap allocation:
+  //   u32 inoffs[count+1], u32 outoffs[count+1], u8 input[inlen]
+  let tablesize = (count + 1) * 4
+  let inoffsptr = _wrealloc(0, tablesize * 2 + inlen)
+  let outoffsptr = inoffsptr + tablesize
+  let inptr = outoffsptr + tablesize
+  let inoff = 0
+  for (let i = 0; i < count; i++) {
+    HEAPU32[(inoffsptr >> 2) + i] = inoff
+    if (bufs[i] instanceof InputBuffer) {
+      HEAPU8.copyWithin(inptr + inoff, bufs[i].ptr, bufs[i].ptr + bufs[i].length)
+    } else {
+      HEAPU8.set(bufs[i], inptr + inoff)
+    }
+    inoff += bufs[i].length
+  }
+  HEAPU32[(inoffsptr >> 2) + count] = inoff
+
+  let outbuf, offsets
+  try {
+    outbuf = withOutPtr(outptr =>
+      _parseUTF8Batch(
+        inptr, inoffsptr, count, parseFlags, outputFlags, outptr, outoffsptr,
+        onCodeBlockPtr, ctxptr, refDefsPtr)
+    ) || new Uint8Array(0)
+    offsets = HEAPU32.slice(outoffsptr >> 2, (outoffsptr >> 2) + count + 1)
+  } finally {
+    free(inoffsptr)
+    note_use()
+    if (options.onCodeBlock)
+      removeFunction(onCodeBlockPtr)
+  }
+
+  werrCheck()
+
+  if (options.bytes || options.asMemoryView)
+    return { bytes: outbuf, offsets }
+
+  let results = new Array(count)
+  for (let i = 0; i < count; i++)
+    results[i] = utf8.decode(outbuf.subarray(offsets[i], offsets[i + 1]))
+  release_output()
+  return results
+}
+
+
+function create_onCodeBlock_fn(onCodeBlock) {
+  // See https://emscripten.org/docs/porting/connecting_cpp_and_javascript/
+  //   Interacting-with-code.html#calling-javascript-functions-as-function-pointers-from-c
+  //
+  // Function's C type: JSTextFilterFun
+  // (metaptr ptr, metalen ptr, inptr ptr, inlen ptr, outptr ptr) -> outlen int
+  const fnptr = addFunction(function(metaptr, metalen, inptr, inlen, outptr) {
+    try {
+      // lang is the "language" tag, if any, provided with the code block
+      const lang = metalen > 0 ? utf8.decode(HEAPU8.subarray(metaptr, metaptr + metalen)) : ""
+
+      // body is a view into heap memory of the segment of source (UTF8 bytes)
+      const body = HEAPU8.subarray(inptr, inptr + inlen)
+      let bodystr = undefined
+      body.toString = () => (bodystr || (bodystr = utf8.decode(body)))
+
+      // result is the result from the onCodeBlock function
+      let result = null
+      result = onCodeBlock(lang, body)
+
+      if (result === null || result === undefined) {
+        // Callback indicates that it does not wish to filter.
+        // The md.c implementation will html-encode the body.
+        return -1
+      }
+
+      let resbuf = as_byte_array(result)
+      if (resbuf.length > 0) {
+        // copy resbuf to WASM heap memory
+        const resptr = mallocbuf(resbuf, resbuf.length)
+        // write pointer value
+        HEAPU32[outptr >> 2 /* == outptr / 4 */] = resptr
+        // Note: fmt_html.c calls free(resptr)
+      }
+
+      return resbuf.length
+    } catch (err) {
+      console.error(`error in markdown onCodeBlock callback: ${err.stack||err}`)
+      return -1
+    }
+  }, "iiiiii")
+  return fnptr
+}
+
+
+// Sources which are not an InputBuffer are written into this buffer, which is kept
+// around between calls. Strings are UTF-8 encoded straight into it.
+const heapInput = { ptr: 0, capacity: 0, length: 0 }
+let heapInputBusy = false
+
+const encoder = (
+  typeof TextEncoder != "undefined" && TextEncoder.prototype.encodeInto ?
+    new TextEncoder() :
+    null
+)
+
+
+// with_input calls fn with the address and size of source in WASM memory.
+// With keep set, the internal input buffer is not released after the call, even when
+// larger than setMemoryPolicy allows, since the result refers to the source in it.
+function with_input(source, fn, keep) {
+  if (source instanceof InputBuffer)
+    return fn(source.ptr, source.length)
+  if (heapInputBusy) {
+    // called again from within fn, i.e. from an onCodeBlock callback
+    return withTmpBytePtr(as_byte_array(source), fn)
+  }
+  write_input(heapInput, source)
+  heapInputBusy = true
+  try {
+    return fn(heapInput.ptr, heapInput.length)
+  } finally {
+    heapInputBusy = false
+    if (maxRetained > 0 && heapInput.capacity > maxRetained && !keep)
+      release_input()
+    note_use()
+  }
+}
+
+
+function release_input() {
+  if (heapInput.ptr) {
+    free(heapInput.ptr)
+    heapInput.ptr = 0
+    heapInput.capacity = 0
+    heapInput.length = 0
+  }
+}
+
+
+// write_input writes source as UTF-8 into the memory of buf (heapInput or an InputBuffer),
+// growing it as needed
+function write_input(buf, source) {
+  if (source instanceof InputBuffer) {
+    reserve_input(buf, source.length)
+    HEAPU8.copyWithin(buf.ptr, source.ptr, source.ptr + source.length)
+    buf.length = source.length
+    return
+  }
+  if (typeof source == "string" && encoder) {
+    // Most text is ASCII, so start out assuming one byte per character. When that turns
+    // out to be too little, grow the buffer by exactly what the rest of the text needs.
+    reserve_input(buf, source.length)
+    let r = encoder.encodeInto(source, HEAPU8.subarray(buf.ptr, buf.ptr + buf.capacity))
+    let written = r.written
+    if (r.read < source.length) {
+      let rest = source.substring(r.read)
+      reserve_input(buf, written + utf8_length(rest, 0, rest.length))
+      written += encoder.encodeInto(
+        rest, HEAPU8.subarray(buf.ptr + written, buf.ptr + buf.capacity)).written
+    }
+    buf.length = written
+    return
+  }
+  let bytes = as_byte_array(source)
+  reserve_input(buf, bytes.length)
+  HEAPU8.set(bytes, buf.ptr)
+  buf.length = bytes.length
+}
+
+
+function reserve_input(buf, size) {
+  if (buf.capacity < size) {
+    // grow by at least 50% to avoid many small reallocations
+    let capacity = Math.max(size, buf.capacity + (buf.capacity >> 1))
+    buf.ptr = _wrealloc(buf.ptr, capacity)
+    buf.capacity = capacity
+  }
+}
+
+
+// utf8_length returns the number of bytes needed to UTF-8 encode s.substring(start, end)
+function utf8_length(s, start, end) {
+  let n = 0
+  for (let i = start; i < end; i++) {
+    let c = s.charCodeAt(i)
+    if (c < 0x80) {
+      n++
+    } else if (c < 0x800) {
+      n += 2
+    } else if (c >= 0xD800 && c <= 0xDBFF && i + 1 < end &&
+               (s.charCodeAt(i + 1) & 0xFC00) == 0xDC00) {
+      n += 4  // surrogate pair
+      i++
+    } else {
+      n += 3
+    }
+  }
+  return n
+}
+
+
+function as_byte_array(something) {
+  if (typeof something == "string")
+    return utf8.encode(something)
+  if (something instanceof InputBuffer)
+    return HEAPU8.slice(something.ptr, something.ptr + something.length)
+  if (something instanceof Uint8Array)
+    return something
+  return new Uint8Array(something)
+}
+
+// ——— start ———
+run(new WebAssembly.Instance(new WebAssembly.Module(WASM_DATA), wasmImports))
+exports.ready = ready
+exports.ParseFlags = ParseFlags
+exports.ASTKind = ASTKind
+exports.BlockType = BlockType
+exports.SpanType = SpanType
+exports.TextType = TextType
+exports.AttrType = AttrType
+exports.ASTFlags = ASTFlags
+exports.parse = parse
+exports.InputBuffer = InputBuffer
+exports.setMemoryPolicy = setMemoryPolicy
+exports.releaseMemory = releaseMemory
+exports.memoryUsage = memoryUsage
+exports.parseChunked = parseChunked
+exports.parseStream = parseStream
+exports.ChunkedParser = ChunkedParser
+exports.createParseStream = createParseStream
+exports.parseBatch = parseBatch
+exports.Parser = Parser
+exports.RefDefs = RefDefs
+exports.IncrementalParser = IncrementalParser
+exports.ASTReader = ASTReader
+})(typeof exports!='undefined'?exports:this["markdown-node"]={})
 //# sourceMappingURL=markdown.node.js.map
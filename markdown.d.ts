@@ -2,19 +2,416 @@
  * parse reads markdown source at s and converts it to HTML.
  * When output is a byte array, it will be a reference.
  */
+export function parse(s :Source, o :ParseOptions & { format :"binary", stats :true }) :ASTResult<ASTReader>
+export function parse(s :Source, o :ParseOptions & { format :"binary" }) :ASTReader
+export function parse(s :Source, o :ParseOptions & { format :"json", bytes? :never|false, stats :true }) :ASTResult
+export function parse(s :Source, o :ParseOptions & { format :"json", bytes? :never|false }) :ASTNode
+export function parse(s :Source, o :ParseOptions & { bytes? :never|false, stats :true }) :ParseResult<string>
+export function parse(s :Source, o :ParseOptions & { bytes :true, stats :true }) :ParseResult<Uint8Array>
 export function parse(s :Source, o? :ParseOptions & { bytes? :never|false }) :string
 export function parse(s :Source, o? :ParseOptions & { bytes :true }) :Uint8Array
 
-/** Markdown source code can be provided as a JavaScript string or UTF8 encoded data */
-type Source = string | ArrayLike<number>
+/**
+ * ParseResult is returned by parse() when the "stats" option is set.
+ */
+export interface ParseResult<T extends string|Uint8Array> {
+  html  :T
+  stats :ParseStats
+}
+
+/**
+ * ASTNode is a node of the syntax tree which parse() returns with format "json".
+ * With the "bytes" option set, parse() returns the tree as JSON text instead.
+ *
+ * Blocks:  doc, quote, ul, ol, li, hr, h, code, html, p, table, thead, tbody, tr, th, td
+ * Inlines: em, strong, u, del, code, a, img, wikilink, math, br, html, entity
+ *
+ * Numeric character references and &amp; &lt; &gt; &quot; &apos; are decoded into
+ * text. Other named entities are "entity" nodes with the reference in text.
+ */
+export interface ASTNode {
+  /** Type of node */
+  _ :string
+
+  /** Nodes and text contained by this node. Absent for "hr", "br", "html" and "entity". */
+  children? :(ASTNode|string)[]
+
+  /**
+   * Attributes, when set:
+   * ul: tight; ol: start, tight, delimiter; li: checked (task list items);
+   * h: level; code: lang, info; th, td: align; a: href, title; img: src, title;
+   * wikilink: target; math: display; html, entity: text
+   */
+  [attribute :string] :any
+}
+
+/**
+ * ASTResult is returned by parse() when the "stats" option is set with format "json"
+ * or "binary".
+ */
+export interface ASTResult<T extends ASTNode|ASTReader = ASTNode> {
+  ast   :T
+  stats :ParseStats
+}
+
+/**
+ * ASTReader reads the syntax tree which parse() returns with format "binary" right
+ * where it is in WASM memory, without creating objects other than the strings asked
+ * for. It is only valid until the next call to parse() or any other function of this
+ * module, like the result of parse() with the "bytes" option.
+ *
+ * The tree is a sequence of records, each referred to by its index. A block or span
+ * is followed by its attributes, its contents and an END record. The document is
+ * record 0. For example, the links of a document:
+ *
+ *   for (let i = 0; i < r.length; i++) {
+ *     if (r.kind(i) == ASTKind.SPAN && r.type(i) == SpanType.A)
+ *       links.push(r.text(r.attr(i, AttrType.HREF)))
+ *   }
+ *
+ * Text and attributes refer to the source by offset where possible. If the source
+ * given to parse() is a Uint8Array, textBytes() returns views of that array, and if
+ * it is an ASCII string, text() returns substrings of it. These copy no text and stay
+ * valid after other calls to this module.
+ *
+ * See src/fmt_bin.h for the details in a() and b() of each type of block.
+ */
+export class ASTReader {
+  /** The encoded tree */
+  readonly bytes :Uint8Array
+
+  /** Number of records */
+  readonly length :number
+
+  kind(i :number) :ASTKind
+  /** BlockType, SpanType, TextType or AttrType, depending on the kind */
+  type(i :number) :number
+  /** ASTFlags */
+  flags(i :number) :number
+  a(i :number) :number
+  b(i :number) :number
+
+  /** Index of the END record of block or span i */
+  end(i :number) :number
+
+  /** Index of the record following node i and its contents */
+  next(i :number) :number
+
+  /** Index of the attribute of block or span i of the given type, or -1 if none */
+  attr(i :number, type :AttrType) :number
+
+  /**
+   * Byte offset in the source of text or attribute i, or -1 if its bytes are not
+   * found verbatim in the source
+   */
+  offset(i :number) :number
+
+  /**
+   * View of the UTF-8 bytes of text or attribute i, of the source when it is a
+   * Uint8Array and the text is found verbatim in it (see offset())
+   */
+  textBytes(i :number) :Uint8Array
+
+  /** Text or attribute i as a string. Entities are not decoded. */
+  text(i :number) :string
+
+  /** Text of node i and its contents */
+  textContent(i :number) :string
+}
+
+export enum ASTKind { BLOCK = 1, SPAN, END, TEXT, ATTR }
+
+export enum BlockType {
+  DOC, QUOTE, UL, OL, LI, HR, H, CODE, HTML, P, TABLE, THEAD, TBODY, TR, TH, TD
+}
+
+export enum SpanType {
+  EM, STRONG, A, IMG, CODE, DEL, LATEXMATH, LATEXMATH_DISPLAY, WIKILINK, U
+}
+
+export enum TextType {
+  NORMAL, NULLCHAR, BR, SOFTBR, ENTITY, CODE, HTML, LATEXMATH
+}
+
+export enum AttrType {
+  /** A */        HREF = 1,
+  /** A, IMG */   TITLE,
+  /** IMG */      SRC,
+  /** CODE */     LANG,
+  /** CODE */     INFO,
+  /** WIKILINK */ TARGET,
+}
+
+export enum ASTFlags {
+  /** UL, OL: tight list */            TIGHT = 1 << 1,
+  /** LI: task list item */            TASK = 1 << 2,
+  /** LI: checked task list item */    CHECKED = 1 << 3,
+}
+
+/**
+ * ParseStats describes the work done to parse a document. Counts which are out of
+ * proportion to the size of the document point to pathological input.
+ */
+export interface ParseStats {
+  /** Size of the document in bytes (UTF-8) */
+  bytes :number
+
+  /**
+   * Time in milliseconds spent on analysis of the document's block structure,
+   * and on processing the blocks, i.e. parsing of inline content and rendering.
+   */
+  analyzeTime :number
+  processTime :number
+
+  /** Bytes of inline content scanned for potential delimiters */
+  scannedBytes :number
+
+  /** Potential inline delimiters found, and times they were rolled back */
+  marks     :number
+  rollbacks :number
+
+  /** Leaf blocks (paragraphs, headings, etc.) and container blocks (quotes, list items) */
+  blocks     :number
+  containers :number
+
+  /** Link reference definitions, and look-ups of link labels among them */
+  refDefs       :number
+  refDefLookups :number
+}
+
+/**
+ * parseChunked converts markdown to HTML like parse() but rather than returning all of
+ * the HTML at once, passes it to onChunk in pieces of about chunkSize bytes as it is
+ * produced. This keeps memory use low for very large documents.
+ * A chunk is only valid during the call to onChunk; use chunk.slice() to keep a copy.
+ */
+export function parseChunked(
+  s :Source,
+  onChunk :(chunk :Uint8Array) => void,
+  o? :ParseOptions & StreamOptions,
+) :void
+
+/**
+ * parseStream returns a stream of the HTML of markdown source s. The source is parsed in
+ * pieces of chunkSize bytes as the stream is read, so the HTML starts to arrive before
+ * all of it has been parsed, and parsing waits for a reader which falls behind.
+ * The onCodeBlock option is not supported.
+ * In NodeJS, stream.Readable.fromWeb() turns it into a Readable.
+ */
+export function parseStream(s :Source, o? :ParseOptions & StreamOptions) :ReadableStream<Uint8Array>
+
+/** Options for parseChunked and parseStream */
+export interface StreamOptions {
+  /**
+   * Approximate size in bytes of the chunks of HTML passed to onChunk by parseChunked,
+   * and of the pieces of source parsed at a time by parseStream. Defaults to 64 kB.
+   */
+  chunkSize? :number
+}
+
+/**
+ * ChunkedParser parses a document which is provided in chunks, e.g. as it arrives over
+ * the network, and passes its HTML to onChunk as soon as top-level blocks are complete.
+ * Only the incomplete part of the document is kept in memory, unless it may refer to
+ * link reference definitions yet to come, in which case the HTML from there on is held
+ * back until end(). The output is always the same as for parse().
+ *
+ * String chunks must not split surrogate pairs; UTF8 chunks may be split anywhere.
+ * A chunk passed to onChunk is only valid during the call; use chunk.slice() to keep it.
+ * The onCodeBlock option is not supported. Call dispose() when done with it.
+ */
+export class ChunkedParser {
+  constructor(onChunk :(chunk :Uint8Array) => void, o? :ParseOptions)
+
+  /** write adds s to the document */
+  write(s :Source) :void
+
+  /** end completes the document. The parser can then be used for another document. */
+  end() :void
+
+  /** dispose releases all resources of the parser. It can not be used afterwards. */
+  dispose() :void
+}
+
+/**
+ * createParseStream returns a TransformStream which turns markdown, written to it in
+ * chunks, into HTML. E.g. response.body.pipeThrough(createParseStream())
+ */
+export function createParseStream(o? :ParseOptions) :TransformStream<Source, Uint8Array>
+
+/**
+ * parseBatch converts many markdown documents to HTML in a single call, which is much
+ * faster than calling parse() for each of them when the documents are small.
+ * With the "bytes" option set, the HTML of all documents is returned in one byte array.
+ */
+export function parseBatch(s :Source[], o? :ParseOptions & { bytes? :never|false }) :string[]
+export function parseBatch(s :Source[], o? :ParseOptions & { bytes :true }) :BatchResult
+
+/**
+ * BatchResult holds the HTML of a batch of documents.
+ * The HTML of document i is bytes.subarray(offsets[i], offsets[i+1]).
+ * Like with parse(), bytes is only valid until the next call.
+ */
+export interface BatchResult {
+  bytes   :Uint8Array
+  offsets :Uint32Array
+}
+
+/**
+ * Parser is a reusable parser which retains its internal memory between calls to parse(),
+ * making it cheaper to parse many documents. Call dispose() when done with it.
+ */
+export class Parser {
+  constructor()
+
+  /** parse works like the parse function, reusing this parser's memory */
+  parse(s :Source, o :ParseOptions & { format :"binary", stats :true }) :ASTResult<ASTReader>
+  parse(s :Source, o :ParseOptions & { format :"binary" }) :ASTReader
+  parse(s :Source, o :ParseOptions & { format :"json", bytes? :never|false, stats :true }) :ASTResult
+  parse(s :Source, o :ParseOptions & { format :"json", bytes? :never|false }) :ASTNode
+  parse(s :Source, o :ParseOptions & { bytes? :never|false, stats :true }) :ParseResult<string>
+  parse(s :Source, o :ParseOptions & { bytes :true, stats :true }) :ParseResult<Uint8Array>
+  parse(s :Source, o? :ParseOptions & { bytes? :never|false }) :string
+  parse(s :Source, o? :ParseOptions & { bytes :true }) :Uint8Array
+
+  /** parseBatch works like the parseBatch function, reusing this parser's memory */
+  parseBatch(s :Source[], o? :ParseOptions & { bytes? :never|false }) :string[]
+  parseBatch(s :Source[], o? :ParseOptions & { bytes :true }) :BatchResult
+
+  /** reset releases memory retained by the parser. The parser remains usable. */
+  reset() :void
+
+  /** dispose releases all resources of the parser. It can not be used afterwards. */
+  dispose() :void
+}
+
+/**
+ * RefDefs holds link reference definitions which many documents share, like a common
+ * footer, parsed once. Pass it as the refDefs option instead of appending the definitions
+ * to every document. Anything in the source other than link reference definitions is
+ * ignored, and of the options only parseFlags is used. Call dispose() when done with it.
+ */
+export class RefDefs {
+  constructor(s :Source, o? :ParseOptions)
+
+  /** dispose releases the definitions. They can not be used afterwards. */
+  dispose() :void
+}
+
+/**
+ * IncrementalParser keeps a document around so that after an edit only the top-level blocks
+ * around the edit are parsed again, which is useful for live previews of large documents.
+ * Edits which change link reference definitions cause the whole document to be parsed.
+ * The onCodeBlock option is not supported. Call dispose() when done with it.
+ *
+ * Results are strings, or Uint8Arrays when the "bytes" option is set.
+ */
+export class IncrementalParser {
+  constructor(o? :ParseOptions)
+
+  /** parse replaces the document with s and returns its HTML */
+  parse(s :Source) :string|Uint8Array
+
+  /**
+   * edit replaces deleteCount characters at offset with text and returns the updated HTML.
+   * Offsets are in UTF-16 code units when the document was provided as a string,
+   * and in bytes when it was provided as UTF-8 data.
+   */
+  edit(offset :number, deleteCount :number, text :Source) :string|Uint8Array
+
+  /** dispose releases all resources of the parser. It can not be used afterwards. */
+  dispose() :void
+}
+
+/**
+ * setMemoryPolicy controls how much memory the internal buffers holding input and output
+ * retain between calls. By default they keep the size of the largest document forever.
+ */
+export function setMemoryPolicy(p :MemoryPolicy) :void
+
+export interface MemoryPolicy {
+  /** Free internal buffers larger than this many bytes after use. 0 (default) for no limit */
+  maxRetained? :number
+
+  /** Release memory when not used for this many milliseconds. 0 (default) for never */
+  idleRelease? :number
+}
+
+/**
+ * releaseMemory frees the internal buffers. A result returned with the "bytes" option is
+ * invalid afterwards. WASM memory can not shrink, but freed memory is reused by later calls
+ * rather than the WASM memory growing further.
+ */
+export function releaseMemory() :void
+
+/** memoryUsage returns the current memory use of the module */
+export function memoryUsage() :MemoryUsage
+
+/** Memory use in bytes */
+export interface MemoryUsage {
+  /** Size of WASM memory, which never shrinks */
+  memorySize :number
+
+  /** Memory obtained by malloc from WASM memory, and memory currently allocated */
+  heapSize :number
+  heapUsed :number
+
+  /** Capacity of the internal output and input buffers */
+  outputBuffer :number
+  inputBuffer  :number
+}
+
+/**
+ * Markdown source code can be provided as a JavaScript string, UTF8 encoded data or
+ * an InputBuffer holding UTF8 encoded data.
+ */
+type Source = string | ArrayLike<number> | InputBuffer
+
+/**
+ * InputBuffer is a region of WASM memory holding markdown source, which is read in place
+ * when passed to parse(). Call dispose() when done with it.
+ *
+ * Strings and byte arrays passed to parse() are written into an internal buffer like this
+ * one; use an InputBuffer when the source is produced or reused by your own code.
+ */
+export class InputBuffer {
+  constructor(capacity? :number)
+
+  /** Number of bytes of source in the buffer */
+  length :number
+
+  /** Allocated size of the buffer in bytes */
+  readonly capacity :number
+
+  /** set writes s into the buffer as UTF8, growing it as needed, and updates length */
+  set(s :Source) :void
+
+  /**
+   * bytes returns a view of the buffer's memory to write UTF8 data into directly.
+   * Set length to the number of bytes written afterwards.
+   * The view becomes invalid with the next call into this module.
+   */
+  bytes() :Uint8Array
+
+  /** reserve grows the buffer to hold at least size bytes */
+  reserve(size :number) :void
+
+  /** dispose frees the buffer's memory. It can not be used afterwards. */
+  dispose() :void
+}
 
 /** Options for the parse function */
 export interface ParseOptions {
   /** Customize parsing. Defaults to ParseFlags.DEFAULT */
   parseFlags? :ParseFlags
 
-  /** Select output format. Defaults to "html" */
-  format? : "html" | "xhtml"
+  /**
+   * Select output format. Defaults to "html".
+   * "json" produces the syntax tree of the document (see ASTNode) and "binary" the same
+   * in a form which is read in place (see ASTReader.) These are only supported by
+   * parse() and Parser.parse().
+   */
+  format? : "html" | "xhtml" | "json" | "binary"
 
   /**
    * bytes=true causes parse() to return the result as a Uint8Array instead of a string.
@@ -31,6 +428,13 @@ export interface ParseOptions {
   /** Allow "javascript:" in links */
   allowJSURIs? :boolean
 
+  /**
+   * Link reference definitions to resolve links with when the document does not define
+   * their label itself, as if they were appended to the document. Only supported by
+   * parse(), parseBatch() and the same methods of Parser.
+   */
+  refDefs? :RefDefs
+
   /**
    * Optional callback which if provided is called for each code block.
    * langname holds the "language tag", if any, of the block.
@@ -46,6 +450,21 @@ export interface ParseOptions {
    */
   onCodeBlock? :(langname :string, body :UTF8Bytes) => Uint8Array|string|null|undefined
 
+  /**
+   * Number of threads to render large documents on. Defaults to 1.
+   *
+   * Only has an effect with the threaded build (markdown.threads.es.js), which requires
+   * SharedArrayBuffer support (i.e. a cross-origin isolated page in browsers), and for
+   * documents larger than about 64kB. Ignored when onCodeBlock is set.
+   */
+  threads? :number
+
+  /**
+   * Collect statistics of the work done to parse the document. parse() then returns
+   * the HTML along with the statistics (see ParseResult.)
+   */
+  stats? :boolean
+
   /** @depreceated use "bytes" instead (v1.1.1) */
   asMemoryView? :boolean
 }
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+Generates src/md4c_unicode.h, the Unicode tables of md4c.c, from the Unicode
+database of the Python running this script (see unicodedata.unidata_version):
+
+  whitespace   category Zs
+  punctuation  categories Pc, Pd, Pe, Pf, Pi, Po and Ps
+  case folding full case folding (str.casefold)
+
+Each table is looked up in two steps: the page (codepoint >> 8) selects one of
+the distinct 256-codepoint blocks of the table, which is a bitmap for
+whitespace and punctuation and an index into a list of foldings for case
+folding. Pages beyond the last one with any entries are left out.
+
+Run `make unicode` to regenerate the file.
+"""
+import sys, unicodedata
+
+PAGE_BITS = 8
+PAGE_SIZE = 1 << PAGE_BITS
+N_CODEPOINTS = 0x110000
+
+
+def pages_of(values):
+  """Splits values (one per codepoint) into a page index and distinct pages."""
+  n_pages = N_CODEPOINTS // PAGE_SIZE
+  while n_pages > 0 and not any(values[(n_pages - 1) * PAGE_SIZE : n_pages * PAGE_SIZE]):
+    n_pages -= 1
+  zero = (0,) * PAGE_SIZE
+  distinct = {zero: 0}
+  index = []
+  for p in range(n_pages):
+    page = tuple(values[p * PAGE_SIZE : (p + 1) * PAGE_SIZE])
+    if page not in distinct:
+      distinct[page] = len(distinct)
+    index.append(distinct[page])
+  return index, sorted(distinct, key=distinct.get)
+
+
+def c_array(items, fmt, per_line, indent="    "):
+  lines = []
+  for i in range(0, len(items), per_line):
+    lines.append(indent + ", ".join(fmt % x for x in items[i : i + per_line]) + ",")
+  return "\n".join(lines)
+
+
+def bitmap_table(name, desc, pred):
+  values = [1 if pred(cp) else 0 for cp in range(N_CODEPOINTS)]
+  index, pages = pages_of(values)
+  assert len(pages) <= 256
+  words = []
+  for page in pages:
+    for w in range(PAGE_SIZE // 32):
+      words.append(sum(bit << i for i, bit in enumerate(page[w * 32 : (w + 1) * 32])))
+  return (
+    "/* %s */\n" % desc +
+    "#define MD_%s_N_PAGES %d\n" % (name, len(index)) +
+    "static const unsigned char MD_%s_PAGES[%d] = {\n%s\n};\n" % (name, len(index), c_array(index, "%d", 24)) +
+    "static const unsigned MD_%s_BITS[%d][%d] = {\n%s\n};\n" % (
+      name, len(pages), PAGE_SIZE // 32, c_array(
+        ["{ " + ", ".join("0x%08x" % w for w in words[i : i + PAGE_SIZE // 32]) + " }"
+         for i in range(0, len(words), PAGE_SIZE // 32)], "%s", 1))
+  )
+
+
+def fold_table():
+  # Foldings to a single codepoint are stored as the difference to the
+  # codepoint, which many share; others as the codepoints they fold to.
+  cases = {(0, 0, 0, 0): 0}
+  values = []
+  for cp in range(N_CODEPOINTS):
+    folded = chr(cp).casefold() if not 0xd800 <= cp < 0xe000 else chr(cp)
+    if folded == chr(cp):
+      values.append(0)
+      continue
+    if len(folded) == 1:
+      case = (1, ord(folded) - cp, 0, 0)
+    else:
+      assert len(folded) <= 3
+      case = (len(folded),) + tuple(ord(c) for c in folded) + (0,) * (3 - len(folded))
+    if case not in cases:
+      cases[case] = len(cases)
+    values.append(cases[case])
+  assert len(cases) <= 256
+  index, pages = pages_of(values)
+  assert len(pages) <= 256
+  case_list = sorted(cases, key=cases.get)
+  return (
+    "/* Case folding: MD_FOLD_CASES[MD_FOLD_INDEX[MD_FOLD_PAGES[cp >> 8]][cp & 0xff]]\n"
+    " * is { 1, delta } for folding to cp + delta, { n, cp1, ..., cpn } for folding\n"
+    " * to n codepoints, or { 0 } for codepoints which fold to themselves. */\n" +
+    "#define MD_FOLD_N_PAGES %d\n" % len(index) +
+    "static const unsigned char MD_FOLD_PAGES[%d] = {\n%s\n};\n" % (len(index), c_array(index, "%d", 24)) +
+    "static const unsigned char MD_FOLD_INDEX[%d][%d] = {\n%s\n};\n" % (
+      len(pages), PAGE_SIZE, "\n".join(
+        "    {\n" + c_array(page, "%d", 32, "        ") + "\n    },"
+        for page in pages)) +
+    "static const int MD_FOLD_CASES[%d][4] = {\n%s\n};\n" % (
+      len(case_list), c_array(["{ %d, %d, %d, %d }" % c for c in case_list], "%s", 6))
+  )
+
+
+def main():
+  out = sys.argv[1] if len(sys.argv) > 1 else "src/md4c_unicode.h"
+  text = (
+    "/* Unicode tables of md4c.c, generated by misc/gen_unicode_tables.py from\n"
+    " * Unicode %s. Do not edit. */\n\n" % unicodedata.unidata_version +
+    bitmap_table("WHITESPACE", "Unicode \"Zs\" category.",
+                 lambda cp: unicodedata.category(chr(cp)) == "Zs") + "\n" +
+    bitmap_table("PUNCT", "Unicode \"Pc\", \"Pd\", \"Pe\", \"Pf\", \"Pi\", \"Po\", \"Ps\" categories.",
+                 lambda cp: unicodedata.category(chr(cp)).startswith("P")) + "\n" +
+    fold_table()
+  )
+  with open(out, "w") as f:
+    f.write(text)
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,207 @@
+// mdwasm: command-line markdown to HTML converter; the native build of the
+// same engine that is compiled to WebAssembly (see Makefile)
+#include "common.h"
+#include "fmt_html.h"
+#include "fmt_json.h"
+#include <stdio.h>
+#include <errno.h>
+
+#define DEFAULT_PARSE_FLAGS ( \
+  MD_FLAG_COLLAPSEWHITESPACE | \
+  MD_FLAG_PERMISSIVEATXHEADERS | \
+  MD_FLAG_PERMISSIVEURLAUTOLINKS | \
+  MD_FLAG_STRIKETHROUGH | \
+  MD_FLAG_TABLES | \
+  MD_FLAG_TASKLISTS )
+
+static const char* prog = "mdwasm";
+
+static void usage(FILE* f) {
+  fprintf(f,
+    "usage: %s [options] [<file> ...]\n"
+    "Converts markdown to HTML. Reads stdin when no files are given.\n"
+    "options:\n"
+    "  -o <file>       Write output to <file> instead of stdout\n"
+    "  -x, --xhtml     Produce XHTML\n"
+    "  --json          Produce the syntax tree as JSON (see src/fmt_json.h)\n"
+    "  -f <flags>      md4c parse flags (see ParseFlags in markdown.d.ts)\n"
+    "                  Defaults to 0x%04x\n"
+    "  -j <n>          Render large documents on up to <n> threads\n"
+    "  -c <size>       Write output in chunks of about <size> bytes as it is\n"
+    "                  produced, rather than all at once when done\n"
+    "  -r <file>       Resolve links which the input does not define with the\n"
+    "                  link reference definitions in <file>\n"
+    "  --allow-js-uri  Allow \"javascript:\" URIs in links\n"
+    "  -h, --help      Show this help and exit\n",
+    prog, DEFAULT_PARSE_FLAGS);
+}
+
+static int read_file(FILE* f, WBuf* buf) {
+  for (;;) {
+    WBufReserve(buf, 64 * 1024);
+    size_t n = fread(buf->ptr, 1, WBufAvail(buf), f);
+    buf->ptr += n;
+    if (n == 0)
+      return ferror(f) ? -1 : 0;
+  }
+}
+
+static int write_chunk(const char* data, size_t len, void* fmt) {
+  FILE* outf = (FILE*)((FmtHTML*)fmt)->userdata;
+  return fwrite(data, 1, len, outf) == len ? 0 : -1;
+}
+
+static unsigned long parse_number(const char* opt, const char* s) {
+  char* end;
+  if (!s) {
+    fprintf(stderr, "%s: missing value for %s\n", prog, opt);
+    exit(1);
+  }
+  unsigned long n = strtoul(s, &end, 0);
+  if (*s == 0 || *end != 0) {
+    fprintf(stderr, "%s: invalid value for %s: %s\n", prog, opt, s);
+    exit(1);
+  }
+  return n;
+}
+
+int main(int argc, char** argv) {
+  const char* outfile = NULL;
+  u32 parserFlags = DEFAULT_PARSE_FLAGS;
+  OutputFlags flags = OutputFlagHTML;
+  u32 nthreads = 1;
+  u32 chunksize = 0;
+  const char* refdefsfile = NULL;
+  int nfiles = 0;
+
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    if (arg[0] != '-' || strcmp(arg, "-") == 0) {
+      argv[1 + nfiles++] = argv[i];
+    } else if (strcmp(arg, "-o") == 0) {
+      if (!(outfile = argv[++i])) {
+        fprintf(stderr, "%s: missing value for %s\n", prog, arg);
+        return 1;
+      }
+    } else if (strcmp(arg, "-x") == 0 || strcmp(arg, "--xhtml") == 0) {
+      flags |= OutputFlagXHTML;
+    } else if (strcmp(arg, "--json") == 0) {
+      flags |= OutputFlagJSON;
+    } else if (strcmp(arg, "-f") == 0) {
+      parserFlags = (u32)parse_number(arg, argv[++i]);
+    } else if (strcmp(arg, "-j") == 0) {
+      nthreads = (u32)parse_number(arg, argv[++i]);
+    } else if (strcmp(arg, "-c") == 0) {
+      chunksize = (u32)parse_number(arg, argv[++i]);
+    } else if (strcmp(arg, "-r") == 0) {
+      if (!(refdefsfile = argv[++i])) {
+        fprintf(stderr, "%s: missing value for %s\n", prog, arg);
+        return 1;
+      }
+    } else if (strcmp(arg, "--allow-js-uri") == 0) {
+      flags |= OutputFlagAllowJSURI;
+    } else if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+      usage(stdout);
+      return 0;
+    } else {
+      fprintf(stderr, "%s: unknown option %s\n", prog, arg);
+      usage(stderr);
+      return 1;
+    }
+  }
+
+  FILE* outf = stdout;
+  if (outfile && !(outf = fopen(outfile, "wb"))) {
+    fprintf(stderr, "%s: %s: %s\n", prog, outfile, strerror(errno));
+    return 1;
+  }
+
+  WBuf src = {0};
+  WBuf out = {0};
+  MD_REF_DEFS* refdefs = NULL;
+  int status = 0;
+
+  if (refdefsfile) {
+    FILE* f = fopen(refdefsfile, "rb");
+    if (!f || read_file(f, &src) != 0) {
+      fprintf(stderr, "%s: %s: %s\n", prog, refdefsfile, f ? "read error" : strerror(errno));
+      return 1;
+    }
+    fclose(f);
+    refdefs = md_ref_defs_create(src.start, (MD_SIZE)WBufLen(&src), parserFlags);
+  }
+
+  MD_PARSER_CTX* mdctx = md_ctx_create();
+
+  for (int i = 0; i < (nfiles > 0 ? nfiles : 1); i++) {
+    const char* filename = nfiles > 0 ? argv[1 + i] : "-";
+    FILE* f = strcmp(filename, "-") == 0 ? stdin : fopen(filename, "rb");
+    if (!f) {
+      fprintf(stderr, "%s: %s: %s\n", prog, filename, strerror(errno));
+      status = 1;
+      continue;
+    }
+    // src is reused from file to file; clear what is left of a longer previous one
+    size_t prevlen = WBufLen(&src);
+    WBufReset(&src);
+    int err = read_file(f, &src);
+    if (f != stdin)
+      fclose(f);
+    if (WBufLen(&src) < prevlen)
+      memset(src.ptr, 0, prevlen - WBufLen(&src));
+    if (err) {
+      fprintf(stderr, "%s: %s: read error\n", prog, filename);
+      status = 1;
+      continue;
+    }
+
+    out.ptr = out.start;
+    if (flags & OutputFlagJSON) {
+      WBufReserve(&out, fmt_json_outsize(src.start, WBufLen(&src)));
+      FmtJSON fmt = {
+        .flags = flags,
+        .parserFlags = parserFlags,
+        .outbuf = &out,
+        .mdctx = mdctx,
+        .refDefs = refdefs,
+      };
+      if (fmt_json(src.start, (u32)WBufLen(&src), &fmt) != 0) {
+        fprintf(stderr, "%s: %s: failed to parse\n", prog, filename);
+        status = 1;
+        continue;
+      }
+      fwrite(out.start, 1, WBufLen(&out), outf);
+      continue;
+    }
+    WBufReserve(&out, chunksize ? chunksize * 2 : fmt_html_outsize(src.start, WBufLen(&src)));
+    FmtHTML fmt = {
+      .flags = flags,
+      .parserFlags = parserFlags,
+      .outbuf = &out,
+      .mdctx = mdctx,
+      .refDefs = refdefs,
+      .onFlush = chunksize ? write_chunk : NULL,
+      .flushSize = chunksize,
+      .userdata = outf,
+    };
+    if (fmt_html_parallel(src.start, (u32)WBufLen(&src), &fmt, nthreads) != 0) {
+      fprintf(stderr, "%s: %s: failed to parse\n", prog, filename);
+      status = 1;
+      continue;
+    }
+    if (!chunksize)
+      fwrite(out.start, 1, WBufLen(&out), outf);
+  }
+
+  if (fflush(outf) != 0 || ferror(outf)) {
+    fprintf(stderr, "%s: write error\n", prog);
+    status = 1;
+  }
+  if (outf != stdout)
+    fclose(outf);
+  md_ctx_destroy(mdctx);
+  md_ref_defs_destroy(refdefs);
+  WBufFree(&src);
+  WBufFree(&out);
+  return status;
+}
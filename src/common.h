@@ -66,6 +66,8 @@ typedef enum OutputFlags {
   OutputFlagHTML       = 1 << 0,
   OutputFlagXHTML      = 1 << 1,
   OutputFlagAllowJSURI = 1 << 2, // allow "javascript:" URIs in links
+  OutputFlagJSON       = 1 << 3, // syntax tree as JSON (see fmt_json.h)
+  OutputFlagBinary     = 1 << 4, // syntax tree as binary records (see fmt_bin.h)
 } OutputFlags;
 
 typedef int(*JSTextFilterFun)(
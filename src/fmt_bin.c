@@ -0,0 +1,249 @@
+#include <string.h>
+
+#include "common.h"
+#include "fmt_bin.h"
+#include "md4c.h"
+
+
+// write_record appends a record and returns its index
+static u32 write_record(FmtBin* r, u32 kind, u32 type, u32 flags, u32 a, u32 b, u32 c) {
+  u32 rec[4] = { kind | (type << 8) | (flags << 16), a, b, c };
+  WBufAppendBytes(r->outbuf, rec, sizeof(rec));
+  r->lasttext = false;
+  return r->nrecords++;
+}
+
+// text_ref returns the offset of text in the source, or copies it to the pool and
+// returns its offset there with *flags |= BIN_POOL
+static u32 text_ref(FmtBin* r, const MD_CHAR* text, MD_SIZE size, u32* flags) {
+  if (text >= r->input && text + size <= r->input + r->inputlen)
+    return (u32)(text - r->input);
+  u32 off = (u32)WBufLen(&r->pool);
+  WBufAppendBytes(&r->pool, text, size);
+  *flags |= BIN_POOL;
+  return off;
+}
+
+static bool has_nullchar(const MD_ATTRIBUTE* attr) {
+  for (u32 i = 0; attr->substr_offsets[i] < attr->size; i++) {
+    if (attr->substr_types[i] == MD_TEXT_NULLCHAR)
+      return true;
+  }
+  return false;
+}
+
+static void write_attr(FmtBin* r, BinAttr type, const MD_ATTRIBUTE* attr) {
+  if (attr->text == NULL)
+    return;
+  u32 flags = 0;
+  u32 off;
+  if (!has_nullchar(attr)) {
+    // md4c only copies attributes with backslash escapes, so this is usually found
+    // in the source, entities and all
+    off = text_ref(r, attr->text, attr->size, &flags);
+  } else {
+    // NUL characters are replaced with U+FFFD as in text
+    static const char ucReplacementUTF8[] = { 0xef, 0xbf, 0xbd };
+    off = (u32)WBufLen(&r->pool);
+    for (u32 i = 0; attr->substr_offsets[i] < attr->size; i++) {
+      MD_OFFSET beg = attr->substr_offsets[i];
+      MD_OFFSET end = attr->substr_offsets[i+1];
+      if (attr->substr_types[i] == MD_TEXT_NULLCHAR) {
+        WBufAppendBytes(&r->pool, ucReplacementUTF8, sizeof(ucReplacementUTF8));
+      } else {
+        WBufAppendBytes(&r->pool, attr->text + beg, end - beg);
+      }
+    }
+    flags |= BIN_POOL;
+    write_record(r, BIN_ATTR, type, flags, off, (u32)WBufLen(&r->pool) - off, 0);
+    return;
+  }
+  write_record(r, BIN_ATTR, type, flags, off, attr->size, 0);
+}
+
+// open_node writes the record of a block or span, the c of which is set by close_node
+static void open_node(FmtBin* r, u32 kind, u32 type, u32 flags, u32 a, u32 b) {
+  u32 index = write_record(r, kind, type, flags, a, b, 0);
+  WBufAppendBytes(&r->stack, &index, sizeof(index));
+}
+
+static void close_node(FmtBin* r) {
+  r->stack.ptr -= sizeof(u32);
+  u32 index;
+  memcpy(&index, r->stack.ptr, sizeof(index));
+  u32 end = write_record(r, BIN_END, 0, 0, 0, 0, 0);
+  // offset rather than pointer as outbuf may have been reallocated since
+  char* rec = r->outbuf->start + r->start + BIN_HEADER_SIZE + (size_t)index * BIN_RECORD_SIZE;
+  memcpy(rec + 12, &end, sizeof(end));
+}
+
+
+static int enter_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata) {
+  FmtBin* r = (FmtBin*)userdata;
+  u32 flags = 0, a = 0, b = 0;
+
+  switch (type) {
+    case MD_BLOCK_UL: {
+      const MD_BLOCK_UL_DETAIL* d = (const MD_BLOCK_UL_DETAIL*)detail;
+      flags = d->is_tight ? BIN_TIGHT : 0;
+      a = (u8)d->mark;
+      break;
+    }
+    case MD_BLOCK_OL: {
+      const MD_BLOCK_OL_DETAIL* d = (const MD_BLOCK_OL_DETAIL*)detail;
+      flags = d->is_tight ? BIN_TIGHT : 0;
+      a = d->start;
+      b = (u8)d->mark_delimiter;
+      break;
+    }
+    case MD_BLOCK_LI: {
+      const MD_BLOCK_LI_DETAIL* d = (const MD_BLOCK_LI_DETAIL*)detail;
+      if (d->is_task) {
+        flags = BIN_TASK | ((d->task_mark == 'x' || d->task_mark == 'X') ? BIN_CHECKED : 0);
+        a = d->task_mark_offset;
+      }
+      break;
+    }
+    case MD_BLOCK_H:
+      a = ((const MD_BLOCK_H_DETAIL*)detail)->level;
+      break;
+    case MD_BLOCK_CODE: {
+      const MD_BLOCK_CODE_DETAIL* d = (const MD_BLOCK_CODE_DETAIL*)detail;
+      open_node(r, BIN_BLOCK, type, 0, (u8)d->fence_char, 0);
+      write_attr(r, BIN_ATTR_LANG, &d->lang);
+      write_attr(r, BIN_ATTR_INFO, &d->info);
+      return 0;
+    }
+    case MD_BLOCK_TH:
+    case MD_BLOCK_TD:
+      a = ((const MD_BLOCK_TD_DETAIL*)detail)->align;
+      break;
+    default:
+      break;
+  }
+
+  open_node(r, BIN_BLOCK, type, flags, a, b);
+  return 0;
+}
+
+static int leave_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata) {
+  close_node((FmtBin*)userdata);
+  return 0;
+}
+
+static int enter_span_callback(MD_SPANTYPE type, void* detail, void* userdata) {
+  FmtBin* r = (FmtBin*)userdata;
+
+  open_node(r, BIN_SPAN, type, 0, 0, 0);
+
+  switch (type) {
+    case MD_SPAN_A:
+      write_attr(r, BIN_ATTR_HREF, &((const MD_SPAN_A_DETAIL*)detail)->href);
+      write_attr(r, BIN_ATTR_TITLE, &((const MD_SPAN_A_DETAIL*)detail)->title);
+      break;
+    case MD_SPAN_IMG:
+      write_attr(r, BIN_ATTR_SRC, &((const MD_SPAN_IMG_DETAIL*)detail)->src);
+      write_attr(r, BIN_ATTR_TITLE, &((const MD_SPAN_IMG_DETAIL*)detail)->title);
+      break;
+    case MD_SPAN_WIKILINK:
+      write_attr(r, BIN_ATTR_TARGET, &((const MD_SPAN_WIKILINK_DETAIL*)detail)->target);
+      break;
+    default:
+      break;
+  }
+
+  return 0;
+}
+
+static int leave_span_callback(MD_SPANTYPE type, void* detail, void* userdata) {
+  close_node((FmtBin*)userdata);
+  return 0;
+}
+
+static int text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata) {
+  FmtBin* r = (FmtBin*)userdata;
+
+  switch (type) {
+    case MD_TEXT_NULLCHAR:
+    case MD_TEXT_BR:
+    case MD_TEXT_SOFTBR:
+      write_record(r, BIN_TEXT, type, 0, 0, 0, 0);
+      break;
+
+    default: {
+      // Text which continues the previous text record in the source, like the lines
+      // of a code block, is added to it. md4c passes the newlines of code and HTML
+      // blocks as "\n" literals, which match the newlines in the source.
+      if (r->lasttext && type == r->lasttype && r->lastend + size <= r->inputlen &&
+          (text == r->input + r->lastend ||
+           (size == 1 && *text == '\n' && r->input[r->lastend] == '\n')))
+      {
+        r->lastend += size;
+        char* rec = r->outbuf->ptr - BIN_RECORD_SIZE;
+        u32 len;
+        memcpy(&len, rec + 8, sizeof(len));
+        len += size;
+        memcpy(rec + 8, &len, sizeof(len));
+        break;
+      }
+      u32 flags = 0;
+      u32 off = text_ref(r, text, size, &flags);
+      write_record(r, BIN_TEXT, type, flags, off, size, 0);
+      if (!(flags & BIN_POOL)) {
+        r->lasttext = true;
+        r->lasttype = type;
+        r->lastend = off + size;
+      }
+      break;
+    }
+  }
+
+  return 0;
+}
+
+
+// Typical documents produce one record per 10-15 bytes of input, plus a little
+// text in the string pool.
+size_t fmt_bin_outsize(const char* input, size_t len) {
+  return BIN_HEADER_SIZE + (len / 8 + 16) * BIN_RECORD_SIZE;
+}
+
+
+int fmt_bin(const MD_CHAR* input, MD_SIZE input_size, FmtBin* fmt) {
+  fmt->input = input;
+  fmt->inputlen = input_size;
+  fmt->start = WBufLen(fmt->outbuf);
+  fmt->nrecords = 0;
+  WBufInit(&fmt->pool);
+  WBufInit(&fmt->stack);
+
+  u32 header[4] = { 0, 0, 0, BIN_VERSION };
+  WBufAppendBytes(fmt->outbuf, header, sizeof(header));
+
+  MD_PARSER parser = {
+    .flags = fmt->parserFlags,
+    .enter_block = enter_block_callback,
+    .leave_block = leave_block_callback,
+    .enter_span = enter_span_callback,
+    .leave_span = leave_span_callback,
+    .text = text_callback,
+    .stats = fmt->stats,
+    .ref_defs = fmt->refDefs,
+  };
+
+  int res = fmt->mdctx ?
+    md_ctx_parse(fmt->mdctx, input, input_size, &parser, (void*)fmt) :
+    md_parse(input, input_size, &parser, (void*)fmt);
+
+  if (res == 0) {
+    header[0] = fmt->nrecords;
+    header[1] = (u32)(WBufLen(fmt->outbuf) - fmt->start);
+    header[2] = (u32)WBufLen(&fmt->pool);
+    memcpy(fmt->outbuf->start + fmt->start, header, sizeof(header));
+    WBufAppendBytes(fmt->outbuf, fmt->pool.start, WBufLen(&fmt->pool));
+  }
+
+  WBufFree(&fmt->pool);
+  WBufFree(&fmt->stack);
+  return res;
+}
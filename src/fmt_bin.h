@@ -0,0 +1,88 @@
+#pragma once
+#include "md4c.h"
+
+// FmtBin encodes the syntax tree of a document as fixed-size records which can be
+// read in place (see ASTReader in md.js), without any parsing or decoding.
+//
+// The output starts with a header of four u32:
+//   [0] number of records
+//   [1] offset of the string pool in bytes, from the start of the output
+//   [2] size of the string pool in bytes
+//   [3] format version (BIN_VERSION)
+// followed by the records, each four u32:
+//   [0] kind (bits 0-7), type (bits 8-15) and flags (bits 16-31)
+//   [1] a
+//   [2] b
+//   [3] c
+//
+// A block or span (BIN_BLOCK, BIN_SPAN) is followed by its attributes (BIN_ATTR), if
+// any, then its content, then a BIN_END record; c is the index of that BIN_END record.
+// The type is the MD_BLOCKTYPE or MD_SPANTYPE. a and b hold details:
+//   UL     a = bullet character, flags BIN_TIGHT
+//   OL     a = start number, b = delimiter character, flags BIN_TIGHT
+//   LI     flags BIN_TASK and BIN_CHECKED, a = offset of the task mark in the source
+//   H      a = level (1-6)
+//   CODE   a = fence character (0 for indented code blocks)
+//   TH/TD  a = MD_ALIGN
+//
+// Text (BIN_TEXT, type is the MD_TEXTTYPE) and attributes (BIN_ATTR, type is a
+// BinAttr) refer to their bytes by a = offset and b = length. The offset is into the
+// source unless flags has BIN_POOL set, in which case it is into the string pool;
+// text is only copied into the pool when it is not found verbatim in the source, as
+// is the case for e.g. attributes with backslash escapes and the text of autolinks
+// with an implied "http://" or "mailto:". Consecutive runs of text of the same type
+// which are adjacent in the source, like the lines of a code block, are joined into
+// one record. MD_TEXT_NULLCHAR, MD_TEXT_BR and MD_TEXT_SOFTBR text has no bytes.
+// Entities are not decoded, neither in text (MD_TEXT_ENTITY) nor in attributes.
+
+#define BIN_VERSION 1
+#define BIN_HEADER_SIZE 16
+#define BIN_RECORD_SIZE 16
+
+// record kinds
+enum { BIN_BLOCK = 1, BIN_SPAN, BIN_END, BIN_TEXT, BIN_ATTR };
+
+// record flags
+enum {
+  BIN_POOL    = 1 << 0, // text: offset is into the string pool
+  BIN_TIGHT   = 1 << 1, // UL, OL: tight list
+  BIN_TASK    = 1 << 2, // LI: task list item
+  BIN_CHECKED = 1 << 3, // LI: checked task list item
+};
+
+// attribute types
+typedef enum BinAttr {
+  BIN_ATTR_HREF = 1, // A
+  BIN_ATTR_TITLE,    // A, IMG
+  BIN_ATTR_SRC,      // IMG
+  BIN_ATTR_LANG,     // CODE
+  BIN_ATTR_INFO,     // CODE
+  BIN_ATTR_TARGET,   // WIKILINK
+} BinAttr;
+
+typedef struct FmtBin {
+  u32            parserFlags; // passed along to md_parse
+  WBuf*          outbuf;
+  MD_PARSER_CTX* mdctx;       // optional reusable parser context (see md_ctx_create)
+  const MD_REF_DEFS* refDefs; // optional shared link reference definitions
+
+  // optional: parser statistics to add to (see MD_STATS in md4c.h)
+  MD_STATS* stats;
+
+  // internal state
+  const char* input;
+  u32         inputlen;
+  size_t      start; // offset in outbuf of the header
+  u32         nrecords;
+  WBuf        pool;
+  WBuf        stack; // indices (u32) of the open blocks and spans
+  bool        lasttext; // the last record is text from the source, which
+  u32         lasttype; // is of this type and ends at this offset
+  u32         lastend;
+} FmtBin;
+
+int fmt_bin(const char* input, u32 inputlen, FmtBin* fmt);
+
+// fmt_bin_outsize returns an estimate of the size of the output for input, for
+// reserving space in outbuf up front.
+size_t fmt_bin_outsize(const char* input, size_t inputlen);
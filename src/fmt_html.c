@@ -23,12 +23,14 @@
  * IN THE SOFTWARE.
  */
 
+#include <stddef.h>
 #include <string.h>
 #include <ctype.h>
 #include <strings.h>
 
 #include "common.h"
 #include "fmt_html.h"
+#include "html_escape.h"
 #include "md4c.h"
 
 // typedef struct FmtHTML_st {
@@ -39,25 +41,6 @@
 // } FmtHTML;
 
 
-static char htmlEscapeMap[256] = {
-        /* 0 1 2 3 4 5 6 7 8 9 A B C D E F */
-/* 0x00 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // <CTRL> ...
-/* 0x10 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // <CTRL> ...
-/* 0x20 */ 0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,  //   ! " # $ % & ' ( ) * + , - . /
-/* 0x30 */ 0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,  // 0 1 2 3 4 5 6 7 8 9 : ; < = > ?
-/* 0x40 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // @ A B C D E F G H I J K L M N O
-/* 0x50 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // P Q R S T U V W X Y Z [ \ ] ^ _
-/* 0x60 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // ` a b c d e f g h i j k l m n o
-/* 0x70 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // p q r s t u v w x y z { | } ~ <DEL>
-/* 0x80 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // <CTRL> ...
-/* 0x90 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // <CTRL> ...
-/* 0xA0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // <NBSP> ¡ ¢ £ ¤ ¥ ¦ § ¨ © ª « ¬ <SOFTHYPEN> ® ¯
-/* 0xB0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // ° ± ² ³ ´ µ ¶ · ¸ ¹ º » ¼ ½ ¾ ¿
-/* 0xC0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // À Á Â Ã Ä Å Æ Ç È É Ê Ë Ì Í Î Ï
-/* 0xD0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // Ð Ñ Ò Ó Ô Õ Ö × Ø Ù Ú Û Ü Ý Þ ß
-/* 0xE0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // à á â ã ä å æ ç è é ê ë ì í î ï
-/* 0xF0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // ð ñ ò ó ô õ ö ÷ ø ù ú û ü ý þ ÿ
-};
 
 static const char ucReplacementUTF8[] = { 0xef, 0xbf, 0xbd };
 
@@ -70,50 +53,110 @@ static inline void render_literal(FmtHTML* r, const char* cs) {
   WBufAppendBytes(r->outbuf, cs, strlen(cs));
 }
 
+// Direct output of inline content by the parser (see MD_HTML_OUTPUT in md4c.h) is
+// enabled whenever the renderer does not need to see that content: it is disabled
+// while looking for the first text of a heading (for its anchor), inside the alt
+// text of images and when counting brackets.
+static inline void update_html_output(FmtHTML* r) {
+  r->html.enabled = r->imgnest == 0 && !r->addanchor && !r->countBrackets;
+}
+
+// MD_HTML_BUFFER has the same layout as WBuf, so that outbuf can be passed as one
+static_assert(sizeof(MD_HTML_BUFFER) == sizeof(WBuf), "MD_HTML_BUFFER size");
+static_assert(offsetof(MD_HTML_BUFFER, start) == offsetof(WBuf, start), "MD_HTML_BUFFER.start");
+static_assert(offsetof(MD_HTML_BUFFER, end) == offsetof(WBuf, end), "MD_HTML_BUFFER.end");
+static_assert(offsetof(MD_HTML_BUFFER, ptr) == offsetof(WBuf, ptr), "MD_HTML_BUFFER.ptr");
+
+static void reserve_html_output(MD_HTML_BUFFER* buf, MD_SIZE size) {
+  WBufReserve((WBuf*)buf, size);
+}
+
+static MD_HTML_OUTPUT* get_html_output(void* userdata) {
+  return &((FmtHTML*)userdata)->html;
+}
+
+static void init_html_output(FmtHTML* r) {
+  r->html.buf = (MD_HTML_BUFFER*)r->outbuf;
+  r->html.reserve = reserve_html_output;
+  update_html_output(r);
+}
+
+// passes the contents of outbuf to onFlush and empties it
+static int flush(FmtHTML* r) {
+  int res = r->onFlush(r->outbuf->start, WBufLen(r->outbuf), r);
+  WBufReset(r->outbuf);
+  return res;
+}
+
+static inline int maybe_flush(FmtHTML* r) {
+  if (r->onFlush && WBufLen(r->outbuf) >= r->flushSize)
+    return flush(r);
+  return 0;
+}
+
 static inline void render_char(FmtHTML* r, char c) {
   WBufAppendc(r->outbuf, c);
 }
 
 
 static void render_html_escaped(FmtHTML* r, const char* data, size_t size) {
-  MD_OFFSET beg = 0;
-  MD_OFFSET off = 0;
-
-  /* Some characters need to be escaped in normal HTML text. */
-  #define HTML_NEED_ESCAPE(ch)  (htmlEscapeMap[(unsigned char)(ch)] != 0)
-
-  while (1) {
-    while (
-      off + 3 < size &&
-      !HTML_NEED_ESCAPE(data[off+0]) &&
-      !HTML_NEED_ESCAPE(data[off+1]) &&
-      !HTML_NEED_ESCAPE(data[off+2]) &&
-      !HTML_NEED_ESCAPE(data[off+3])
-    ) {
-      off += 4;
-    }
+  WBuf* b = r->outbuf;
+  // When the worst case does not fit, reserve what is actually needed rather than
+  // growing outbuf beyond the size reserved with the help of fmt_html_outsize.
+  if (WBufAvail(b) < size * 6)
+    WBufReserve(b, html_escaped_len(data, size));
+  b->ptr = html_escape(b->ptr, data, size);
+}
 
-    while (off < size && !HTML_NEED_ESCAPE(data[off])) {
-      off++;
-    }
 
-    if (off > beg) {
-      render_text(r, data + beg, off - beg);
-    }
+// Estimated number of bytes of HTML produced per run of each byte, beyond the byte
+// itself. Runs rather than bytes are counted since a run like "```" or "###" is one
+// piece of markup. The weights were fitted to test/benchmark/samples; they somewhat
+// overestimate typical documents so that outbuf rarely needs to grow.
+static const u8 outsizeRunWeight[256] = {
+  ['\n'] = 4,  // block tags, e.g. "<p>" & "</p>\n" or "<li>" & "</li>\n"
+  ['<']  = 3,  // "&lt;"
+  ['>']  = 5,  // "&gt;" or "<blockquote>\n"
+  ['&']  = 4,  // "&amp;"
+  ['"']  = 5,  // "&quot;"
+  ['*']  = 5,  // "<em>" & "</em>"
+  ['_']  = 5,
+  ['~']  = 4,  // "<del>" & "</del>"
+  ['`']  = 8,  // "<code>" & "</code>"
+  ['[']  = 16, // "<a href=\"\">" & "</a>", plus a copy of the href for references
+  ['#']  = 40, // heading anchor "<a id=\"slug\" class=\"anchor\" ...></a>"
+  ['|']  = 8,  // "<td>" & "</td>\n"
+};
 
-    if (off < size) {
-      switch (data[off]) {
-        case '&': render_literal(r, "&amp;");  break;
-        case '<': render_literal(r, "&lt;");   break;
-        case '>': render_literal(r, "&gt;");   break;
-        case '"': render_literal(r, "&quot;"); break;
-      }
-      off++;
-    } else {
-      break;
-    }
-    beg = off;
+// Inputs larger than this are estimated from OUTSIZE_NSAMPLES evenly spaced samples
+#define OUTSIZE_SAMPLE_LEN  4096
+#define OUTSIZE_NSAMPLES    16
+
+static size_t outsize_extra(const u8* p, const u8* end) {
+  size_t extra = 0;
+  u8 prev = 0;
+  for (; p < end; p++) {
+    u8 c = *p;
+    extra += c != prev ? outsizeRunWeight[c] : 0;
+    prev = c;
+  }
+  return extra;
+}
+
+size_t fmt_html_outsize(const char* input, size_t len) {
+  const u8* p = (const u8*)input;
+  size_t extra;
+  if (len <= OUTSIZE_SAMPLE_LEN * OUTSIZE_NSAMPLES) {
+    extra = outsize_extra(p, p + len);
+  } else {
+    size_t stride = len / OUTSIZE_NSAMPLES;
+    extra = 0;
+    for (u32 i = 0; i < OUTSIZE_NSAMPLES; i++)
+      extra += outsize_extra(p + i*stride, p + i*stride + OUTSIZE_SAMPLE_LEN);
+    extra = (size_t)((double)extra * len / (OUTSIZE_SAMPLE_LEN * OUTSIZE_NSAMPLES));
   }
+  size_t n = len + extra;
+  return n + n/16 + 64;
 }
 
 
@@ -217,12 +260,12 @@ static void render_open_code_block(FmtHTML* r, const MD_BLOCK_CODE_DETAIL* det)
   r->codeBlockNest++;
 }
 
-static void render_close_code_block(FmtHTML* r, const MD_BLOCK_CODE_DETAIL* det) {
+static void render_close_code_block(FmtHTML* r, const MD_BLOCK_CODE_DETAIL* det, bool codecb) {
   dlog("end code block (lang \"%.*s\")", (int)det->lang.size, det->lang.text);
 
   r->codeBlockNest--;
 
-  if (r->onCodeBlock) {
+  if (codecb) {
     const char* text = r->tmpbuf.start;
     size_t len = WBufLen(&r->tmpbuf);
 
@@ -285,15 +328,17 @@ static void render_open_img_span(FmtHTML* r, const MD_SPAN_IMG_DETAIL* det) {
   render_attribute(r, &det->src);
   render_literal(r, "\" alt=\"");
   r->imgnest++;
+  update_html_output(r);
 }
 
-static void render_close_img_span(FmtHTML* r, const MD_SPAN_IMG_DETAIL* det) {
+static void render_close_img_span(FmtHTML* r, const MD_SPAN_IMG_DETAIL* det, bool xhtml) {
   if(det->title.text != NULL) {
     render_literal(r, "\" title=\"");
     render_attribute(r, &det->title);
   }
-  render_literal(r, (r->flags & OutputFlagXHTML) ? "\"/>" : "\">");
+  render_literal(r, xhtml ? "\"/>" : "\">");
   r->imgnest--;
+  update_html_output(r);
 }
 
 static void render_open_wikilink_span(FmtHTML* r, const MD_SPAN_WIKILINK_DETAIL* det) {
@@ -309,9 +354,13 @@ static void render_open_wikilink_span(FmtHTML* r, const MD_SPAN_WIKILINK_DETAIL*
 
 
 
-static int enter_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata) {
+// The callbacks below take the output options as constant arguments and are always
+// inlined into the specialized renderers defined by RENDERER further down, which lets
+// the compiler drop the tests for options not in use.
+#define RENDER_INLINE static inline __attribute__((always_inline))
+
+RENDER_INLINE int on_enter_block(FmtHTML* r, MD_BLOCKTYPE type, void* detail, const bool xhtml) {
   static const MD_CHAR* head[6] = { "<h1>", "<h2>", "<h3>", "<h4>", "<h5>", "<h6>" };
-  FmtHTML* r = (FmtHTML*) userdata;
 
   switch(type) {
     case MD_BLOCK_DOC:   /* noop */ break;
@@ -319,11 +368,12 @@ static int enter_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata)
     case MD_BLOCK_UL:    render_literal(r, "<ul>\n"); break;
     case MD_BLOCK_OL:    render_open_ol_block(r, (const MD_BLOCK_OL_DETAIL*)detail); break;
     case MD_BLOCK_LI:    render_open_li_block(r, (const MD_BLOCK_LI_DETAIL*)detail); break;
-    case MD_BLOCK_HR:    render_literal(r, (r->flags & OutputFlagXHTML) ? "<hr/>\n" : "<hr>\n"); break;
+    case MD_BLOCK_HR:    render_literal(r, xhtml ? "<hr/>\n" : "<hr>\n"); break;
     case MD_BLOCK_H:
     {
       render_literal(r, head[((MD_BLOCK_H_DETAIL*)detail)->level - 1]);
       r->addanchor = 1;
+      update_html_output(r);
       break;
     }
     case MD_BLOCK_CODE:  render_open_code_block(r, (const MD_BLOCK_CODE_DETAIL*) detail); break;
@@ -340,9 +390,10 @@ static int enter_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata)
   return 0;
 }
 
-static int leave_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata) {
+RENDER_INLINE int on_leave_block(
+  FmtHTML* r, MD_BLOCKTYPE type, void* detail, const bool codecb, const bool flushing)
+{
   static const MD_CHAR* head[6] = { "</h1>\n", "</h2>\n", "</h3>\n", "</h4>\n", "</h5>\n", "</h6>\n" };
-  FmtHTML* r = (FmtHTML*) userdata;
 
   switch(type) {
     case MD_BLOCK_DOC:   /*noop*/ break;
@@ -351,8 +402,14 @@ static int leave_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata)
     case MD_BLOCK_OL:    render_literal(r, "</ol>\n"); break;
     case MD_BLOCK_LI:    render_literal(r, "</li>\n"); break;
     case MD_BLOCK_HR:    /*noop*/ break;
-    case MD_BLOCK_H:     render_literal(r, head[((MD_BLOCK_H_DETAIL*)detail)->level - 1]); break;
-    case MD_BLOCK_CODE:  render_close_code_block(r, (const MD_BLOCK_CODE_DETAIL*)detail); break;
+    case MD_BLOCK_H:
+    {
+      render_literal(r, head[((MD_BLOCK_H_DETAIL*)detail)->level - 1]);
+      r->addanchor = 0; // in case the heading is empty
+      update_html_output(r);
+      break;
+    }
+    case MD_BLOCK_CODE:  render_close_code_block(r, (const MD_BLOCK_CODE_DETAIL*)detail, codecb); break;
     case MD_BLOCK_HTML:  /* noop */ break;
     case MD_BLOCK_P:     render_literal(r, "</p>\n"); break;
     case MD_BLOCK_TABLE: render_literal(r, "</table>\n"); break;
@@ -363,7 +420,7 @@ static int leave_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata)
     case MD_BLOCK_TD:    render_literal(r, "</td>\n"); break;
   }
 
-  return 0;
+  return flushing ? maybe_flush(r) : 0;
 }
 
 static int enter_span_callback(MD_SPANTYPE type, void* detail, void* userdata) {
@@ -404,14 +461,12 @@ static int enter_span_callback(MD_SPANTYPE type, void* detail, void* userdata) {
   return 0;
 }
 
-static int leave_span_callback(MD_SPANTYPE type, void* detail, void* userdata) {
-  FmtHTML* r = (FmtHTML*) userdata;
-
+RENDER_INLINE int on_leave_span(FmtHTML* r, MD_SPANTYPE type, void* detail, const bool xhtml) {
   if(r->imgnest > 0) {
     /* Ditto as in enter_span_callback(), except we have to allow the
      * end of the <img> tag. */
     if(r->imgnest == 1  &&  type == MD_SPAN_IMG)
-      render_close_img_span(r, (MD_SPAN_IMG_DETAIL*) detail);
+      render_close_img_span(r, (MD_SPAN_IMG_DETAIL*) detail, xhtml);
     return 0;
   }
 
@@ -431,27 +486,30 @@ static int leave_span_callback(MD_SPANTYPE type, void* detail, void* userdata) {
   return 0;
 }
 
-static int text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata) {
-  FmtHTML* r = (FmtHTML*) userdata;
-
-  if (r->codeBlockNest && r->onCodeBlock) {
+RENDER_INLINE int on_text(
+  FmtHTML* r, MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size,
+  const bool xhtml, const bool codecb, const bool flushing)
+{
+  if (codecb && r->codeBlockNest) {
     WBufAppendBytes(&r->tmpbuf, text, size);
     return 0;
   }
 
   if (r->addanchor) {
     r->addanchor = 0;
+    update_html_output(r);
     if (type != MD_TEXT_NULLCHAR && type != MD_TEXT_BR && type != MD_TEXT_SOFTBR) {
       render_literal(r, "<a id=\"");
 
-      const char* slugptr = r->outbuf->ptr;
+      // offset rather than pointer, as outbuf may be reallocated below
+      size_t slugoff = WBufLen(r->outbuf);
       size_t sluglen = WBufAppendSlug(r->outbuf, text, size);
 
       render_literal(r, "\" class=\"anchor\" aria-hidden=\"true\" href=\"#");
 
       if (sluglen > 0) {
         WBufReserve(r->outbuf, sluglen);
-        memcpy(r->outbuf->ptr, slugptr, sluglen);
+        memcpy(r->outbuf->ptr, r->outbuf->start + slugoff, sluglen);
         r->outbuf->ptr += sluglen;
       }
 
@@ -464,50 +522,170 @@ static int text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, vo
     case MD_TEXT_BR:
       render_literal(
         r,
-        r->imgnest == 0 ?
-          ((r->flags & OutputFlagXHTML) ? "<br/>\n" : "<br>\n") :
-          " "
+        r->imgnest == 0 ? (xhtml ? "<br/>\n" : "<br>\n") : " "
       );
       break;
 
-    render_literal(r, (r->flags & OutputFlagXHTML) ? "<hr/>\n" : "<hr>\n"); break;
-
     case MD_TEXT_SOFTBR:    render_literal(r, (r->imgnest == 0 ? "\n" : " ")); break;
     case MD_TEXT_HTML:      render_text(r, text, size); break;
     case MD_TEXT_ENTITY:    render_text(r, text, size); break;
-    default:                render_html_escaped(r, text, size); break;
+    default:
+      if (r->countBrackets && type == MD_TEXT_NORMAL && memchr(text, ']', size))
+        r->brackets++;
+      render_html_escaped(r, text, size);
+      break;
   }
 
-  return 0;
+  return flushing ? maybe_flush(r) : 0;
+}
+
+
+// Renderer is a set of callbacks for MD_PARSER
+typedef struct Renderer {
+  int (*enter_block)(MD_BLOCKTYPE type, void* detail, void* userdata);
+  int (*leave_block)(MD_BLOCKTYPE type, void* detail, void* userdata);
+  int (*enter_span)(MD_SPANTYPE type, void* detail, void* userdata);
+  int (*leave_span)(MD_SPANTYPE type, void* detail, void* userdata);
+  int (*text)(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata);
+} Renderer;
+
+// RENDERER defines the renderer NAME, specialized for XHTML output, an onCodeBlock
+// callback and streamed output (onFlush) being used or not
+#define RENDERER(NAME, XHTML, CODECB, FLUSH) \
+  static int NAME##_enter_block(MD_BLOCKTYPE type, void* detail, void* userdata) { \
+    return on_enter_block((FmtHTML*)userdata, type, detail, XHTML); \
+  } \
+  static int NAME##_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata) { \
+    return on_leave_block((FmtHTML*)userdata, type, detail, CODECB, FLUSH); \
+  } \
+  static int NAME##_leave_span(MD_SPANTYPE type, void* detail, void* userdata) { \
+    return on_leave_span((FmtHTML*)userdata, type, detail, XHTML); \
+  } \
+  static int NAME##_text(MD_TEXTTYPE type, const MD_CHAR* s, MD_SIZE size, void* userdata) { \
+    return on_text((FmtHTML*)userdata, type, s, size, XHTML, CODECB, FLUSH); \
+  } \
+  static const Renderer NAME = { \
+    NAME##_enter_block, \
+    NAME##_leave_block, \
+    enter_span_callback, \
+    NAME##_leave_span, \
+    NAME##_text, \
+  };
+
+RENDERER(render_html,              false, false, false)
+RENDERER(render_xhtml,             true,  false, false)
+RENDERER(render_html_codecb,       false, true,  false)
+RENDERER(render_xhtml_codecb,      true,  true,  false)
+RENDERER(render_html_flush,        false, false, true)
+RENDERER(render_xhtml_flush,       true,  false, true)
+RENDERER(render_html_codecb_flush, false, true,  true)
+RENDERER(render_xhtml_codecb_flush, true, true,  true)
+
+// indexed by select_renderer
+static const Renderer* const renderers[8] = {
+  &render_html,       &render_xhtml,       &render_html_codecb,       &render_xhtml_codecb,
+  &render_html_flush, &render_xhtml_flush, &render_html_codecb_flush, &render_xhtml_codecb_flush,
+};
+
+static const Renderer* select_renderer(FmtHTML* fmt) {
+  u32 i = ((fmt->flags & OutputFlagXHTML) ? 1 : 0) |
+          (fmt->onCodeBlock ? 2 : 0) |
+          (fmt->onFlush ? 4 : 0);
+  return renderers[i];
 }
 
 // static void debug_log_callback(const char* msg, void* userdata) {
 //   dlog("MD4C: %s\n", msg);
 // }
 
+static void init_parser(MD_PARSER* parser, FmtHTML* fmt) {
+  const Renderer* rend = select_renderer(fmt);
+  *parser = (MD_PARSER){
+    0,
+    fmt->parserFlags,
+    rend->enter_block,
+    rend->leave_block,
+    rend->enter_span,
+    rend->leave_span,
+    rend->text,
+    NULL, // debug_log_callback,
+    NULL,
+    fmt->onTopBlock,
+    fmt->onRefDef,
+    fmt->stats,
+    get_html_output,
+    fmt->refDefs,
+  };
+}
+
+
 int fmt_html(const MD_CHAR* input, MD_SIZE input_size, FmtHTML* fmt) {
   fmt->imgnest = 0;
   fmt->addanchor = 0;
   fmt->codeBlockNest = 0;
   fmt->tmpbuf = (WBuf){0};
+  init_html_output(fmt);
 
-  MD_PARSER parser = {
-    0,
-    fmt->parserFlags,
-    enter_block_callback,
-    leave_block_callback,
-    enter_span_callback,
-    leave_span_callback,
-    text_callback,
-    NULL, // debug_log_callback,
-    NULL
-  };
+  MD_PARSER parser;
+  init_parser(&parser, fmt);
 
   WBufInit(&fmt->tmpbuf);
 
-  int res = md_parse(input, input_size, &parser, (void*)fmt);
+  int res = fmt->mdctx ?
+    md_ctx_parse(fmt->mdctx, input, input_size, &parser, (void*)fmt) :
+    md_parse(input, input_size, &parser, (void*)fmt);
+
+  if (res == 0 && fmt->onFlush && WBufLen(fmt->outbuf) > 0)
+    res = flush(fmt);
 
   WBufFree(&fmt->tmpbuf);
 
   return res;
 }
+
+
+int fmt_html_parallel(const MD_CHAR* input, MD_SIZE input_size, FmtHTML* fmt, u32 nthreads) {
+  // onCodeBlock calls out to JavaScript, which is only possible from the main thread.
+  // Streamed output, and what onTopBlock, onRefDef and the bracket counts record about
+  // the document, have to be produced in order and into fmt itself.
+  if (nthreads < 2 || fmt->onCodeBlock || fmt->onFlush ||
+      fmt->onTopBlock || fmt->onRefDef || fmt->countBrackets)
+    return fmt_html(input, input_size, fmt);
+  if (nthreads > FMT_HTML_MAX_THREADS)
+    nthreads = FMT_HTML_MAX_THREADS;
+
+  // Each part renders into its own buffer, except for the first one which
+  // renders directly into fmt->outbuf. The rest is appended to it when done.
+  FmtHTML parts[FMT_HTML_MAX_THREADS];
+  WBuf    outbufs[FMT_HTML_MAX_THREADS];
+  void*   userdata[FMT_HTML_MAX_THREADS];
+  for (u32 i = 0; i < nthreads; i++) {
+    FmtHTML* r = &parts[i];
+    *r = *fmt;
+    r->mdctx = NULL;
+    r->imgnest = 0;
+    r->addanchor = 0;
+    r->codeBlockNest = 0;
+    WBufInit(&r->tmpbuf);
+    WBufInit(&outbufs[i]);
+    if (i > 0)
+      r->outbuf = &outbufs[i];
+    init_html_output(r);
+    userdata[i] = r;
+  }
+
+  MD_PARSER parser;
+  init_parser(&parser, fmt);
+
+  unsigned nparts = 1;
+  int res = md_parse_parallel(input, input_size, &parser, userdata, nthreads, &nparts);
+
+  for (u32 i = 0; i < nthreads; i++) {
+    if (i > 0 && i < nparts && res == 0)
+      WBufAppendBytes(fmt->outbuf, outbufs[i].start, WBufLen(&outbufs[i]));
+    WBufFree(&outbufs[i]);
+    WBufFree(&parts[i].tmpbuf);
+  }
+
+  return res;
+}
@@ -1,18 +1,56 @@
 #pragma once
+#include "md4c.h"
 
 typedef struct FmtHTML {
-  OutputFlags flags;
-  u32         parserFlags; // passed along to md_parse
-  WBuf*       outbuf;
+  OutputFlags    flags;
+  u32            parserFlags; // passed along to md_parse
+  WBuf*          outbuf;
+  MD_PARSER_CTX* mdctx;       // optional reusable parser context (see md_ctx_create)
+  const MD_REF_DEFS* refDefs; // optional shared link reference definitions
 
   // optional callbacks
   JSTextFilterFun onCodeBlock;
 
+  // optional source position callbacks (see top_block and ref_def in md4c.h),
+  // called with the FmtHTML as userdata
+  void (*onTopBlock)(MD_OFFSET srcoff, void* fmt);
+  void (*onRefDef)(MD_OFFSET beg, MD_OFFSET end, const MD_CHAR* text, MD_SIZE size, void* fmt);
+  void* userdata; // for use by the above callbacks
+
+  // optional streaming output: whenever outbuf holds at least flushSize bytes, its
+  // contents are passed to onFlush (e.g. a function calling write(2)) and outbuf is
+  // emptied. Whatever is left is flushed at the end. Returning non-zero aborts parsing.
+  int (*onFlush)(const char* data, size_t len, void* fmt);
+  u32   flushSize;
+
+  // optional: when countBrackets is set, brackets counts the runs of (non-code) text
+  // containing ']'. Such text may be a reference to a link reference definition which
+  // has not been found.
+  bool  countBrackets;
+  u32   brackets;
+
+  // optional: parser statistics to add to (see MD_STATS in md4c.h)
+  MD_STATS* stats;
+
   // internal state
   int  imgnest;
   int  addanchor;
   int  codeBlockNest;
   WBuf tmpbuf;
+  MD_HTML_OUTPUT html; // direct output of inline content by the parser into outbuf
 } FmtHTML;
 
 int fmt_html(const char* input, u32 inputlen, FmtHTML* fmt);
+
+// fmt_html_outsize returns an estimate of the size of the HTML produced for input,
+// for reserving space in outbuf up front. Only a sample of large inputs is looked at.
+size_t fmt_html_outsize(const char* input, size_t inputlen);
+
+// fmt_html_parallel is like fmt_html but splits large documents into up to
+// nthreads parts which are rendered concurrently (see md_parse_parallel.)
+// fmt->mdctx is not used. Falls back to fmt_html when fmt->onCodeBlock or
+// fmt->onFlush is set.
+#ifndef FMT_HTML_MAX_THREADS
+  #define FMT_HTML_MAX_THREADS 16
+#endif
+int fmt_html_parallel(const char* input, u32 inputlen, FmtHTML* fmt, u32 nthreads);
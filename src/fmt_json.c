@@ -1,542 +1,514 @@
-#include <stdio.h>
 #include <string.h>
-#include <ctype.h>
+#include <strings.h>
 
+#include "common.h"
 #include "fmt_json.h"
 #include "md4c.h"
-// #include "md4c_render_html.h"
-// #include "entity.h"
 
-//
-//
-// --------------   WORK IN PROGRESS
-//
-//
 
-#ifdef _WIN32
-  #define snprintf _snprintf
-#endif
+// Escape sequences of bytes which can not appear verbatim in JSON strings; 'u' means
+// \u00XX. Everything else, including UTF-8 sequences, is copied as is.
+static const char jsonEscapeMap[256] = {
+        /* 0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F */
+/* 0x00 */ 'u','u','u','u','u','u','u','u','b','t','n','u','f','r','u','u',
+/* 0x10 */ 'u','u','u','u','u','u','u','u','u','u','u','u','u','u','u','u',
+/* 0x20 */ 0,  0,  '"',0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30 */ 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x40 */ 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x50 */ 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  '\\',0, 0,  0,
+};
 
+static const char ucReplacementUTF8[] = { 0xef, 0xbf, 0xbd };
 
-#ifndef DEBUG
-#define DEBUG 1
-#endif
-#if DEBUG
-#include <stdio.h>
-#  define dlog(...)  printf(__VA_ARGS__)
-#else
-#  define dlog(...)
-#endif /* DEBUG > 0 */
+// kinds of FmtJSON.textopen
+enum { TEXT_NONE, TEXT_STRING, TEXT_HTML };
 
 
-typedef struct JsonFormatter_st {
-  WBuf* outbuf;
-} JsonFormatter;
-
-
-#define ISDIGIT(ch)  ('0' <= (ch) && (ch) <= '9')
-#define ISLOWER(ch)  ('a' <= (ch) && (ch) <= 'z')
-#define ISUPPER(ch)  ('A' <= (ch) && (ch) <= 'Z')
-#define ISALNUM(ch)  (ISLOWER(ch) || ISUPPER(ch) || ISDIGIT(ch))
-
-
-// static inline void render_text(JsonFormatter* r, const MD_CHAR* text, MD_SIZE size) {
-//   // r->process_output(text, size, r->userdata);
-//   WBufAppendBytes(r->outbuf, text, size);
-// }
-
-#define render_text(f, textptr, textlen) \
-  WBufAppendBytes((r)->outbuf, (textptr), (textlen))
-
-// #define RENDER_LITERAL(r, literal) \
-//   WBufAppendBytes((r)->outbuf, (literal), (MD_SIZE)strlen(literal))
-
-
-static char jsonEscapeMap[256];
-
-static void __attribute__((constructor)) init() {
-  jsonEscapeMap[(unsigned char)'"'] = 1;
-  jsonEscapeMap[(unsigned char)'\n'] = 1;
-  jsonEscapeMap[(unsigned char)'\r'] = 1;
-  jsonEscapeMap[(unsigned char)'\t'] = 1;
+static inline void write_bytes(FmtJSON* r, const char* data, size_t size) {
+  WBufAppendBytes(r->outbuf, data, size);
 }
 
+static inline void write_literal(FmtJSON* r, const char* cs) {
+  WBufAppendBytes(r->outbuf, cs, strlen(cs));
+}
 
-static void writeJsonEscaped(JsonFormatter* r, const MD_CHAR* data, MD_SIZE size) {
-  MD_OFFSET beg = 0;
-  MD_OFFSET off = 0;
+static size_t json_escaped_len(const char* data, size_t size) {
+  size_t len = size;
+  for (size_t i = 0; i < size; i++) {
+    char e = jsonEscapeMap[(unsigned char)data[i]];
+    if (e != 0)
+      len += e == 'u' ? 5 : 1;
+  }
+  return len;
+}
 
+// write_escaped writes data as the contents of a JSON string
+static void write_escaped(FmtJSON* r, const char* data, size_t size) {
+  static const char hexchars[] = "0123456789abcdef";
   #define NEED_ESCAPE(ch)  (jsonEscapeMap[(unsigned char)(ch)] != 0)
 
-  while(1) {
-    /* Optimization: Use some loop unrolling. */
-    while (
-      off + 3 < size &&
-      !NEED_ESCAPE(data[off+0]) &&
-      !NEED_ESCAPE(data[off+1]) &&
-      !NEED_ESCAPE(data[off+2]) &&
-      !NEED_ESCAPE(data[off+3])
-    ) {
+  // Reserve for the worst case up front so that the loop below needs no checks.
+  // When that does not fit, reserve what is actually needed rather than growing
+  // outbuf beyond the size reserved with the help of fmt_json_outsize.
+  WBuf* b = r->outbuf;
+  if (WBufAvail(b) < size * 6)
+    WBufReserve(b, json_escaped_len(data, size));
+  char* out = b->ptr;
+
+  size_t off = 0;
+  while (off < size) {
+    while (off + 3 < size &&
+           !NEED_ESCAPE(data[off+0]) &&
+           !NEED_ESCAPE(data[off+1]) &&
+           !NEED_ESCAPE(data[off+2]) &&
+           !NEED_ESCAPE(data[off+3]))
+    {
+      memcpy(out, data + off, 4);
+      out += 4;
       off += 4;
     }
-    while (off < size && !NEED_ESCAPE(data[off])) {
-      off++;
-    }
-
-    if (off > beg) {
-      WBufAppendBytes(r->outbuf, data + beg, off - beg);
-    }
-
-    if (off < size) {
-      switch (data[off]) {
-        case '"':   WBufAppendCStr(r->outbuf, "\\\""); break;
-        case '\n':  WBufAppendCStr(r->outbuf, "\\n");  break;
-        case '\r':  WBufAppendCStr(r->outbuf, "\\r");  break;
-        case '\t':  WBufAppendCStr(r->outbuf, "\\t");  break;
-      }
-      off++;
-    } else {
+    if (off == size)
       break;
+    unsigned char c = (unsigned char)data[off++];
+    char e = jsonEscapeMap[c];
+    if (e == 0) {
+      *out++ = (char)c;
+    } else if (e == 'u') {
+      memcpy(out, "\\u00", 4);
+      out[4] = hexchars[c >> 4];
+      out[5] = hexchars[c & 0xf];
+      out += 6;
+    } else {
+      out[0] = '\\';
+      out[1] = e;
+      out += 2;
     }
-
-    beg = off;
   }
 
+  b->ptr = out;
   #undef NEED_ESCAPE
 }
 
 
-static void
-render_url_escaped(JsonFormatter* r, const MD_CHAR* data, MD_SIZE size)
-{
-  static const MD_CHAR hex_chars[] = "0123456789ABCDEF";
-  MD_OFFSET beg = 0;
-  MD_OFFSET off = 0;
-
-  #define URL_NEED_ESCAPE(ch)                                             \
-      (!ISALNUM(ch)  &&  strchr("-_.+!*'(),%#@?=;:/,+$", ch) == NULL)
-
-  while(1) {
-    while(off < size  &&  !URL_NEED_ESCAPE(data[off]))
-      off++;
-    if(off > beg)
-      render_text(r, data + beg, off - beg);
-
-    if(off < size) {
-      char hex[3];
-
-      switch(data[off]) {
-        case '&':   WBufAppendCStr(r->outbuf, "&amp;"); break;
-        case '\'':  WBufAppendCStr(r->outbuf, "&#x27;"); break;
-        default:
-          hex[0] = '%';
-          hex[1] = hex_chars[((unsigned)data[off] >> 4) & 0xf];
-          hex[2] = hex_chars[((unsigned)data[off] >> 0) & 0xf];
-          render_text(r, hex, 3);
-          break;
-      }
-      off++;
-    } else {
-      break;
-    }
+// Values are written as they come; commas are written ahead of every value but the
+// first of an array. Adjacent text is joined into a single string.
 
-    beg = off;
+static void close_text(FmtJSON* r) {
+  switch (r->textopen) {
+    case TEXT_STRING: WBufAppendc(r->outbuf, '"'); break;
+    case TEXT_HTML:   write_bytes(r, "\"}", 2); break;
   }
+  r->textopen = TEXT_NONE;
 }
 
-static unsigned
-hex_val(char ch)
-{
-  if('0' <= ch && ch <= '9')
-    return ch - '0';
-  if('A' <= ch && ch <= 'Z')
-    return ch - 'A' + 10;
-  else
-    return ch - 'a' + 10;
+static void begin_value(FmtJSON* r) {
+  close_text(r);
+  if (r->comma)
+    WBufAppendc(r->outbuf, ',');
+  r->comma = 1;
 }
 
-static void WBufAppendUTF8Codepoint(WBuf* b, u32 codepoint) {
-  if (codepoint <= 0x7f) {
-    WBufAppendc(b, (char)codepoint);
-    return;
-  }
-
-  unsigned char utf8[4];
-  size_t n;
-  if (codepoint <= 0x7ff) {
-    n = 2;
-    utf8[0] = 0xc0 | ((codepoint >>  6) & 0x1f);
-    utf8[1] = 0x80 + ((codepoint >>  0) & 0x3f);
-  } else if (codepoint <= 0xffff) {
-    n = 3;
-    utf8[0] = 0xe0 | ((codepoint >> 12) & 0xf);
-    utf8[1] = 0x80 + ((codepoint >>  6) & 0x3f);
-    utf8[2] = 0x80 + ((codepoint >>  0) & 0x3f);
-  } else {
-    n = 4;
-    utf8[0] = 0xf0 | ((codepoint >> 18) & 0x7);
-    utf8[1] = 0x80 + ((codepoint >> 12) & 0x3f);
-    utf8[2] = 0x80 + ((codepoint >>  6) & 0x3f);
-    utf8[3] = 0x80 + ((codepoint >>  0) & 0x3f);
-  }
-
-  if (0 < codepoint && codepoint <= 0x10ffff) {
-    WBufAppendBytes(b, (const char*)utf8, n);
-  } else {
-    static const MD_CHAR utf8_replacement_char[] = { 0xef, 0xbf, 0xbd };
-    WBufAppendBytes(b, utf8_replacement_char, sizeof(utf8_replacement_char));
-  }
+// open_node writes the start of a node of the given type. It is followed by its
+// attributes, if any, and open_children or end_leaf.
+static void open_node(FmtJSON* r, const char* type) {
+  begin_value(r);
+  write_bytes(r, "{\"_\":\"", 6);
+  write_literal(r, type);
+  WBufAppendc(r->outbuf, '"');
 }
 
-/* Translate entity to its UTF-8 equivalent, or output the verbatim one
- * if such entity is unknown (or if the translation is disabled). */
-static void writeDecodeXmlEntity(JsonFormatter* r, const MD_CHAR* text, MD_SIZE size) {
-  if (size > 3 && text[1] == '#') {
-    unsigned codepoint = 0;
-
-    if(text[2] == 'x' || text[2] == 'X') {
-      // Hexadecimal entity (e.g. "&#x1234abcd;")).
-      for (MD_SIZE i = 3; i < size-1; i++) {
-        codepoint = 16 * codepoint + hex_val(text[i]);
-      }
-    } else {
-      // Decimal entity (e.g. "&1234;")
-      for (MD_SIZE i = 2; i < size-1; i++) {
-        codepoint = 10 * codepoint + (text[i] - '0');
-      }
-    }
-
-    WBufAppendUTF8Codepoint(r->outbuf, codepoint);
-  } else {
-    WBufAppendBytes(r->outbuf, text, size);
-  }
+static void open_children(FmtJSON* r) {
+  write_bytes(r, ",\"children\":[", 13);
+  r->comma = 0;
 }
 
-static void
-render_attribute(JsonFormatter* r, const MD_ATTRIBUTE* attr,
-         void (*fn_append)(JsonFormatter*, const MD_CHAR*, MD_SIZE))
-{
-  int i;
-
-  for(i = 0; attr->substr_offsets[i] < attr->size; i++) {
-    MD_TEXTTYPE type = attr->substr_types[i];
-    MD_OFFSET off = attr->substr_offsets[i];
-    MD_SIZE size = attr->substr_offsets[i+1] - off;
-    const MD_CHAR* text = attr->text + off;
-
-    switch(type) {
-      case MD_TEXT_NULLCHAR:  WBufAppendc(r->outbuf, 0); break;
-      case MD_TEXT_ENTITY:    writeDecodeXmlEntity(r, text, size); break;
-      default:                WBufAppendBytes(r->outbuf, text, size); break;
-    }
-  }
+static void close_children(FmtJSON* r) {
+  close_text(r);
+  write_bytes(r, "]}", 2);
+  r->comma = 1;
 }
 
-
-static void
-render_open_ol_block(JsonFormatter* r, const MD_BLOCK_OL_DETAIL* det)
-{
-  char buf[64];
-
-  if(det->start == 1) {
-    WBufAppendCStr(r->outbuf, "<ol>\n");
-    return;
-  }
-
-  snprintf(buf, sizeof(buf), "<ol start=\"%u\">\n", det->start);
-  WBufAppendCStr(r->outbuf, buf);
+static void end_leaf(FmtJSON* r) {
+  WBufAppendc(r->outbuf, '}');
 }
 
-static void
-render_open_li_block(JsonFormatter* r, const MD_BLOCK_LI_DETAIL* det)
-{
-  if(det->is_task) {
-    WBufAppendCStr(r->outbuf,
-      "<li class=\"task-list-item\">"
-      "<input type=\"checkbox\" class=\"task-list-item-checkbox\" disabled");
-    if (det->task_mark == 'x' || det->task_mark == 'X') {
-      WBufAppendCStr(r->outbuf, " checked");
-    }
-    WBufAppendc(r->outbuf, '>');
+// open_text makes sure that text of the given kind is open for appending
+static inline void open_text(FmtJSON* r, int kind) {
+  if (r->textopen == kind)
+    return;
+  begin_value(r);
+  if (kind == TEXT_HTML) {
+    write_bytes(r, "{\"_\":\"html\",\"text\":\"", 20);
   } else {
-    WBufAppendCStr(r->outbuf, "<li>");
+    WBufAppendc(r->outbuf, '"');
   }
+  r->textopen = kind;
 }
 
-static void
-render_open_code_block(JsonFormatter* r, const MD_BLOCK_CODE_DETAIL* det)
-{
-  WBufAppendCStr(r->outbuf, "<pre><code");
+static void write_key(FmtJSON* r, const char* key) {
+  write_bytes(r, ",\"", 2);
+  write_literal(r, key);
+  write_bytes(r, "\":", 2);
+}
 
-  /* If known, output the HTML 5 attribute class="language-LANGNAME". */
-  if(det->lang.text != NULL) {
-    WBufAppendCStr(r->outbuf, " class=\"language-");
-    render_attribute(r, &det->lang, writeJsonEscaped);
-    WBufAppendc(r->outbuf, '"');
-  }
+static void write_u32_attr(FmtJSON* r, const char* key, u32 value) {
+  write_key(r, key);
+  WBufAppendU32(r->outbuf, value, 10);
+}
 
-  WBufAppendc(r->outbuf, '>');
+static void write_str_attr(FmtJSON* r, const char* key, const char* value) {
+  write_key(r, key);
+  WBufAppendc(r->outbuf, '"');
+  write_literal(r, value);
+  WBufAppendc(r->outbuf, '"');
 }
 
-static void
-render_open_td_block(JsonFormatter* r, const MD_CHAR* cell_type, const MD_BLOCK_TD_DETAIL* det)
-{
-  WBufAppendc(r->outbuf, '<');
-  WBufAppendCStr(r->outbuf, cell_type);
-
-  switch (det->align) {
-    case MD_ALIGN_LEFT:     WBufAppendCStr(r->outbuf, " align=\"left\">"); break;
-    case MD_ALIGN_CENTER:   WBufAppendCStr(r->outbuf, " align=\"center\">"); break;
-    case MD_ALIGN_RIGHT:    WBufAppendCStr(r->outbuf, " align=\"right\">"); break;
-    default:                WBufAppendCStr(r->outbuf, ">"); break;
-  }
+static void write_true_attr(FmtJSON* r, const char* key) {
+  write_key(r, key);
+  write_bytes(r, "true", 4);
 }
 
-static void
-render_open_a_span(JsonFormatter* r, const MD_SPAN_A_DETAIL* det)
-{
-  WBufAppendCStr(r->outbuf, "<a href=\"");
-  render_attribute(r, &det->href, render_url_escaped);
 
-  if(det->title.text != NULL) {
-    WBufAppendCStr(r->outbuf, "\" title=\"");
-    render_attribute(r, &det->title, writeJsonEscaped);
-  }
+/*************************
+ ***  Entity decoding  ***
+ *************************/
 
-  WBufAppendCStr(r->outbuf, "\">");
+static unsigned hex_val(char ch) {
+  if ('0' <= ch && ch <= '9')
+    return ch - '0';
+  if ('A' <= ch && ch <= 'Z')
+    return ch - 'A' + 10;
+  return ch - 'a' + 10;
 }
 
-static void
-render_open_img_span(JsonFormatter* r, const MD_SPAN_IMG_DETAIL* det)
-{
-  WBufAppendCStr(r->outbuf, "<img src=\"");
-  render_attribute(r, &det->src, render_url_escaped);
-
-  WBufAppendCStr(r->outbuf, "\" alt=\"");
+// encode_utf8 writes codepoint as UTF-8 to out and returns its length.
+// Invalid codepoints are replaced with U+FFFD.
+static size_t encode_utf8(u32 codepoint, char* out) {
+  if (codepoint == 0 || codepoint > 0x10ffff || (codepoint >= 0xd800 && codepoint <= 0xdfff)) {
+    memcpy(out, ucReplacementUTF8, sizeof(ucReplacementUTF8));
+    return sizeof(ucReplacementUTF8);
+  }
+  if (codepoint <= 0x7f) {
+    out[0] = (char)codepoint;
+    return 1;
+  }
+  if (codepoint <= 0x7ff) {
+    out[0] = (char)(0xc0 | (codepoint >> 6));
+    out[1] = (char)(0x80 | (codepoint & 0x3f));
+    return 2;
+  }
+  if (codepoint <= 0xffff) {
+    out[0] = (char)(0xe0 | (codepoint >> 12));
+    out[1] = (char)(0x80 | ((codepoint >> 6) & 0x3f));
+    out[2] = (char)(0x80 | (codepoint & 0x3f));
+    return 3;
+  }
+  out[0] = (char)(0xf0 | (codepoint >> 18));
+  out[1] = (char)(0x80 | ((codepoint >> 12) & 0x3f));
+  out[2] = (char)(0x80 | ((codepoint >> 6) & 0x3f));
+  out[3] = (char)(0x80 | (codepoint & 0x3f));
+  return 4;
 }
 
-static void
-render_close_img_span(JsonFormatter* r, const MD_SPAN_IMG_DETAIL* det)
-{
-  if(det->title.text != NULL) {
-    WBufAppendCStr(r->outbuf, "\" title=\"");
-    render_attribute(r, &det->title, writeJsonEscaped);
+// decode_entity decodes the entity (e.g. "&#123;" or "&amp;") into out[4] and returns
+// its length, or returns 0 if it is a named entity other than the XML ones.
+static size_t decode_entity(const char* text, size_t size, char* out) {
+  if (size > 3 && text[1] == '#') {
+    // md4c only reports numeric entities of at most 7 digits
+    u32 codepoint = 0;
+    if (text[2] == 'x' || text[2] == 'X') {
+      for (size_t i = 3; i < size - 1; i++)
+        codepoint = 16 * codepoint + hex_val(text[i]);
+    } else {
+      for (size_t i = 2; i < size - 1; i++)
+        codepoint = 10 * codepoint + (u32)(text[i] - '0');
+    }
+    return encode_utf8(codepoint, out);
   }
 
-  WBufAppendCStr(r->outbuf, "\">");
-}
-
-static void
-render_open_wikilink_span(JsonFormatter* r, const MD_SPAN_WIKILINK_DETAIL* det)
-{
-  WBufAppendCStr(r->outbuf, "<x-wikilink data-target=\"");
-  render_attribute(r, &det->target, writeJsonEscaped);
-  WBufAppendCStr(r->outbuf, "\">");
+  #define ENTITY(name, ch) \
+    if (size == strlen(name) && memcmp(text, (name), size) == 0) { *out = (ch); return 1; }
+  ENTITY("&amp;",  '&')
+  ENTITY("&lt;",   '<')
+  ENTITY("&gt;",   '>')
+  ENTITY("&quot;", '"')
+  ENTITY("&apos;", '\'')
+  #undef ENTITY
+  return 0;
 }
 
 
-// ------------------------------------------------------------------------------------------------
-
+/********************
+ ***  Attributes  ***
+ ********************/
 
-static void writeTypeStart(JsonFormatter* r, const char* typename, size_t typenamelen) {
-  WBufAppendCStr(r->outbuf, "{\"_\":\"");
-  WBufAppendBytes(r->outbuf, typename, typenamelen);
-  WBufAppendc(r->outbuf, '"');
+static bool is_javascript_uri(const MD_ATTRIBUTE* attr) {
+  return (
+    attr->size >= strlen("javascript:") &&
+    strncasecmp(attr->text, "javascript:", strlen("javascript:")) == 0
+  );
 }
 
-
-static void writeAttribute(JsonFormatter* r, const MD_ATTRIBUTE* attr) {
+// write_attribute writes the attribute as a string value of key. Unlike in text,
+// named entities which are not decoded are kept verbatim.
+static void write_attribute(FmtJSON* r, const char* key, const MD_ATTRIBUTE* attr) {
+  write_key(r, key);
+  WBufAppendc(r->outbuf, '"');
   for (u32 i = 0; attr->substr_offsets[i] < attr->size; i++) {
     MD_TEXTTYPE type = attr->substr_types[i];
-    MD_OFFSET   off  = attr->substr_offsets[i];
-    MD_SIZE     size = attr->substr_offsets[i+1] - off;
+    MD_OFFSET off = attr->substr_offsets[i];
+    MD_SIZE size = attr->substr_offsets[i+1] - off;
     const MD_CHAR* text = attr->text + off;
+    char decoded[4];
+    size_t n;
+
     switch (type) {
-      case MD_TEXT_NULLCHAR:  WBufAppendCStr(r->outbuf, "\\0"); break;
-      case MD_TEXT_ENTITY:    writeDecodeXmlEntity(r, text, size); break;
-      default:                WBufAppendBytes(r->outbuf, text, size); break;
+      case MD_TEXT_NULLCHAR:
+        write_bytes(r, ucReplacementUTF8, sizeof(ucReplacementUTF8));
+        break;
+      case MD_TEXT_ENTITY:
+        n = decode_entity(text, size, decoded);
+        if (n > 0) {
+          write_escaped(r, decoded, n);
+          break;
+        }
+        // fall through
+      default:
+        write_escaped(r, text, size);
+        break;
     }
   }
+  WBufAppendc(r->outbuf, '"');
 }
 
 
+/***************************************
+ ***  JSON formatter implementation  ***
+ ***************************************/
+
 static int enter_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata) {
-  static const MD_CHAR* head[6] = { "h1", "h2", "h3", "h4", "h5", "h6" };
-  JsonFormatter* r = (JsonFormatter*) userdata;
-  const char* typename = "";
-  size_t typenamelen = 0;
-  #define WRITE_TYPE_START(name) writeTypeStart(r, (name), strlen((name)))
+  FmtJSON* r = (FmtJSON*)userdata;
 
   switch (type) {
-    case MD_BLOCK_DOC:   WRITE_TYPE_START("doc"); break;
-    case MD_BLOCK_QUOTE: WRITE_TYPE_START("quote"); break;
-    case MD_BLOCK_UL:    WRITE_TYPE_START("ul"); break;
-    case MD_BLOCK_HTML:  WRITE_TYPE_START("html"); break;
-    case MD_BLOCK_P:     WRITE_TYPE_START("p"); break;
-    case MD_BLOCK_TABLE: WRITE_TYPE_START("table"); break;
-    case MD_BLOCK_THEAD: WRITE_TYPE_START("thead"); break;
-    case MD_BLOCK_TBODY: WRITE_TYPE_START("tbody"); break;
-    case MD_BLOCK_TR:    WRITE_TYPE_START("tr"); break;
-    case MD_BLOCK_HR:    WRITE_TYPE_START("hr"); break;
-
-    case MD_BLOCK_H: {
-      WRITE_TYPE_START(head[((MD_BLOCK_H_DETAIL*)detail)->level - 1]);
+    case MD_BLOCK_DOC:   open_node(r, "doc"); break;
+    case MD_BLOCK_QUOTE: open_node(r, "quote"); break;
+    case MD_BLOCK_HR:    open_node(r, "hr"); end_leaf(r); return 0;
+    case MD_BLOCK_P:     open_node(r, "p"); break;
+    case MD_BLOCK_TABLE: open_node(r, "table"); break;
+    case MD_BLOCK_THEAD: open_node(r, "thead"); break;
+    case MD_BLOCK_TBODY: open_node(r, "tbody"); break;
+    case MD_BLOCK_TR:    open_node(r, "tr"); break;
+
+    case MD_BLOCK_HTML:
+      open_node(r, "html");
+      r->htmlblock = 1;
+      break;
+
+    case MD_BLOCK_UL: {
+      const MD_BLOCK_UL_DETAIL* d = (const MD_BLOCK_UL_DETAIL*)detail;
+      open_node(r, "ul");
+      if (d->is_tight)
+        write_true_attr(r, "tight");
       break;
     }
 
     case MD_BLOCK_OL: {
-      WRITE_TYPE_START("ol");
       const MD_BLOCK_OL_DETAIL* d = (const MD_BLOCK_OL_DETAIL*)detail;
-      if (d->start != 1) {
-        char buf[24];
-        snprintf(buf, sizeof(buf), ", \"start\":%u", d->start);
-        WBufAppendCStr(r->outbuf, buf);
-      }
-      if (d->is_tight) {
-        WBufAppendCStr(r->outbuf, ", \"tight\":true");
-      }
-      WBufAppendCStr(r->outbuf, ", \"delimiter\":\"");
-      WBufAppendc(r->outbuf, d->mark_delimiter);
-      WBufAppendc(r->outbuf, '"');
+      open_node(r, "ol");
+      if (d->start != 1)
+        write_u32_attr(r, "start", d->start);
+      if (d->is_tight)
+        write_true_attr(r, "tight");
+      if (d->mark_delimiter != '.')
+        write_str_attr(r, "delimiter", ")");
       break;
     }
 
     case MD_BLOCK_LI: {
       const MD_BLOCK_LI_DETAIL* d = (const MD_BLOCK_LI_DETAIL*)detail;
+      open_node(r, "li");
       if (d->is_task) {
-        WBufAppendCStr(r->outbuf, "{\"_\":\"task\"");
+        write_key(r, "checked");
         if (d->task_mark == 'x' || d->task_mark == 'X') {
-          WBufAppendCStr(r->outbuf, ", \"complete\":true");
+          write_bytes(r, "true", 4);
+        } else {
+          write_bytes(r, "false", 5);
         }
-      } else {
-        WRITE_TYPE_START("li");
       }
       break;
     }
 
+    case MD_BLOCK_H:
+      open_node(r, "h");
+      write_u32_attr(r, "level", ((const MD_BLOCK_H_DETAIL*)detail)->level);
+      break;
+
     case MD_BLOCK_CODE: {
-      WRITE_TYPE_START("code");
       const MD_BLOCK_CODE_DETAIL* d = (const MD_BLOCK_CODE_DETAIL*)detail;
-      if (d->lang.text != NULL) {
-        WBufAppendCStr(r->outbuf, ", \"lang\":\"");
-        writeAttribute(r, &d->lang);
-        WBufAppendc(r->outbuf, '"');
-      }
-      if (d->info.text != NULL) {
-        WBufAppendCStr(r->outbuf, ", \"info\":\"");
-        writeAttribute(r, &d->info);
-        WBufAppendc(r->outbuf, '"');
-      }
+      open_node(r, "code");
+      if (d->lang.size > 0)
+        write_attribute(r, "lang", &d->lang);
+      if (d->info.size > 0)
+        write_attribute(r, "info", &d->info);
       break;
     }
 
     case MD_BLOCK_TH:
     case MD_BLOCK_TD: {
-      writeTypeStart(r, type == MD_BLOCK_TH ? "th" : "td", 2);
-      const MD_BLOCK_TD_DETAIL* d = (const MD_BLOCK_TD_DETAIL*)detail;
-      switch (d->align) {
-          case MD_ALIGN_LEFT:   WBufAppendCStr(r->outbuf, ", \"align\":\"left\""); break;
-          case MD_ALIGN_CENTER: WBufAppendCStr(r->outbuf, ", \"align\":\"center\""); break;
-          case MD_ALIGN_RIGHT:  WBufAppendCStr(r->outbuf, ", \"align\":\"right\""); break;
-          default: break;  // unspecified alignment
+      open_node(r, type == MD_BLOCK_TH ? "th" : "td");
+      switch (((const MD_BLOCK_TD_DETAIL*)detail)->align) {
+        case MD_ALIGN_LEFT:   write_str_attr(r, "align", "left"); break;
+        case MD_ALIGN_CENTER: write_str_attr(r, "align", "center"); break;
+        case MD_ALIGN_RIGHT:  write_str_attr(r, "align", "right"); break;
+        default: break;
       }
       break;
     }
-
-// static void
-// render_open_td_block(MD_RENDER_HTML* r, const MD_CHAR* cell_type, const MD_BLOCK_TD_DETAIL* det)
-// {
-//     RENDER_LITERAL(r, "<");
-//     RENDER_LITERAL(r, cell_type);
-
-//     switch(det->align) {
-//         case MD_ALIGN_LEFT:     RENDER_LITERAL(r, " align=\"left\">"); break;
-//         case MD_ALIGN_CENTER:   RENDER_LITERAL(r, " align=\"center\">"); break;
-//         case MD_ALIGN_RIGHT:    RENDER_LITERAL(r, " align=\"right\">"); break;
-//         default:                RENDER_LITERAL(r, ">"); break;
-//     }
   }
 
-  WBufAppendCStr(r->outbuf, ", \"children\":[\n  ");
+  open_children(r);
   return 0;
 }
 
-
 static int leave_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata) {
-  JsonFormatter* r = (JsonFormatter*)userdata;
-  WBufAppendCStr(r->outbuf, "]},\n");
+  FmtJSON* r = (FmtJSON*)userdata;
+  if (type == MD_BLOCK_HR)
+    return 0;
+  if (type == MD_BLOCK_HTML)
+    r->htmlblock = 0;
+  close_children(r);
   return 0;
 }
 
-
 static int enter_span_callback(MD_SPANTYPE type, void* detail, void* userdata) {
-  JsonFormatter* r = (JsonFormatter*) userdata;
-
-  switch(type) {
-    case MD_SPAN_EM:                WBufAppendCStr(r->outbuf, "<em>"); break;
-    case MD_SPAN_STRONG:            WBufAppendCStr(r->outbuf, "<b>"); break;
-    case MD_SPAN_A:                 render_open_a_span(r, (MD_SPAN_A_DETAIL*) detail); break;
-    case MD_SPAN_IMG:               render_open_img_span(r, (MD_SPAN_IMG_DETAIL*) detail); break;
-    case MD_SPAN_CODE:              WBufAppendCStr(r->outbuf, "<code>"); break;
-    case MD_SPAN_DEL:               WBufAppendCStr(r->outbuf, "<del>"); break;
-    case MD_SPAN_LATEXMATH:         WBufAppendCStr(r->outbuf, "<x-equation>"); break;
-    case MD_SPAN_LATEXMATH_DISPLAY: WBufAppendCStr(r->outbuf, "<x-equation type=\"display\">"); break;
-    case MD_SPAN_WIKILINK:          render_open_wikilink_span(r, (MD_SPAN_WIKILINK_DETAIL*) detail); break;
+  FmtJSON* r = (FmtJSON*)userdata;
+
+  switch (type) {
+    case MD_SPAN_EM:     open_node(r, "em"); break;
+    case MD_SPAN_STRONG: open_node(r, "strong"); break;
+    case MD_SPAN_U:      open_node(r, "u"); break;
+    case MD_SPAN_DEL:    open_node(r, "del"); break;
+    case MD_SPAN_CODE:   open_node(r, "code"); break;
+
+    case MD_SPAN_A: {
+      const MD_SPAN_A_DETAIL* d = (const MD_SPAN_A_DETAIL*)detail;
+      open_node(r, "a");
+      // omit "javascript:" URIs unless explicitly allowed
+      if ((r->flags & OutputFlagAllowJSURI) != 0 || !is_javascript_uri(&d->href))
+        write_attribute(r, "href", &d->href);
+      if (d->title.text != NULL)
+        write_attribute(r, "title", &d->title);
+      break;
+    }
+
+    case MD_SPAN_IMG: {
+      const MD_SPAN_IMG_DETAIL* d = (const MD_SPAN_IMG_DETAIL*)detail;
+      open_node(r, "img");
+      write_attribute(r, "src", &d->src);
+      if (d->title.text != NULL)
+        write_attribute(r, "title", &d->title);
+      break;
+    }
+
+    case MD_SPAN_WIKILINK:
+      open_node(r, "wikilink");
+      write_attribute(r, "target", &((const MD_SPAN_WIKILINK_DETAIL*)detail)->target);
+      break;
+
+    case MD_SPAN_LATEXMATH:
+      open_node(r, "math");
+      break;
+
+    case MD_SPAN_LATEXMATH_DISPLAY:
+      open_node(r, "math");
+      write_true_attr(r, "display");
+      break;
   }
 
+  open_children(r);
   return 0;
 }
 
 static int leave_span_callback(MD_SPANTYPE type, void* detail, void* userdata) {
-  JsonFormatter* r = (JsonFormatter*) userdata;
-
-  switch(type) {
-    case MD_SPAN_EM:                WBufAppendCStr(r->outbuf, "</em>"); break;
-    case MD_SPAN_STRONG:            WBufAppendCStr(r->outbuf, "</b>"); break;
-    case MD_SPAN_A:                 WBufAppendCStr(r->outbuf, "</a>"); break;
-    case MD_SPAN_IMG:               /*noop, handled above*/ break;
-    case MD_SPAN_CODE:              WBufAppendCStr(r->outbuf, "</code>"); break;
-    case MD_SPAN_DEL:               WBufAppendCStr(r->outbuf, "</del>"); break;
-    case MD_SPAN_LATEXMATH:         /*fall through*/
-    case MD_SPAN_LATEXMATH_DISPLAY: WBufAppendCStr(r->outbuf, "</x-equation>"); break;
-    case MD_SPAN_WIKILINK:          WBufAppendCStr(r->outbuf, "</x-wikilink>"); break;
-  }
-
+  close_children((FmtJSON*)userdata);
   return 0;
 }
 
 static int text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata) {
-  JsonFormatter* r = (JsonFormatter*)userdata;
-
-  WBufAppendCStr(r->outbuf, ", \"");
+  FmtJSON* r = (FmtJSON*)userdata;
+  char decoded[4];
+  size_t n;
 
   switch (type) {
-    case MD_TEXT_NULLCHAR:  WBufAppendCStr(r->outbuf, "\\0"); break;
-    case MD_TEXT_BR:        WBufAppendCStr(r->outbuf, "<br>"); break;
-    case MD_TEXT_SOFTBR:    WBufAppendc(r->outbuf, '\n'); break;
-    case MD_TEXT_HTML:      render_text(r, text, size); break;
-    case MD_TEXT_ENTITY:    writeDecodeXmlEntity(r, text, size); break;
-    default:                writeJsonEscaped(r, text, size); break;
-  }
+    case MD_TEXT_NULLCHAR:
+      open_text(r, TEXT_STRING);
+      write_bytes(r, ucReplacementUTF8, sizeof(ucReplacementUTF8));
+      break;
 
-  WBufAppendc(r->outbuf, '"');
+    case MD_TEXT_BR:
+      open_node(r, "br");
+      end_leaf(r);
+      break;
+
+    case MD_TEXT_SOFTBR:
+      open_text(r, TEXT_STRING);
+      write_bytes(r, "\\n", 2);
+      break;
+
+    case MD_TEXT_HTML:
+      open_text(r, r->htmlblock ? TEXT_STRING : TEXT_HTML);
+      write_escaped(r, text, size);
+      break;
+
+    case MD_TEXT_ENTITY:
+      n = decode_entity(text, size, decoded);
+      if (n > 0) {
+        open_text(r, TEXT_STRING);
+        write_escaped(r, decoded, n);
+      } else {
+        open_node(r, "entity");
+        write_key(r, "text");
+        WBufAppendc(r->outbuf, '"');
+        write_escaped(r, text, size);
+        WBufAppendc(r->outbuf, '"');
+        end_leaf(r);
+      }
+      break;
+
+    default:
+      open_text(r, TEXT_STRING);
+      write_escaped(r, text, size);
+      break;
+  }
 
   return 0;
 }
 
-int fmt_json(const MD_CHAR* input, MD_SIZE input_size, WBuf* outbuf, u32 parser_flags) {
-  JsonFormatter render = { outbuf };
+
+// The JSON of typical documents is 1.1-1.4 times the size of the input. Markup of
+// nodes takes up a larger part of small documents, which get a fixed extra.
+size_t fmt_json_outsize(const char* input, size_t len) {
+  return len + len / 2 + 256;
+}
+
+
+int fmt_json(const MD_CHAR* input, MD_SIZE input_size, FmtJSON* fmt) {
+  fmt->comma = 0;
+  fmt->textopen = TEXT_NONE;
+  fmt->htmlblock = 0;
+
   MD_PARSER parser = {
-    0,
-    parser_flags,
-    enter_block_callback,
-    leave_block_callback,
-    enter_span_callback,
-    leave_span_callback,
-    text_callback,
-    NULL, //debug_log_callback,
-    NULL
+    .flags = fmt->parserFlags,
+    .enter_block = enter_block_callback,
+    .leave_block = leave_block_callback,
+    .enter_span = enter_span_callback,
+    .leave_span = leave_span_callback,
+    .text = text_callback,
+    .stats = fmt->stats,
+    .ref_defs = fmt->refDefs,
   };
 
-  return md_parse(input, input_size, &parser, (void*) &render);
+  return fmt->mdctx ?
+    md_ctx_parse(fmt->mdctx, input, input_size, &parser, (void*)fmt) :
+    md_parse(input, input_size, &parser, (void*)fmt);
 }
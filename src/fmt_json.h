@@ -1,4 +1,44 @@
 #pragma once
-#include "wbuf.h"
+#include "md4c.h"
 
-int fmt_json(const char* input, u32 inputlen, WBuf* outbuf, u32 parserFlags);
+// FmtJSON renders the syntax tree of a document as compact JSON.
+//
+// Every node is an object with its type in "_", its attributes (if any) and, unless
+// it is a leaf, its content in "children". Runs of text are strings in children.
+//
+//   {"_":"doc","children":[{"_":"h","level":1,"children":["Hello ",
+//     {"_":"em","children":["world"]}]},{"_":"hr"}]}
+//
+// Blocks:  doc, quote, ul (tight), ol (start, tight, delimiter), li (checked, only
+//          for task list items), hr, h (level), code (lang, info), html, p, table,
+//          thead, tbody, tr, th (align), td (align)
+// Inlines: em, strong, u, del, code, a (href, title), img (src, title; the children
+//          are the alt text), wikilink (target), math (display), br, html (text),
+//          entity (text)
+//
+// Numeric character references and &amp; &lt; &gt; &quot; &apos; are decoded; other
+// named entities are "entity" nodes with the reference in text. Raw HTML of an html
+// block is text, inline HTML is "html" nodes. Attributes are omitted when they have
+// their default value (e.g. no "title", or "start" of 1).
+typedef struct FmtJSON {
+  OutputFlags    flags;       // only OutputFlagAllowJSURI is used
+  u32            parserFlags; // passed along to md_parse
+  WBuf*          outbuf;
+  MD_PARSER_CTX* mdctx;       // optional reusable parser context (see md_ctx_create)
+  const MD_REF_DEFS* refDefs; // optional shared link reference definitions
+
+  // optional: parser statistics to add to (see MD_STATS in md4c.h)
+  MD_STATS* stats;
+
+  // internal state
+  int comma;     // the current array has a value; the next one needs a comma
+  int textopen;  // kind of string open at the end of outbuf, which the next text of
+                 // the same kind is appended to
+  int htmlblock; // inside an html block, where raw HTML is text
+} FmtJSON;
+
+int fmt_json(const char* input, u32 inputlen, FmtJSON* fmt);
+
+// fmt_json_outsize returns an estimate of the size of the JSON produced for input,
+// for reserving space in outbuf up front.
+size_t fmt_json_outsize(const char* input, size_t inputlen);
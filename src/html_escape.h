@@ -0,0 +1,147 @@
+#pragma once
+// HTML escaping of text, shared by the HTML renderer (fmt_html.c) and the direct HTML
+// output of inline content in md4c.c (see MD_HTML_OUTPUT in md4c.h.)
+// Only uses standard C types so that it can be included by md4c.c.
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+static const char htmlEscapeMap[256] = {
+        /* 0 1 2 3 4 5 6 7 8 9 A B C D E F */
+/* 0x00 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // <CTRL> ...
+/* 0x10 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // <CTRL> ...
+/* 0x20 */ 0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,  //   ! " # $ % & ' ( ) * + , - . /
+/* 0x30 */ 0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,  // 0 1 2 3 4 5 6 7 8 9 : ; < = > ?
+/* 0x40 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // @ A B C D E F G H I J K L M N O
+/* 0x50 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // P Q R S T U V W X Y Z [ \ ] ^ _
+/* 0x60 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // ` a b c d e f g h i j k l m n o
+/* 0x70 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // p q r s t u v w x y z { | } ~ <DEL>
+/* 0x80 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // <CTRL> ...
+/* 0x90 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // <CTRL> ...
+/* 0xA0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // <NBSP> ¡ ¢ £ ¤ ¥ ¦ § ¨ © ª « ¬ <SOFTHYPEN> ® ¯
+/* 0xB0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // ° ± ² ³ ´ µ ¶ · ¸ ¹ º » ¼ ½ ¾ ¿
+/* 0xC0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // À Á Â Ã Ä Å Æ Ç È É Ê Ë Ì Í Î Ï
+/* 0xD0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // Ð Ñ Ò Ó Ô Õ Ö × Ø Ù Ú Û Ü Ý Þ ß
+/* 0xE0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // à á â ã ä å æ ç è é ê ë ì í î ï
+/* 0xF0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // ð ñ ò ó ô õ ö ÷ ø ù ú û ü ý þ ÿ
+};
+
+
+// Vectorized classification of bytes that need escaping, selected at build time.
+// Unlike md4c's mark char scanner this needs nothing beyond SSE2 since the set of
+// bytes is fixed and can be matched with plain compares.
+#if defined(__wasm_simd128__)
+  #include <wasm_simd128.h>
+  #define HTML_ESCAPE_SIMD
+
+  // stores p[0..16) to out and returns a bitmask with bit N set if p[N] needs escaping
+  static inline uint32_t html_escape_mask16(const char* p, char* out) {
+    v128_t v = wasm_v128_load(p);
+    wasm_v128_store(out, v);
+    v128_t m = wasm_v128_or(
+      wasm_v128_or(wasm_i8x16_eq(v, wasm_i8x16_splat('&')), wasm_i8x16_eq(v, wasm_i8x16_splat('<'))),
+      wasm_v128_or(wasm_i8x16_eq(v, wasm_i8x16_splat('>')), wasm_i8x16_eq(v, wasm_i8x16_splat('"'))));
+    return (uint32_t)wasm_i8x16_bitmask(m);
+  }
+#elif defined(__SSE2__)
+  #include <emmintrin.h>
+  #define HTML_ESCAPE_SIMD
+
+  static inline uint32_t html_escape_mask16(const char* p, char* out) {
+    __m128i v = _mm_loadu_si128((const __m128i*)p);
+    _mm_storeu_si128((__m128i*)out, v);
+    __m128i m = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('&')), _mm_cmpeq_epi8(v, _mm_set1_epi8('<'))),
+      _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('>')), _mm_cmpeq_epi8(v, _mm_set1_epi8('"'))));
+    return (uint32_t)_mm_movemask_epi8(m);
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  #include <arm_neon.h>
+  #define HTML_ESCAPE_SIMD
+
+  static inline uint32_t html_escape_mask16(const char* p, char* out) {
+    static const uint8_t lanebits[16] = { 1,2,4,8,16,32,64,128, 1,2,4,8,16,32,64,128 };
+    uint8x16_t v = vld1q_u8((const uint8_t*)p);
+    vst1q_u8((uint8_t*)out, v);
+    uint8x16_t m = vorrq_u8(
+      vorrq_u8(vceqq_u8(v, vdupq_n_u8('&')), vceqq_u8(v, vdupq_n_u8('<'))),
+      vorrq_u8(vceqq_u8(v, vdupq_n_u8('>')), vceqq_u8(v, vdupq_n_u8('"'))));
+    m = vandq_u8(m, vld1q_u8(lanebits));
+    return (uint32_t)vaddv_u8(vget_low_u8(m)) | ((uint32_t)vaddv_u8(vget_high_u8(m)) << 8);
+  }
+#endif
+
+
+// writes the escaped form of c to out and returns the number of bytes written
+static inline size_t html_escape_char(char c, char* out) {
+  switch (c) {
+    case '&': memcpy(out, "&amp;", 5);  return 5;
+    case '<': memcpy(out, "&lt;", 4);   return 4;
+    case '>': memcpy(out, "&gt;", 4);   return 4;
+    default:  memcpy(out, "&quot;", 6); return 6; // '"'
+  }
+}
+
+// returns the exact length of the escaped form of data
+static inline size_t html_escaped_len(const char* data, size_t size) {
+  size_t len = size;
+  for (size_t i = 0; i < size; i++) {
+    switch (data[i]) {
+      case '&': len += 4; break;
+      case '<': len += 3; break;
+      case '>': len += 3; break;
+      case '"': len += 5; break;
+    }
+  }
+  return len;
+}
+
+// html_escape writes the escaped form of data to out and returns the end of it.
+// out must have room for html_escaped_len(data, size) bytes, which is at most size*6.
+static inline char* html_escape(char* out, const char* data, size_t size) {
+  #define HTML_NEED_ESCAPE(ch)  (htmlEscapeMap[(unsigned char)(ch)] != 0)
+
+  size_t off = 0;
+
+  #ifdef HTML_ESCAPE_SIMD
+  // Clean bytes are stored 16 at a time straight to the output; we then advance past
+  // the clean prefix only. This is safe since the escaped form of the remaining
+  // size-off >= 16 bytes is at least that long.
+  while (off + 16 <= size) {
+    uint32_t mask = html_escape_mask16(data + off, out);
+    if (mask == 0) {
+      off += 16;
+      out += 16;
+      continue;
+    }
+    uint32_t i = (uint32_t)__builtin_ctz(mask);
+    out += i;
+    off += i;
+    out += html_escape_char(data[off++], out);
+  }
+  #endif
+
+  while (off < size) {
+    while (off + 3 < size &&
+           !HTML_NEED_ESCAPE(data[off+0]) &&
+           !HTML_NEED_ESCAPE(data[off+1]) &&
+           !HTML_NEED_ESCAPE(data[off+2]) &&
+           !HTML_NEED_ESCAPE(data[off+3]))
+    {
+      memcpy(out, data + off, 4);
+      out += 4;
+      off += 4;
+    }
+    if (off == size)
+      break;
+    char c = data[off++];
+    if (HTML_NEED_ESCAPE(c)) {
+      out += html_escape_char(c, out);
+    } else {
+      *out++ = c;
+    }
+  }
+
+  #undef HTML_NEED_ESCAPE
+  return out;
+}
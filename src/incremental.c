@@ -0,0 +1,307 @@
+#include "common.h"
+#include "fmt_html.h"
+#include "incremental.h"
+
+// top-level block
+typedef struct IncBlock {
+  u32 srcoff;  // start of the source line the block begins on
+  u32 htmloff; // start of the block's HTML
+} IncBlock;
+
+typedef struct IncRange {
+  u32 beg;
+  u32 end;
+} IncRange;
+
+// state of one fmt_html run, passed to the callbacks via FmtHTML.userdata
+typedef struct IncParse {
+  IncDoc* doc;
+  WBuf*   blocks;   // receives IncBlock entries
+  bool    full;     // parsing the whole document; record ref. defs.
+  bool    hasdefs;  // a ref. def. was found
+} IncParse;
+
+
+#define blocksv(b)  ((IncBlock*)(b)->start)
+#define nblocks(b)  ((u32)(WBufLen(b) / sizeof(IncBlock)))
+
+
+static void on_top_block(MD_OFFSET srcoff, void* userdata) {
+  FmtHTML* fmt = (FmtHTML*)userdata;
+  IncParse* p = (IncParse*)fmt->userdata;
+  IncBlock b = { srcoff, (u32)WBufLen(fmt->outbuf) };
+  WBufAppendBytes(p->blocks, &b, sizeof(b));
+}
+
+
+static void on_ref_def(
+  MD_OFFSET beg, MD_OFFSET end, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+  FmtHTML* fmt = (FmtHTML*)userdata;
+  IncParse* p = (IncParse*)fmt->userdata;
+  if (p->full) {
+    IncRange r = { beg, end };
+    WBufAppendBytes(&p->doc->refdefs, &r, sizeof(r));
+    WBufAppendBytes(&p->doc->reftext, text, size);
+    WBufAppendBytes(&p->doc->reftext, "\n\n", 2);
+  } else {
+    p->hasdefs = true;
+  }
+}
+
+
+static int render(IncDoc* d, IncParse* p, const char* src, u32 len, WBuf* outbuf) {
+  FmtHTML fmt = {
+    .flags = d->flags,
+    .parserFlags = d->parserFlags,
+    .outbuf = outbuf,
+    .mdctx = d->mdctx,
+    .refDefs = p->full ? NULL : d->refDefs,
+    .onTopBlock = on_top_block,
+    .onRefDef = on_ref_def,
+    .userdata = p,
+  };
+  return fmt_html(src, len, &fmt);
+}
+
+
+static int render_full(IncDoc* d) {
+  WBufReset(&d->html);
+  WBufReset(&d->blocks);
+  WBufReset(&d->refdefs);
+  WBufReset(&d->reftext);
+  WBufReserve(&d->html, fmt_html_outsize(d->src.start, WBufLen(&d->src)));
+  d->lastFull = true;
+  IncParse p = {
+    .doc = d,
+    .blocks = &d->blocks,
+    .full = true,
+  };
+  if (render(d, &p, d->src.start, WBufLen(&d->src), &d->html) != 0)
+    return -1;
+  if (d->refDefs) {
+    md_ref_defs_destroy(d->refDefs);
+    d->refDefs = NULL;
+  }
+  if (WBufLen(&d->reftext) > 0) {
+    d->refDefs = md_ref_defs_create(d->reftext.start, WBufLen(&d->reftext), d->parserFlags);
+    if (!d->refDefs)
+      return -1;
+  }
+  return 0;
+}
+
+
+// replaces len bytes at off in b with n bytes at ptr (which must not point into b)
+static void splice(WBuf* b, size_t off, size_t len, const void* ptr, size_t n) {
+  size_t taillen = WBufLen(b) - off - len;
+  if (n > len)
+    WBufReserve(b, n - len);
+  char* p = b->start + off;
+  memmove(p + n, p + len, taillen);
+  memcpy(p, ptr, n);
+  b->ptr = p + n + taillen;
+}
+
+
+// index of the last block starting at or before off, or 0 if there is none
+static u32 find_block(const IncBlock* v, u32 n, u32 off) {
+  u32 lo = 0, hi = n;
+  while (hi - lo > 1) {
+    u32 mid = (lo + hi) / 2;
+    if (v[mid].srcoff <= off) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+
+// true if the line before off is blank (or off is the start of the document)
+static bool follows_blank_line(const char* src, u32 off) {
+  if (off == 0)
+    return true;
+  const char* p = src + off - 1; // '\n' ending the previous line
+  while (p > src) {
+    char c = *--p;
+    if (c == '\n')
+      return true;
+    if (c != ' ' && c != '\t' && c != '\r')
+      return false;
+  }
+  return true;
+}
+
+
+// Tries to update the HTML after an edit (already applied to d->src) by
+// re-parsing just a window of top-level blocks around it. Returns false if the
+// whole document needs to be parsed instead.
+//
+// The window starts at the block before the one the edit starts in, since the
+// edit may join the two, or further back at a block that follows a blank line
+// (a block's first line is interpreted differently after e.g. a paragraph.)
+// Parsing is forward-only, so everything before that is unaffected. A block may
+// still read differently without what precedes it (e.g. tabs in a line after a
+// list), so unless the window starts the document, its first block must render
+// as it did in the whole document.
+// The window ends with the "anchor" block following the last
+// edited block. If the anchor still starts a top-level block at the same place
+// and renders the same, so does everything after it.
+// Links in the window are resolved with the link reference definitions of the
+// rest of the document (d->refDefs), as they would be in the whole document.
+static bool render_edit(IncDoc* d, u32 off, u32 dellen, u32 inslen) {
+  IncBlock* blocks = blocksv(&d->blocks);
+  u32 n = nblocks(&d->blocks);
+  if (n == 0)
+    return false;
+
+  u32 oldsrclen = WBufLen(&d->src) + dellen - inslen;
+  i32 srcdelta = (i32)inslen - (i32)dellen;
+
+  u32 bi = find_block(blocks, n, off);
+  u32 bj = find_block(blocks, n, off + dellen);
+  u32 wb = bi > 0 ? bi - 1 : 0;
+  while (wb > 0 && !follows_blank_line(d->src.start, blocks[wb].srcoff))
+    wb--;
+  u32 we = bj + 1; // anchor
+  bool hasanchor = we < n;
+  if (hasanchor && we + 1 == n) {
+    // no need for an anchor when it's the last block
+    hasanchor = false;
+    we = n;
+  }
+  u32 wlast = hasanchor ? we : n - 1;
+
+  u32 winbeg = wb == 0 ? 0 : blocks[wb].srcoff;
+  u32 winend = wlast + 1 < n ? blocks[wlast + 1].srcoff : oldsrclen; // in old source
+  u32 htmlbeg = wb == 0 ? 0 : blocks[wb].htmloff;
+  u32 htmlend = wlast + 1 < n ? blocks[wlast + 1].htmloff : WBufLen(&d->html);
+
+  // give up if the window holds any link reference definitions
+  const IncRange* refdefs = (const IncRange*)d->refdefs.start;
+  u32 nrefdefs = WBufLen(&d->refdefs) / sizeof(IncRange);
+  for (u32 i = 0; i < nrefdefs; i++) {
+    if (refdefs[i].beg < winend && refdefs[i].end >= winbeg)
+      return false;
+  }
+
+  u32 winlen = winend + srcdelta - winbeg;
+  WBufReset(&d->tmphtml);
+  WBufReset(&d->tmpblocks);
+  IncParse p = {
+    .doc = d,
+    .blocks = &d->tmpblocks,
+  };
+  if (render(d, &p, d->src.start + winbeg, winlen, &d->tmphtml) != 0)
+    return false;
+  if (p.hasdefs)
+    return false;
+
+  IncBlock* newblocks = blocksv(&d->tmpblocks);
+  u32 nnew = nblocks(&d->tmpblocks);
+
+  if (wb > 0) {
+    // the first block of the window precedes the edit and must render the same
+    if (nnew < 2 || newblocks[0].srcoff != 0)
+      return false;
+    u32 len = newblocks[1].htmloff - newblocks[0].htmloff;
+    if (len != blocks[wb + 1].htmloff - blocks[wb].htmloff ||
+        memcmp(d->tmphtml.start + newblocks[0].htmloff, d->html.start + blocks[wb].htmloff, len) != 0)
+    {
+      return false;
+    }
+  }
+
+  if (hasanchor) {
+    // the anchor must be the last block of the window and render the same
+    IncBlock* anchor = nnew > 0 ? &newblocks[nnew - 1] : NULL;
+    if (!anchor || anchor->srcoff != blocks[we].srcoff + srcdelta - winbeg)
+      return false;
+    u32 len = WBufLen(&d->tmphtml) - anchor->htmloff;
+    if (len != htmlend - blocks[we].htmloff ||
+        memcmp(d->tmphtml.start + anchor->htmloff, d->html.start + blocks[we].htmloff, len) != 0)
+    {
+      return false;
+    }
+  }
+
+  // splice the new HTML
+  i32 htmldelta = (i32)WBufLen(&d->tmphtml) - (i32)(htmlend - htmlbeg);
+  splice(&d->html, htmlbeg, htmlend - htmlbeg, d->tmphtml.start, WBufLen(&d->tmphtml));
+
+  // splice the new blocks, then adjust offsets of the blocks after them
+  for (u32 i = 0; i < nnew; i++) {
+    newblocks[i].srcoff += winbeg;
+    newblocks[i].htmloff += htmlbeg;
+  }
+  splice(&d->blocks, wb * sizeof(IncBlock), (wlast + 1 - wb) * sizeof(IncBlock),
+         newblocks, nnew * sizeof(IncBlock));
+  blocks = blocksv(&d->blocks);
+  n = nblocks(&d->blocks);
+  for (u32 i = wb + nnew; i < n; i++) {
+    blocks[i].srcoff += srcdelta;
+    blocks[i].htmloff += htmldelta;
+  }
+
+  // ref. defs. are either all before or all after the window
+  IncRange* rv = (IncRange*)d->refdefs.start;
+  for (u32 i = 0; i < nrefdefs; i++) {
+    if (rv[i].beg >= winend) {
+      rv[i].beg += srcdelta;
+      rv[i].end += srcdelta;
+    }
+  }
+
+  d->lastFull = false;
+  return true;
+}
+
+
+IncDoc* IncDocCreate(u32 parserFlags, OutputFlags flags) {
+  IncDoc* d = calloc(1, sizeof(IncDoc));
+  if (!d)
+    return NULL;
+  d->parserFlags = parserFlags;
+  d->flags = flags;
+  d->mdctx = md_ctx_create();
+  if (!d->mdctx) {
+    free(d);
+    return NULL;
+  }
+  return d;
+}
+
+
+void IncDocFree(IncDoc* d) {
+  md_ctx_destroy(d->mdctx);
+  if (d->refDefs)
+    md_ref_defs_destroy(d->refDefs);
+  WBufFree(&d->src);
+  WBufFree(&d->html);
+  WBufFree(&d->blocks);
+  WBufFree(&d->refdefs);
+  WBufFree(&d->reftext);
+  WBufFree(&d->tmphtml);
+  WBufFree(&d->tmpblocks);
+  free(d);
+}
+
+
+int IncDocSet(IncDoc* d, const char* src, u32 len) {
+  WBufReset(&d->src);
+  WBufAppendBytes(&d->src, src, len);
+  return render_full(d);
+}
+
+
+int IncDocEdit(IncDoc* d, u32 off, u32 dellen, const char* ins, u32 inslen) {
+  u32 srclen = WBufLen(&d->src);
+  if (off > srclen || dellen > srclen - off)
+    return -1;
+  splice(&d->src, off, dellen, ins, inslen);
+  if (render_edit(d, off, dellen, inslen))
+    return 0;
+  return render_full(d);
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "md4c.h"
+
+// IncDoc is a document kept around between edits, for live previews.
+//
+// It remembers where each top-level block starts in the source and in the HTML
+// output, so that an edit only needs to re-parse the few top-level blocks
+// around it. The HTML of those blocks is then spliced into the output.
+//
+// Link reference definitions may affect any link in the document. Edits which
+// add, change or remove one, fall back to parsing the whole document.
+typedef struct IncDoc {
+  u32            parserFlags;
+  OutputFlags    flags;
+  MD_PARSER_CTX* mdctx;   // reused for every parse
+
+  WBuf src;     // source text
+  WBuf html;    // HTML output
+  WBuf blocks;  // IncBlock[] in source order
+  WBuf refdefs; // IncRange[] source ranges of link reference definitions
+  WBuf reftext; // text of all link reference definitions, each one followed by "\n\n"
+  MD_REF_DEFS* refDefs; // the definitions in reftext, or NULL if there are none
+
+  // scratch space for incremental parsing
+  WBuf tmphtml;
+  WBuf tmpblocks;
+
+  bool lastFull; // true if the last update parsed the whole document
+} IncDoc;
+
+IncDoc* IncDocCreate(u32 parserFlags, OutputFlags flags);
+void IncDocFree(IncDoc*);
+
+// IncDocSet replaces the whole source and parses it. Returns 0 on success.
+int IncDocSet(IncDoc*, const char* src, u32 len);
+
+// IncDocEdit replaces dellen bytes at byte offset off with the inslen bytes at
+// ins and updates the HTML output. Returns 0 on success.
+int IncDocEdit(IncDoc*, u32 off, u32 dellen, const char* ins, u32 inslen);
@@ -1,13 +1,18 @@
 #include <ctype.h>
+#include <malloc.h>
 #include "common.h"
 #include "wlib.h"
 #include "fmt_html.h"
-// #include "fmt_json.h"
+#include "incremental.h"
+#include "stream.h"
+#include "fmt_json.h"
+#include "fmt_bin.h"
 
 typedef enum ErrorCode {
   ERR_NONE,
   ERR_MD_PARSE,
   ERR_OUTFLAGS,
+  ERR_EDIT_RANGE,
 } ErrorCode;
 
 
@@ -22,30 +27,133 @@ void __attribute__((constructor)) init() {
 // Must make sure to never use this across calls from WASM host.
 static WBuf outbuf;
 
+// Capacity of outbuf to retain between calls. 0 means no limit.
+static size_t outbufMaxRetain = 0;
 
+// outbuf_reset empties outbuf for a new call, first freeing it if it has grown
+// beyond outbufMaxRetain during an earlier call
+static void outbuf_reset() {
+  if (outbufMaxRetain > 0 && WBufCap(&outbuf) > outbufMaxRetain) {
+    WBufFree(&outbuf);
+    WBufInit(&outbuf);
+  } else {
+    WBufReset(&outbuf);
+  }
+}
+
+export void setOutbufMaxRetain(u32 size) {
+  outbufMaxRetain = size;
+}
+
+// outbufTrim is called by md.js once the result of a call has been copied out of
+// outbuf, so that an outbuf larger than outbufMaxRetain is freed right away rather
+// than by the next call.
+export void outbufTrim() {
+  outbuf_reset();
+}
+
+// releaseMemory frees outbuf, which invalidates the result of the last call.
+// Note that WASM memory can not shrink; the memory is only made available for
+// other allocations.
+export void releaseMemory() {
+  WBufFree(&outbuf);
+  WBufInit(&outbuf);
+}
+
+// memory usage as reported by memoryUsage, read by md.js
+typedef struct MemoryUsage {
+  u32 outbufCap;  // capacity of outbuf
+  u32 heapUsed;   // bytes in allocated chunks
+  u32 heapSize;   // bytes obtained from the system by malloc
+} MemoryUsage;
+
+static MemoryUsage memusage;
+
+export const MemoryUsage* memoryUsage() {
+  struct mallinfo mi = mallinfo();
+  memusage.outbufCap = (u32)WBufCap(&outbuf);
+  memusage.heapUsed = (u32)mi.uordblks;
+  memusage.heapSize = (u32)mi.arena;
+  return &memusage;
+}
+
+// Statistics of the last parseUTF8 call with withstats set
+static MD_STATS stats;
+
+export const MD_STATS* parseStats() {
+  return &stats;
+}
+
+
+// Reusable parser contexts, backing the Parser class in md.js.
+// A context keeps md4c's internal buffers allocated between parseUTF8 calls.
+export MD_PARSER_CTX* parserCreate() {
+  return md_ctx_create();
+}
+
+// releases memory retained by the context; it remains usable
+export void parserReset(MD_PARSER_CTX* ctx) {
+  md_ctx_reset(ctx);
+}
+
+export void parserDestroy(MD_PARSER_CTX* ctx) {
+  md_ctx_destroy(ctx);
+}
+
+
+// Shared link reference definitions, backing the RefDefs class in md.js.
+// Returns NULL if out of memory.
+export MD_REF_DEFS* refDefsCreate(const char* inbufptr, u32 inbuflen, u32 parser_flags) {
+  return md_ref_defs_create(inbufptr, inbuflen, parser_flags);
+}
+
+export void refDefsDestroy(MD_REF_DEFS* defs) {
+  md_ref_defs_destroy(defs);
+}
+
+
+// mdctx is optional (NULL for a one-off parse), as is refdefs.
+// nthreads > 1 renders large documents on up to that many threads; this
+// requires a build with MD4C_USE_THREADS and is ignored otherwise.
+// withstats collects statistics of the parse (see parseStats); this requires
+// a build with MD4C_STATS and yields all zeroes otherwise.
 export size_t parseUTF8(
   const char* inbufptr,
   u32 inbuflen,
   u32 parser_flags,
   OutputFlags outflags,
   const char** outptr,
-  JSTextFilterFun onCodeBlock
+  JSTextFilterFun onCodeBlock,
+  MD_PARSER_CTX* mdctx,
+  u32 nthreads,
+  bool withstats,
+  const MD_REF_DEFS* refdefs
 ) {
   dlog("parseUTF8 called with inbufptr=%p  inbuflen=%u", inbufptr, inbuflen);
 
-  WBufReset(&outbuf);
+  outbuf_reset();
 
   if ((outflags & OutputFlagHTML) || (outflags & OutputFlagXHTML)) {
-    WBufReserve(&outbuf, inbuflen * 2);  // approximate output size to minimize reallocations
+    WBufReserve(&outbuf, fmt_html_outsize(inbufptr, inbuflen));
 
     FmtHTML fmt = {
       .flags = outflags,
       .parserFlags = parser_flags,
       .outbuf = &outbuf,
+      .mdctx = mdctx,
+      .refDefs = refdefs,
       .onCodeBlock = onCodeBlock,
     };
+    if (withstats) {
+      memset(&stats, 0, sizeof(stats));
+      fmt.stats = &stats;
+    }
+
+#ifndef MD4C_USE_THREADS
+    nthreads = 1;
+#endif
 
-    if (fmt_html(inbufptr, inbuflen, &fmt) != 0) {
+    if (fmt_html_parallel(inbufptr, inbuflen, &fmt, nthreads) != 0) {
       // fmt_html returns status of md_parse which only fails in extreme cases
       // like when out of memory. md4c does not provide error codes or error messages.
       WErrSet(ERR_MD_PARSE, "md parser error");
@@ -58,7 +166,234 @@ export size_t parseUTF8(
     return WBufLen(&outbuf);
   }
 
+  if (outflags & OutputFlagJSON) {
+    WBufReserve(&outbuf, fmt_json_outsize(inbufptr, inbuflen));
+
+    FmtJSON fmt = {
+      .flags = outflags,
+      .parserFlags = parser_flags,
+      .outbuf = &outbuf,
+      .mdctx = mdctx,
+      .refDefs = refdefs,
+    };
+    if (withstats) {
+      memset(&stats, 0, sizeof(stats));
+      fmt.stats = &stats;
+    }
+
+    if (fmt_json(inbufptr, inbuflen, &fmt) != 0) {
+      WErrSet(ERR_MD_PARSE, "md parser error");
+      *outptr = 0;
+      return 0;
+    }
+
+    *outptr = outbuf.start;
+    return WBufLen(&outbuf);
+  }
+
+  if (outflags & OutputFlagBinary) {
+    // outbuf is empty, so the records are aligned for reading them as u32 in md.js
+    WBufReserve(&outbuf, fmt_bin_outsize(inbufptr, inbuflen));
+
+    FmtBin fmt = {
+      .parserFlags = parser_flags,
+      .outbuf = &outbuf,
+      .mdctx = mdctx,
+      .refDefs = refdefs,
+    };
+    if (withstats) {
+      memset(&stats, 0, sizeof(stats));
+      fmt.stats = &stats;
+    }
+
+    if (fmt_bin(inbufptr, inbuflen, &fmt) != 0) {
+      WErrSet(ERR_MD_PARSE, "md parser error");
+      *outptr = 0;
+      return 0;
+    }
+
+    *outptr = outbuf.start;
+    return WBufLen(&outbuf);
+  }
+
   WErrSet(ERR_OUTFLAGS, "no output format set in output flags");
   *outptr = 0;
   return 0;
 }
+
+
+// Streaming output. The JS function is called with each chunk of HTML, which is
+// only valid for the duration of the call. Returning non-zero aborts parsing.
+typedef int(*JSFlushFun)(const char* ptr, u32 len);
+
+static int flush_to_js(const char* data, size_t len, void* fmt) {
+  JSFlushFun onChunk = (JSFlushFun)((FmtHTML*)fmt)->userdata;
+  return onChunk(data, (u32)len);
+}
+
+// parseUTF8Stream is like parseUTF8 but passes the HTML to onChunk in chunks of
+// about chunksize bytes as it is produced, so only that much output needs to be
+// held in memory at a time.
+export void parseUTF8Stream(
+  const char* inbufptr,
+  u32 inbuflen,
+  u32 parser_flags,
+  OutputFlags outflags,
+  JSFlushFun onChunk,
+  u32 chunksize,
+  JSTextFilterFun onCodeBlock,
+  MD_PARSER_CTX* mdctx
+) {
+  if (!(outflags & OutputFlagHTML) && !(outflags & OutputFlagXHTML)) {
+    WErrSet(ERR_OUTFLAGS, "no output format set in output flags");
+    return;
+  }
+
+  outbuf_reset();
+  // room for a chunk plus whatever the block or text crossing the limit adds to it
+  WBufReserve(&outbuf, min(fmt_html_outsize(inbufptr, inbuflen), (size_t)chunksize * 2));
+
+  FmtHTML fmt = {
+    .flags = outflags,
+    .parserFlags = parser_flags,
+    .outbuf = &outbuf,
+    .mdctx = mdctx,
+    .onCodeBlock = onCodeBlock,
+    .onFlush = flush_to_js,
+    .flushSize = chunksize,
+    .userdata = (void*)onChunk,
+  };
+
+  if (fmt_html(inbufptr, inbuflen, &fmt) != 0)
+    WErrSet(ERR_MD_PARSE, "md parser error");
+}
+
+
+// Chunked input, backing the ChunkedParser class in md.js.
+// HTML is passed to onChunk as it is produced (see parseUTF8Stream.)
+static int output_to_js(const char* data, size_t len, void* userdata) {
+  JSFlushFun onChunk = (JSFlushFun)userdata;
+  return onChunk(data, (u32)len);
+}
+
+export StreamDoc* streamCreate(u32 parser_flags, OutputFlags outflags, JSFlushFun onChunk) {
+  return StreamDocCreate(parser_flags, outflags, output_to_js, (void*)onChunk);
+}
+
+export void streamFree(StreamDoc* doc) {
+  StreamDocFree(doc);
+}
+
+export void streamWrite(StreamDoc* doc, const char* inbufptr, u32 inbuflen) {
+  if (StreamDocWrite(doc, inbufptr, inbuflen) != 0)
+    WErrSet(ERR_MD_PARSE, "md parser error");
+}
+
+export void streamEnd(StreamDoc* doc) {
+  if (StreamDocEnd(doc) != 0)
+    WErrSet(ERR_MD_PARSE, "md parser error");
+}
+
+
+// parseUTF8Batch renders count documents in one call.
+// Document i is the bytes of inbufptr in the range [inoffs[i], inoffs[i+1]).
+// All HTML is written to one buffer (*outptr, the return value being its length)
+// and the HTML of document i is found at [outoffs[i], outoffs[i+1]).
+// Both inoffs and outoffs have count+1 entries.
+// mdctx is optional; without one, a context is used for the duration of the batch.
+// refdefs is optional.
+export size_t parseUTF8Batch(
+  const char* inbufptr,
+  const u32* inoffs,
+  u32 count,
+  u32 parser_flags,
+  OutputFlags outflags,
+  const char** outptr,
+  u32* outoffs,
+  JSTextFilterFun onCodeBlock,
+  MD_PARSER_CTX* mdctx,
+  const MD_REF_DEFS* refdefs
+) {
+  outbuf_reset();
+  *outptr = 0;
+
+  if (!(outflags & OutputFlagHTML) && !(outflags & OutputFlagXHTML)) {
+    WErrSet(ERR_OUTFLAGS, "no output format set in output flags");
+    return 0;
+  }
+
+  MD_PARSER_CTX* batchctx = mdctx ? mdctx : md_ctx_create();
+  WBufReserve(&outbuf, fmt_html_outsize(inbufptr + inoffs[0], inoffs[count] - inoffs[0]));
+
+  FmtHTML fmt = {
+    .flags = outflags,
+    .parserFlags = parser_flags,
+    .outbuf = &outbuf,
+    .mdctx = batchctx,
+    .refDefs = refdefs,
+    .onCodeBlock = onCodeBlock,
+  };
+
+  int err = 0;
+  for (u32 i = 0; i < count && !err; i++) {
+    outoffs[i] = (u32)WBufLen(&outbuf);
+    err = fmt_html(inbufptr + inoffs[i], inoffs[i + 1] - inoffs[i], &fmt);
+  }
+  outoffs[count] = (u32)WBufLen(&outbuf);
+
+  if (!mdctx)
+    md_ctx_destroy(batchctx);
+
+  if (err) {
+    WErrSet(ERR_MD_PARSE, "md parser error");
+    return 0;
+  }
+
+  *outptr = outbuf.start;
+  return WBufLen(&outbuf);
+}
+
+
+// Incremental documents, backing the IncrementalParser class in md.js.
+// The HTML stays owned by the document and is valid until its next update.
+export IncDoc* incCreate(u32 parser_flags, OutputFlags outflags) {
+  return IncDocCreate(parser_flags, outflags);
+}
+
+export void incFree(IncDoc* doc) {
+  IncDocFree(doc);
+}
+
+export size_t incSet(IncDoc* doc, const char* inbufptr, u32 inbuflen, const char** outptr) {
+  if (IncDocSet(doc, inbufptr, inbuflen) != 0) {
+    WErrSet(ERR_MD_PARSE, "md parser error");
+    *outptr = 0;
+    return 0;
+  }
+  *outptr = doc->html.start;
+  return WBufLen(&doc->html);
+}
+
+// replaces dellen bytes at byte offset off with inbuflen bytes at inbufptr
+export size_t incEdit(
+  IncDoc* doc,
+  u32 off,
+  u32 dellen,
+  const char* inbufptr,
+  u32 inbuflen,
+  const char** outptr
+) {
+  u32 srclen = WBufLen(&doc->src);
+  if (off > srclen || dellen > srclen - off) {
+    WErrSet(ERR_EDIT_RANGE, "edit range out of bounds");
+    *outptr = 0;
+    return 0;
+  }
+  if (IncDocEdit(doc, off, dellen, inbufptr, inbuflen) != 0) {
+    WErrSet(ERR_MD_PARSE, "md parser error");
+    *outptr = 0;
+    return 0;
+  }
+  *outptr = doc->html.start;
+  return WBufLen(&doc->html);
+}
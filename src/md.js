@@ -4,6 +4,7 @@ import {
   withOutPtr,
   werrCheck,
   mallocbuf,
+  free,
 } from "./wlib"
 
 export const ready = Module.ready
@@ -41,17 +42,579 @@ export const ParseFlags = {
   NO_HTML: 0x0020 | 0x0040, // NO_HTML_BLOCKS | NO_HTML_SPANS
 }
 
+// Syntax tree records of the "binary" format, read by ASTReader.
+// These should be in sync with fmt_bin.h and md4c.h
+export const ASTKind = { BLOCK: 1, SPAN: 2, END: 3, TEXT: 4, ATTR: 5 }
+
+export const BlockType = {
+  DOC: 0, QUOTE: 1, UL: 2, OL: 3, LI: 4, HR: 5, H: 6, CODE: 7, HTML: 8, P: 9,
+  TABLE: 10, THEAD: 11, TBODY: 12, TR: 13, TH: 14, TD: 15,
+}
+
+export const SpanType = {
+  EM: 0, STRONG: 1, A: 2, IMG: 3, CODE: 4, DEL: 5, LATEXMATH: 6, LATEXMATH_DISPLAY: 7,
+  WIKILINK: 8, U: 9,
+}
+
+export const TextType = {
+  NORMAL: 0, NULLCHAR: 1, BR: 2, SOFTBR: 3, ENTITY: 4, CODE: 5, HTML: 6, LATEXMATH: 7,
+}
+
+export const AttrType = { HREF: 1, TITLE: 2, SRC: 3, LANG: 4, INFO: 5, TARGET: 6 }
+
+export const ASTFlags = { TIGHT: 1 << 1, TASK: 1 << 2, CHECKED: 1 << 3 }
+
+const AST_POOL = 1 << 0 // text is in the string pool rather than the source
+
+const DEFAULT_CHUNK_SIZE = 64 * 1024
+
 // these should be in sync with "OutputFlags" in common.h
 const OutputFlags = {
   HTML:       1 << 0, // Output HTML
   XHTML:      1 << 1, // Output XHTML (only has effect with HTML flag set)
   AllowJSURI: 1 << 2, // Allow "javascript:" URIs
+  JSON:       1 << 3, // Output the syntax tree as JSON
+  Binary:     1 << 4, // Output the syntax tree as binary records
 }
 
 
 export function parse(source, options) {
+  return parseWithCtx(source, options, 0)
+}
+
+
+// InputBuffer is a region of WASM memory holding markdown source which can be passed to
+// parse() and friends in place of a string or byte array. The parser then reads the
+// source right where it is, without copying it.
+// Call dispose() when the buffer is no longer needed.
+export class InputBuffer {
+  constructor(capacity) {
+    this.ptr = 0
+    this.capacity = 0
+    this.length = 0  // number of valid bytes
+    reserve_input(this, capacity || 0)
+  }
+
+  // set writes source (a string or UTF-8 data) into the buffer, growing it as needed
+  set(source) {
+    write_input(this, source)
+  }
+
+  // bytes returns a view of the buffer's memory for writing UTF-8 data into directly,
+  // after which length should be set to the number of bytes written.
+  // The view must not be used after any other call into this module since the WASM
+  // memory may have grown, detaching the view.
+  bytes() {
+    return HEAPU8.subarray(this.ptr, this.ptr + this.capacity)
+  }
+
+  // reserve grows the buffer so that it can hold at least size bytes
+  reserve(size) {
+    reserve_input(this, size)
+  }
+
+  dispose() {
+    if (this.ptr) {
+      free(this.ptr)
+      this.ptr = 0
+      this.capacity = 0
+      this.length = 0
+    }
+  }
+}
+
+
+// Memory retained between calls, see setMemoryPolicy
+let maxRetained = 0  // bytes; 0 = no limit
+let idleRelease = 0  // milliseconds; 0 = never
+let lastUse = 0
+let idleTimer = null
+
+
+// setMemoryPolicy controls how much memory is kept around between calls for the internal
+// input and output buffers, which otherwise retain their largest size forever.
+//   maxRetained  buffers larger than this many bytes are freed after use
+//   idleRelease  release all memory when not used for this many milliseconds
+// Setting either to 0 (the default) disables it.
+export function setMemoryPolicy(policy) {
+  maxRetained = policy.maxRetained || 0
+  idleRelease = policy.idleRelease || 0
+  _setOutbufMaxRetain(maxRetained)
+  if (maxRetained > 0 && heapInput.capacity > maxRetained)
+    release_input()
+  if (idleTimer) {
+    clearTimeout(idleTimer)
+    idleTimer = null
+  }
+  note_use()
+}
+
+
+// releaseMemory frees the internal input and output buffers. A result returned with the
+// bytes option is no longer valid afterwards. WASM memory can not shrink, but the memory
+// is reused for later calls rather than the WASM memory growing further.
+export function releaseMemory() {
+  _releaseMemory()
+  if (!heapInputBusy)
+    release_input()
+}
+
+
+// release_output is called once the result of a call has been copied out of the output
+// buffer, to free it if it is larger than setMemoryPolicy allows
+function release_output() {
+  if (maxRetained > 0)
+    _outbufTrim()
+}
+
+
+// memoryUsage returns the current memory use of the module in bytes
+export function memoryUsage() {
+  let p = _memoryUsage() >> 2
+  return {
+    memorySize:   HEAPU8.length,      // size of WASM memory (never shrinks)
+    heapSize:     HEAPU32[p + 2],     // memory obtained by malloc
+    heapUsed:     HEAPU32[p + 1],     // memory currently allocated
+    outputBuffer: HEAPU32[p],
+    inputBuffer:  heapInput.capacity,
+  }
+}
+
+
+function note_use() {
+  if (idleRelease > 0) {
+    lastUse = Date.now()
+    if (!idleTimer)
+      schedule_idle_release(idleRelease)
+  }
+}
+
+function schedule_idle_release(delay) {
+  idleTimer = setTimeout(() => {
+    idleTimer = null
+    let idle = Date.now() - lastUse
+    if (idle >= idleRelease) {
+      releaseMemory()
+    } else {
+      schedule_idle_release(idleRelease - idle)
+    }
+  }, delay)
+  // don't keep NodeJS processes alive
+  if (idleTimer.unref)
+    idleTimer.unref()
+}
+
+
+// parseChunked renders source like parse() but, rather than returning all the HTML at
+// once, passes it to onChunk in pieces of about options.chunkSize bytes (default 64 kB)
+// as it is produced. This keeps memory use low for very large documents.
+// A chunk is a view into WASM memory which is only valid during the call to onChunk;
+// use chunk.slice() to keep a copy.
+export function parseChunked(source, onChunk, options) {
   options = options || {}
 
+  let [parseFlags, outputFlags] = htmlOptionFlags(options, "parseChunked")
+  let chunkSize = options.chunkSize || DEFAULT_CHUNK_SIZE
+
+  let onCodeBlockPtr = options.onCodeBlock ? create_onCodeBlock_fn(options.onCodeBlock) : 0
+
+  let chunkErr = null
+  let onChunkPtr = addFunction(function(ptr, len) {
+    try {
+      onChunk(HEAPU8.subarray(ptr, ptr + len))
+      return 0
+    } catch (err) {
+      chunkErr = err
+      return -1  // abort
+    }
+  }, "iii")
+
+  with_input(source, (inptr, inlen) =>
+    _parseUTF8Stream(
+      inptr, inlen, parseFlags, outputFlags, onChunkPtr, chunkSize, onCodeBlockPtr, 0)
+  )
+
+  removeFunction(onChunkPtr)
+  if (options.onCodeBlock)
+    removeFunction(onCodeBlockPtr)
+
+  if (chunkErr) {
+    _WErrClear()
+    throw chunkErr
+  }
+  werrCheck()
+}
+
+
+// parseStream returns a ReadableStream of the HTML of source, in Uint8Array chunks.
+// The source is parsed by a ChunkedParser in pieces of options.chunkSize bytes (default
+// 64 kB) as the stream is read, so HTML is available before all of it has been parsed,
+// and a reader which falls behind holds up the parsing rather than the HTML queueing up.
+// The onCodeBlock option is not supported. In NodeJS, stream.Readable.fromWeb() turns
+// the stream into a Readable.
+export function parseStream(source, options) {
+  let chunkSize = (options && options.chunkSize) || DEFAULT_CHUNK_SIZE
+  let isString = typeof source == "string"
+  if (!isString)
+    source = as_byte_array(source)
+  let offset = 0
+  let nchunks = 0
+  let parser = null
+  return new ReadableStream({
+    start(controller) {
+      parser = new ChunkedParser(chunk => {
+        // the chunk is a view into WASM memory which is only valid during this call
+        controller.enqueue(chunk.slice())
+        nchunks++
+      }, options)
+    },
+    pull(controller) {
+      try {
+        // write pieces of source until some HTML comes out or the source is all written
+        let n = nchunks
+        while (nchunks == n && offset < source.length) {
+          let end = Math.min(offset + chunkSize, source.length)
+          if (isString) {
+            if (end < source.length && (source.charCodeAt(end - 1) & 0xFC00) == 0xD800)
+              end++  // don't split a surrogate pair
+            parser.write(source.substring(offset, end))
+          } else {
+            parser.write(source.subarray(offset, end))
+          }
+          offset = end
+        }
+        if (offset == source.length) {
+          parser.end()
+          parser.dispose()
+          controller.close()
+        }
+      } catch (err) {
+        parser.dispose()
+        throw err
+      }
+    },
+    cancel() {
+      parser.dispose()
+    },
+  })
+}
+
+
+// ChunkedParser parses a document which is provided in chunks, e.g. as it arrives over
+// the network, passing its HTML to onChunk (like parseChunked) as soon as top-level blocks
+// are complete. Only the incomplete part of the document is kept in memory, unless it may
+// refer to link reference definitions yet to come, in which case the HTML from there on
+// is held back until end().
+// String chunks must not split surrogate pairs. UTF-8 chunks may be split anywhere.
+// Options are the same as for parse(), except for onCodeBlock which is not supported.
+// Call dispose() when the parser is no longer needed.
+export class ChunkedParser {
+  constructor(onChunk, options) {
+    options = options || {}
+    if (options.onCodeBlock)
+      throw new Error("onCodeBlock is not supported by ChunkedParser")
+    let [parseFlags, outputFlags] = htmlOptionFlags(options, "ChunkedParser")
+    this.chunkErr = null
+    this.onChunkPtr = addFunction((ptr, len) => {
+      try {
+        onChunk(HEAPU8.subarray(ptr, ptr + len))
+        return 0
+      } catch (err) {
+        this.chunkErr = err
+        return -1  // abort
+      }
+    }, "iii")
+    this.ptr = _streamCreate(parseFlags, outputFlags, this.onChunkPtr)
+  }
+
+  // write adds source to the document
+  write(source) {
+    if (!this.ptr)
+      throw new Error("ChunkedParser has been disposed")
+    with_input(source, (inptr, inlen) => _streamWrite(this.ptr, inptr, inlen))
+    this._check()
+  }
+
+  // end completes the document. The parser can then be used for a new document.
+  end() {
+    if (!this.ptr)
+      throw new Error("ChunkedParser has been disposed")
+    _streamEnd(this.ptr)
+    this._check()
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _streamFree(this.ptr)
+      removeFunction(this.onChunkPtr)
+      this.ptr = 0
+    }
+  }
+
+  _check() {
+    let err = this.chunkErr
+    if (err) {
+      this.chunkErr = null
+      _WErrClear()
+      throw err
+    }
+    werrCheck()
+  }
+}
+
+
+// createParseStream returns a TransformStream which turns markdown, written to it in
+// chunks of text or UTF-8 data, into HTML, e.g.
+//   response.body.pipeThrough(createParseStream())
+export function createParseStream(options) {
+  let parser
+  return new TransformStream({
+    start(controller) {
+      parser = new ChunkedParser(chunk => controller.enqueue(chunk.slice()), options)
+    },
+    transform(chunk) {
+      try {
+        parser.write(chunk)
+      } catch (err) {
+        parser.dispose()
+        throw err
+      }
+    },
+    flush() {
+      try {
+        parser.end()
+      } finally {
+        parser.dispose()
+      }
+    },
+  })
+}
+
+
+// parseBatch renders many documents in a single call into WASM, which is a lot faster
+// than calling parse() for each one when the documents are small.
+// Returns the HTML of each document, or with the bytes option set, the HTML of all
+// documents in one Uint8Array plus the offsets of each document's HTML in it.
+export function parseBatch(sources, options) {
+  return parseBatchWithCtx(sources, options, 0)
+}
+
+
+// Parser is a reusable parser which keeps its internal memory (buffers and lookup tables)
+// around between calls to parse(). This makes parsing many small documents cheaper.
+// Call dispose() when the parser is no longer needed.
+export class Parser {
+  constructor() {
+    this.ptr = _parserCreate()
+  }
+
+  parse(source, options) {
+    if (!this.ptr)
+      throw new Error("Parser has been disposed")
+    return parseWithCtx(source, options, this.ptr)
+  }
+
+  parseBatch(sources, options) {
+    if (!this.ptr)
+      throw new Error("Parser has been disposed")
+    return parseBatchWithCtx(sources, options, this.ptr)
+  }
+
+  // reset releases memory retained by the parser. The parser remains usable.
+  reset() {
+    if (this.ptr)
+      _parserReset(this.ptr)
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _parserDestroy(this.ptr)
+      this.ptr = 0
+    }
+  }
+}
+
+
+// RefDefs holds link reference definitions which are shared by many documents, like a
+// common footer, parsed once. Given as the refDefs option of parse(), they resolve links
+// to labels which the document does not define itself. Only options.parseFlags is used.
+// Call dispose() when no longer needed.
+export class RefDefs {
+  constructor(source, options) {
+    let [parseFlags] = parseOptionFlags(options || {})
+    this.ptr = with_input(source, (inptr, inlen) => _refDefsCreate(inptr, inlen, parseFlags))
+    if (!this.ptr)
+      throw new Error("out of memory")
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _refDefsDestroy(this.ptr)
+      this.ptr = 0
+    }
+  }
+}
+
+
+// IncrementalParser keeps a document around so that, after an edit, only the top-level
+// blocks around the edit need to be parsed again. This is useful for live previews.
+// Options are the same as for parse(), except for onCodeBlock which is not supported.
+// Call dispose() when the parser is no longer needed.
+export class IncrementalParser {
+  constructor(options) {
+    options = options || {}
+    if (options.onCodeBlock)
+      throw new Error("onCodeBlock is not supported by IncrementalParser")
+    let [parseFlags, outputFlags] = htmlOptionFlags(options, "IncrementalParser")
+    this.options = options
+    this.source = null
+    this.ptr = _incCreate(parseFlags, outputFlags)
+  }
+
+  // parse replaces the document with source and returns its HTML
+  parse(source) {
+    if (!this.ptr)
+      throw new Error("IncrementalParser has been disposed")
+    this.source = typeof source == "string" ? source : null
+    let outbuf = withOutPtr(outptr => with_input(source, (inptr, inlen) =>
+      _incSet(this.ptr, inptr, inlen, outptr)
+    ))
+    werrCheck()
+    return this._result(outbuf)
+  }
+
+  // edit replaces deleteCount characters at offset with text and returns the updated HTML.
+  // Offsets are in UTF-16 code units when the document was given as a string, and in
+  // bytes when it was given as UTF-8 data.
+  edit(offset, deleteCount, text) {
+    if (!this.ptr)
+      throw new Error("IncrementalParser has been disposed")
+    let off = offset, dellen = deleteCount
+    if (this.source !== null) {
+      if (typeof text != "string")
+        text = utf8.decode(as_byte_array(text))
+      let s = this.source
+      off = utf8_length(s, 0, offset)
+      dellen = utf8_length(s, offset, offset + deleteCount)
+      this.source = s.substr(0, offset) + text + s.substr(offset + deleteCount)
+    }
+    let outbuf = withOutPtr(outptr => with_input(text, (inptr, inlen) =>
+      _incEdit(this.ptr, off, dellen, inptr, inlen, outptr)
+    ))
+    werrCheck()
+    return this._result(outbuf)
+  }
+
+  dispose() {
+    if (this.ptr) {
+      _incFree(this.ptr)
+      this.ptr = 0
+      this.source = null
+    }
+  }
+
+  _result(outbuf) {
+    outbuf = outbuf || new Uint8Array(0)
+    if (this.options.bytes || this.options.asMemoryView)
+      return outbuf
+    return utf8.decode(outbuf)
+  }
+}
+
+
+// ASTReader reads the syntax tree which parse() returns with format "binary" right
+// where it is in WASM memory (see fmt_bin.h for the layout), without creating any
+// objects other than for the strings asked for. Nodes are referred to by the index of
+// their record; the document is node 0. Like the result of parse() with the bytes
+// option, it is only valid until the next call into this module.
+//
+// Text and attributes refer to the source by offset where possible. When the source
+// passed to parse() was a Uint8Array, textBytes returns views of that array, and when
+// it was an ASCII string, text returns substrings of it, neither of which copies any
+// text nor depends on WASM memory staying as it is.
+export class ASTReader {
+  constructor(outbuf, srcptr, source, srclen) {
+    let p = outbuf.heapAddr >> 2
+    this.bytes = outbuf           // the encoded tree
+    this.length = HEAPU32[p]      // number of records
+    this.rec = p + 4              // index in HEAPU32 of the first record
+    this.pool = outbuf.heapAddr + HEAPU32[p + 1]
+    this.src = srcptr
+    // the caller's source, when offsets into the UTF-8 source are offsets into it too
+    this.srcBytes = (source instanceof Uint8Array) ? source : null
+    this.srcString = (typeof source == "string" && source.length == srclen) ? source : null
+  }
+
+  kind(i)  { return HEAPU32[this.rec + i * 4] & 0xff }           // ASTKind
+  type(i)  { return (HEAPU32[this.rec + i * 4] >> 8) & 0xff }    // BlockType, SpanType, ...
+  flags(i) { return HEAPU32[this.rec + i * 4] >>> 16 }           // ASTFlags
+  a(i)     { return HEAPU32[this.rec + i * 4 + 1] }              // details, see fmt_bin.h
+  b(i)     { return HEAPU32[this.rec + i * 4 + 2] }
+
+  // end returns the index of the END record of block or span i
+  end(i) { return HEAPU32[this.rec + i * 4 + 3] }
+
+  // next returns the index of the record following node i and its contents
+  next(i) {
+    let k = this.kind(i)
+    return (k == ASTKind.BLOCK || k == ASTKind.SPAN) ? this.end(i) + 1 : i + 1
+  }
+
+  // attr returns the index of the attribute of block or span i of the given AttrType,
+  // or -1 if it has none
+  attr(i, type) {
+    for (let j = i + 1; j < this.length && this.kind(j) == ASTKind.ATTR; j++) {
+      if (this.type(j) == type)
+        return j
+    }
+    return -1
+  }
+
+  // offset returns the byte offset in the source of text or attribute i, or -1 if its
+  // bytes are not found verbatim in the source
+  offset(i) {
+    return (this.flags(i) & AST_POOL) ? -1 : this.a(i)
+  }
+
+  // textBytes returns a view of the UTF-8 bytes of text or attribute i
+  textBytes(i) {
+    let a = this.a(i)
+    if (this.flags(i) & AST_POOL)
+      return HEAPU8.subarray(this.pool + a, this.pool + a + this.b(i))
+    if (this.srcBytes)
+      return this.srcBytes.subarray(a, a + this.b(i))
+    return HEAPU8.subarray(this.src + a, this.src + a + this.b(i))
+  }
+
+  // text returns text or attribute i as a string
+  text(i) {
+    if (this.srcString && !(this.flags(i) & AST_POOL))
+      return this.srcString.substring(this.a(i), this.a(i) + this.b(i))
+    return utf8.decode(this.textBytes(i))
+  }
+
+  // textContent returns the text of node i and its contents, like the DOM property
+  textContent(i) {
+    let k = this.kind(i)
+    if (k == ASTKind.TEXT || k == ASTKind.ATTR)
+      return this.text(i)
+    let s = ""
+    for (let j = i + 1, end = this.end(i); j < end; j++) {
+      if (this.kind(j) != ASTKind.TEXT)
+        continue
+      switch (this.type(j)) {
+        case TextType.NULLCHAR: s += "\uFFFD"; break
+        case TextType.BR:
+        case TextType.SOFTBR:   s += "\n"; break
+        default:                s += this.text(j); break
+      }
+    }
+    return s
+  }
+}
+
+
+function parseOptionFlags(options) {
   let parseFlags = (
     options.parseFlags === undefined ? ParseFlags.DEFAULT :
     options.parseFlags
@@ -71,16 +634,57 @@ export function parse(source, options) {
       outputFlags |= OutputFlags.HTML
       break
 
+    case "json":
+      outputFlags |= OutputFlags.JSON
+      break
+
+    case "binary":
+      outputFlags |= OutputFlags.Binary
+      break
+
     default:
       throw new Error(`invalid format "${options.format}"`)
   }
 
+  return [parseFlags, outputFlags]
+}
+
+
+// ref_defs_ptr returns the address of the RefDefs in options.refDefs, or 0 if none
+function ref_defs_ptr(options) {
+  if (!options.refDefs)
+    return 0
+  if (!options.refDefs.ptr)
+    throw new Error("RefDefs has been disposed")
+  return options.refDefs.ptr
+}
+
+
+// htmlOptionFlags is parseOptionFlags for functions which only produce HTML
+function htmlOptionFlags(options, funcname) {
+  let flags = parseOptionFlags(options)
+  if (flags[1] & (OutputFlags.JSON | OutputFlags.Binary))
+    throw new Error(`format "${options.format}" is not supported by ${funcname}`)
+  return flags
+}
+
+
+function parseWithCtx(source, options, ctxptr) {
+  options = options || {}
+
+  let [parseFlags, outputFlags] = parseOptionFlags(options)
+
+  let refDefsPtr = ref_defs_ptr(options)
   let onCodeBlockPtr = options.onCodeBlock ? create_onCodeBlock_fn(options.onCodeBlock) : 0
 
-  let buf = as_byte_array(source)
-  let outbuf = withOutPtr(outptr => withTmpBytePtr(buf, (inptr, inlen) =>
-    _parseUTF8(inptr, inlen, parseFlags, outputFlags, outptr, onCodeBlockPtr)
-  ))
+  let binary = (outputFlags & OutputFlags.Binary) != 0
+  let inputptr = 0, inputlen = 0
+  let outbuf = withOutPtr(outptr => with_input(source, (inptr, inlen) => {
+    inputptr = inptr
+    inputlen = inlen
+    return _parseUTF8(inptr, inlen, parseFlags, outputFlags, outptr, onCodeBlockPtr, ctxptr,
+                      options.threads || 1, options.stats ? 1 : 0, refDefsPtr)
+  }, binary))
 
   if (options.onCodeBlock)
     removeFunction(onCodeBlockPtr)
@@ -93,10 +697,113 @@ export function parse(source, options) {
   //   console.log(utf8.decode(outbuf))
   // }
 
+  if (binary) {
+    let ast = new ASTReader(outbuf, inputptr, source, inputlen)
+    if (options.stats)
+      return { ast, stats: read_stats(_parseStats(), inputlen) }
+    return ast
+  }
+
+  let view = options.bytes || options.asMemoryView
+
+  if (outputFlags & OutputFlags.JSON) {
+    let ast = view ? outbuf : JSON.parse(utf8.decode(outbuf))
+    if (!view)
+      release_output()
+    if (options.stats)
+      return { ast, stats: read_stats(_parseStats(), inputlen) }
+    return ast
+  }
+
+  let html = view ? outbuf : utf8.decode(outbuf)
+  if (!view)
+    release_output()
+
+  if (options.stats)
+    return { html, stats: read_stats(_parseStats(), inputlen) }
+
+  return html
+}
+
+
+// read_stats reads MD_STATS (md4c.h) at ptr, a struct of u64 fields
+function read_stats(ptr, inputlen) {
+  let u64 = i => HEAPU32[(ptr >> 2) + i * 2] + HEAPU32[(ptr >> 2) + i * 2 + 1] * 0x100000000
+  return {
+    bytes:         inputlen,
+    analyzeTime:   u64(0) / 1e6,
+    processTime:   u64(1) / 1e6,
+    scannedBytes:  u64(2),
+    marks:         u64(3),
+    rollbacks:     u64(4),
+    blocks:        u64(5),
+    containers:    u64(6),
+    refDefs:       u64(7),
+    refDefLookups: u64(8),
+  }
+}
+
+
+function parseBatchWithCtx(sources, options, ctxptr) {
+  options = options || {}
+
+  let [parseFlags, outputFlags] = htmlOptionFlags(options, "parseBatch")
+
+  let count = sources.length
+  let bufs = new Array(count)
+  let inlen = 0
+  for (let i = 0; i < count; i++) {
+    let source = sources[i]
+    bufs[i] = source instanceof InputBuffer ? source : as_byte_array(source)
+    inlen += bufs[i].length
+  }
+
+  let refDefsPtr = ref_defs_ptr(options)
+  let onCodeBlockPtr = options.onCodeBlock ? create_onCodeBlock_fn(options.onCodeBlock) : 0
+
+  // Everything goes into one heap allocation:
+  //   u32 inoffs[count+1], u32 outoffs[count+1], u8 input[inlen]
+  let tablesize = (count + 1) * 4
+  let inoffsptr = _wrealloc(0, tablesize * 2 + inlen)
+  let outoffsptr = inoffsptr + tablesize
+  let inptr = outoffsptr + tablesize
+  let inoff = 0
+  for (let i = 0; i < count; i++) {
+    HEAPU32[(inoffsptr >> 2) + i] = inoff
+    if (bufs[i] instanceof InputBuffer) {
+      HEAPU8.copyWithin(inptr + inoff, bufs[i].ptr, bufs[i].ptr + bufs[i].length)
+    } else {
+      HEAPU8.set(bufs[i], inptr + inoff)
+    }
+    inoff += bufs[i].length
+  }
+  HEAPU32[(inoffsptr >> 2) + count] = inoff
+
+  let outbuf, offsets
+  try {
+    outbuf = withOutPtr(outptr =>
+      _parseUTF8Batch(
+        inptr, inoffsptr, count, parseFlags, outputFlags, outptr, outoffsptr,
+        onCodeBlockPtr, ctxptr, refDefsPtr)
+    ) || new Uint8Array(0)
+    offsets = HEAPU32.slice(outoffsptr >> 2, (outoffsptr >> 2) + count + 1)
+  } finally {
+    free(inoffsptr)
+    note_use()
+    if (options.onCodeBlock)
+      removeFunction(onCodeBlockPtr)
+  }
+
+  werrCheck()
+
   if (options.bytes || options.asMemoryView)
-    return outbuf
+    return { bytes: outbuf, offsets }
 
-  return utf8.decode(outbuf)
+  let results = new Array(count)
+  for (let i = 0; i < count; i++)
+    results[i] = utf8.decode(outbuf.subarray(offsets[i], offsets[i + 1]))
+  release_output()
+  return results
 }
 
 
@@ -145,9 +852,118 @@ function create_onCodeBlock_fn(onCodeBlock) {
 }
 
 
+// Sources which are not an InputBuffer are written into this buffer, which is kept
+// around between calls. Strings are UTF-8 encoded straight into it.
+const heapInput = { ptr: 0, capacity: 0, length: 0 }
+let heapInputBusy = false
+
+const encoder = (
+  typeof TextEncoder != "undefined" && TextEncoder.prototype.encodeInto ?
+    new TextEncoder() :
+    null
+)
+
+
+// with_input calls fn with the address and size of source in WASM memory.
+// With keep set, the internal input buffer is not released after the call, even when
+// larger than setMemoryPolicy allows, since the result refers to the source in it.
+function with_input(source, fn, keep) {
+  if (source instanceof InputBuffer)
+    return fn(source.ptr, source.length)
+  if (heapInputBusy) {
+    // called again from within fn, i.e. from an onCodeBlock callback
+    return withTmpBytePtr(as_byte_array(source), fn)
+  }
+  write_input(heapInput, source)
+  heapInputBusy = true
+  try {
+    return fn(heapInput.ptr, heapInput.length)
+  } finally {
+    heapInputBusy = false
+    if (maxRetained > 0 && heapInput.capacity > maxRetained && !keep)
+      release_input()
+    note_use()
+  }
+}
+
+
+function release_input() {
+  if (heapInput.ptr) {
+    free(heapInput.ptr)
+    heapInput.ptr = 0
+    heapInput.capacity = 0
+    heapInput.length = 0
+  }
+}
+
+
+// write_input writes source as UTF-8 into the memory of buf (heapInput or an InputBuffer),
+// growing it as needed
+function write_input(buf, source) {
+  if (source instanceof InputBuffer) {
+    reserve_input(buf, source.length)
+    HEAPU8.copyWithin(buf.ptr, source.ptr, source.ptr + source.length)
+    buf.length = source.length
+    return
+  }
+  if (typeof source == "string" && encoder) {
+    // Most text is ASCII, so start out assuming one byte per character. When that turns
+    // out to be too little, grow the buffer by exactly what the rest of the text needs.
+    reserve_input(buf, source.length)
+    let r = encoder.encodeInto(source, HEAPU8.subarray(buf.ptr, buf.ptr + buf.capacity))
+    let written = r.written
+    if (r.read < source.length) {
+      let rest = source.substring(r.read)
+      reserve_input(buf, written + utf8_length(rest, 0, rest.length))
+      written += encoder.encodeInto(
+        rest, HEAPU8.subarray(buf.ptr + written, buf.ptr + buf.capacity)).written
+    }
+    buf.length = written
+    return
+  }
+  let bytes = as_byte_array(source)
+  reserve_input(buf, bytes.length)
+  HEAPU8.set(bytes, buf.ptr)
+  buf.length = bytes.length
+}
+
+
+function reserve_input(buf, size) {
+  if (buf.capacity < size) {
+    // grow by at least 50% to avoid many small reallocations
+    let capacity = Math.max(size, buf.capacity + (buf.capacity >> 1))
+    buf.ptr = _wrealloc(buf.ptr, capacity)
+    buf.capacity = capacity
+  }
+}
+
+
+// utf8_length returns the number of bytes needed to UTF-8 encode s.substring(start, end)
+function utf8_length(s, start, end) {
+  let n = 0
+  for (let i = start; i < end; i++) {
+    let c = s.charCodeAt(i)
+    if (c < 0x80) {
+      n++
+    } else if (c < 0x800) {
+      n += 2
+    } else if (c >= 0xD800 && c <= 0xDBFF && i + 1 < end &&
+               (s.charCodeAt(i + 1) & 0xFC00) == 0xDC00) {
+      n += 4  // surrogate pair
+      i++
+    } else {
+      n += 3
+    }
+  }
+  return n
+}
+
+
 function as_byte_array(something) {
   if (typeof something == "string")
     return utf8.encode(something)
+  if (something instanceof InputBuffer)
+    return HEAPU8.slice(something.ptr, something.ptr + something.length)
   if (something instanceof Uint8Array)
     return something
   return new Uint8Array(something)
@@ -26,10 +26,48 @@
 #include "md4c.h"
 
 #include <limits.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+/* Vectorized scanning for mark characters (see md_scan_mark_chars()).
+ * The variant is selected at build time; without any of these, md4c falls
+ * back to the plain (unrolled) scalar loop. */
+#if !defined MD4C_USE_UTF16 && !defined MD4C_NO_SIMD
+    #if defined __wasm_simd128__
+        #include <wasm_simd128.h>
+        #define MD4C_SIMD_WASM
+    #elif defined __SSSE3__
+        #include <tmmintrin.h>
+        #define MD4C_SIMD_SSSE3
+    #elif defined __ARM_NEON && defined __aarch64__
+        #include <arm_neon.h>
+        #define MD4C_SIMD_NEON
+    #endif
+#endif
+#if defined MD4C_SIMD_WASM || defined MD4C_SIMD_SSSE3 || defined MD4C_SIMD_NEON
+    #define MD4C_SIMD
+#endif
+
+/* Direct HTML output of inline content (see MD_HTML_OUTPUT). Not available
+ * with UTF-16 as the output buffer is of MD_CHAR. */
+#ifndef MD4C_USE_UTF16
+    #include "html_escape.h"
+    #define MD4C_HTML_OUTPUT
+#endif
+
+/* Concurrent rendering of document parts in md_parse_parallel(). Without
+ * this, the parts are rendered one after another. */
+#ifdef MD4C_USE_THREADS
+    #include <pthread.h>
+#endif
+
+/* Collection of MD_PARSER::stats. Without this, the parser never looks at it. */
+#ifdef MD4C_STATS
+    #include <time.h>
+#endif
+
 
 /*****************************
  ***  Miscellaneous Stuff  ***
@@ -89,14 +127,17 @@
 #define OFF     MD_OFFSET
 
 typedef struct MD_MARK_tag MD_MARK;
+typedef struct MD_MARKLINK_tag MD_MARKLINK;
 typedef struct MD_BLOCK_tag MD_BLOCK;
 typedef struct MD_CONTAINER_tag MD_CONTAINER;
 typedef struct MD_REF_DEF_tag MD_REF_DEF;
+typedef struct MD_REF_DEF_SLOT_tag MD_REF_DEF_SLOT;
+typedef struct MD_ARENA_CHUNK_tag MD_ARENA_CHUNK;
 
 
 /* During analyzes of inline marks, we need to manage some "mark chains",
  * of (yet unresolved) openers. This structure holds start/end of the chain.
- * The chain internals are then realized through MD_MARK::prev and ::next.
+ * The chain internals are then realized through MD_MARKLINK::prev and ::next.
  */
 typedef struct MD_MARKCHAIN_tag MD_MARKCHAIN;
 struct MD_MARKCHAIN_tag {
@@ -112,6 +153,9 @@ struct MD_CTX_tag {
     SZ size;
     MD_PARSER parser;
     void* userdata;
+#ifdef MD4C_HTML_OUTPUT
+    MD_HTML_OUTPUT* html;   /* From MD_PARSER::html_output, or NULL. */
+#endif
 
     /* When this is true, it allows some optimizations. */
     int doc_ends_with_newline;
@@ -120,18 +164,25 @@ struct MD_CTX_tag {
     CHAR* buffer;
     unsigned alloc_buffer;
 
+    /* Arena for all smaller allocations whose lifetime ends (at the latest)
+     * with md_parse(). See md_arena_alloc(). */
+    MD_ARENA_CHUNK* arena_first;
+    MD_ARENA_CHUNK* arena_cur;
+
     /* Reference definitions. */
     MD_REF_DEF* ref_defs;
     int n_ref_defs;
     int alloc_ref_defs;
-    void** ref_def_hashtable;
-    int ref_def_hashtable_size;
+    MD_REF_DEF_SLOT* ref_def_hashtable;
+    int ref_def_hashtable_size;     /* Power of 2, or 0 if no ref. defs. */
 
     /* Stack of inline/span markers.
      * This is only used for parsing a single block contents but by storing it
      * here we may reuse the stack for subsequent blocks; i.e. we have fewer
-     * (re)allocations. */
+     * (re)allocations. The chain links of the marks are kept apart from
+     * them, in mark_links[], which is indexed the same way (see MD_MARKLINK). */
     MD_MARK* marks;
+    MD_MARKLINK* mark_links;
     int n_marks;
     int alloc_marks;
 
@@ -140,24 +191,33 @@ struct MD_CTX_tag {
 #else
     char mark_char_map[256];
 #endif
+#ifdef MD4C_SIMD
+    /* mark_char_map[] in the form of a nibble lookup table for the vectorized
+     * scanner: For an ASCII byte, bit (ch >> 4) in mark_char_nibbles[ch & 0xf]
+     * is set if the byte is a mark char. */
+    unsigned char mark_char_nibbles[16];
+#endif
+    /* Parser flags the mark_char_map[] has been built for. With a reusable
+     * context (MD_PARSER_CTX), the map is only rebuilt when these change. */
+    unsigned mark_char_map_flags;
+    int mark_char_map_valid;
 
     /* For resolving of inline spans. */
-    MD_MARKCHAIN mark_chains[13];
-#define PTR_CHAIN                               (ctx->mark_chains[0])
-#define TABLECELLBOUNDARIES                     (ctx->mark_chains[1])
-#define ASTERISK_OPENERS_extraword_mod3_0       (ctx->mark_chains[2])
-#define ASTERISK_OPENERS_extraword_mod3_1       (ctx->mark_chains[3])
-#define ASTERISK_OPENERS_extraword_mod3_2       (ctx->mark_chains[4])
-#define ASTERISK_OPENERS_intraword_mod3_0       (ctx->mark_chains[5])
-#define ASTERISK_OPENERS_intraword_mod3_1       (ctx->mark_chains[6])
-#define ASTERISK_OPENERS_intraword_mod3_2       (ctx->mark_chains[7])
-#define UNDERSCORE_OPENERS                      (ctx->mark_chains[8])
-#define TILDE_OPENERS_1                         (ctx->mark_chains[9])
-#define TILDE_OPENERS_2                         (ctx->mark_chains[10])
-#define BRACKET_OPENERS                         (ctx->mark_chains[11])
-#define DOLLAR_OPENERS                          (ctx->mark_chains[12])
-#define OPENERS_CHAIN_FIRST                     2
-#define OPENERS_CHAIN_LAST                      12
+    MD_MARKCHAIN mark_chains[12];
+#define TABLECELLBOUNDARIES                     (ctx->mark_chains[0])
+#define ASTERISK_OPENERS_extraword_mod3_0       (ctx->mark_chains[1])
+#define ASTERISK_OPENERS_extraword_mod3_1       (ctx->mark_chains[2])
+#define ASTERISK_OPENERS_extraword_mod3_2       (ctx->mark_chains[3])
+#define ASTERISK_OPENERS_intraword_mod3_0       (ctx->mark_chains[4])
+#define ASTERISK_OPENERS_intraword_mod3_1       (ctx->mark_chains[5])
+#define ASTERISK_OPENERS_intraword_mod3_2       (ctx->mark_chains[6])
+#define UNDERSCORE_OPENERS                      (ctx->mark_chains[7])
+#define TILDE_OPENERS_1                         (ctx->mark_chains[8])
+#define TILDE_OPENERS_2                         (ctx->mark_chains[9])
+#define BRACKET_OPENERS                         (ctx->mark_chains[10])
+#define DOLLAR_OPENERS                          (ctx->mark_chains[11])
+#define OPENERS_CHAIN_FIRST                     1
+#define OPENERS_CHAIN_LAST                      11
 
     int n_table_cell_boundaries;
 
@@ -196,6 +256,10 @@ struct MD_CTX_tag {
     int html_block_type;    /* For checking closing raw HTML condition. */
     int last_line_has_list_loosening_effect;
     int last_list_item_starts_with_two_blank_lines;
+    int li_opener_end;      /* ctx->n_block_bytes right after the last MD_BLOCK_LI opener. */
+
+    /* Start of the physical line being analyzed (for MD_PARSER::top_block). */
+    OFF line_beg;
 };
 
 enum MD_LINETYPE_tag {
@@ -275,6 +339,144 @@ struct MD_VERBATIMLINE_tag {
  ***  Helpers  ***
  *****************/
 
+/* Arena allocator.
+ *
+ * Memory is handed out from a list of chunks by bumping a pointer; individual
+ * allocations are never freed. Instead, md_arena_mark() and md_arena_release()
+ * allow to discard everything allocated since the mark at once (used for data
+ * which live only as long as a single block is processed), and all of the
+ * arena is recycled by md_arena_reset() before each parse.
+ *
+ * Invariant: Chunks after ctx->arena_cur do not hold any live data.
+ */
+struct MD_ARENA_CHUNK_tag {
+    MD_ARENA_CHUNK* next;
+    size_t size;            /* Capacity of the chunk (excluding the header). */
+    size_t used;
+};
+
+typedef struct MD_ARENA_MARK_tag MD_ARENA_MARK;
+struct MD_ARENA_MARK_tag {
+    MD_ARENA_CHUNK* chunk;
+    size_t used;
+};
+
+#define MD_ARENA_ALIGN          8
+#define MD_ARENA_ROUND(size)    (((size) + MD_ARENA_ALIGN - 1) & ~((size_t) MD_ARENA_ALIGN - 1))
+#define MD_ARENA_CHUNK_SIZE     (8 * 1024)
+#define MD_ARENA_CHUNK_DATA(chunk)  ((char*)(chunk) + MD_ARENA_ROUND(sizeof(MD_ARENA_CHUNK)))
+
+static void*
+md_arena_alloc(MD_CTX* ctx, size_t size)
+{
+    MD_ARENA_CHUNK* chunk = ctx->arena_cur;
+    void* ptr;
+
+    size = MD_ARENA_ROUND(size);
+    while(chunk == NULL  ||  chunk->size - chunk->used < size) {
+        MD_ARENA_CHUNK* new_chunk;
+        size_t chunk_size;
+
+        if(chunk != NULL  &&  chunk->next != NULL) {
+            /* Recycle a chunk retained from previous use. */
+            chunk = chunk->next;
+            chunk->used = 0;
+            continue;
+        }
+
+        chunk_size = (chunk != NULL ? chunk->size * 2 : MD_ARENA_CHUNK_SIZE);
+        if(chunk_size < size)
+            chunk_size = size;
+        new_chunk = (MD_ARENA_CHUNK*) malloc(MD_ARENA_ROUND(sizeof(MD_ARENA_CHUNK)) + chunk_size);
+        if(new_chunk == NULL) {
+            MD_LOG("malloc() failed.");
+            return NULL;
+        }
+        new_chunk->next = NULL;
+        new_chunk->size = chunk_size;
+        new_chunk->used = 0;
+
+        if(chunk != NULL)
+            chunk->next = new_chunk;
+        else
+            ctx->arena_first = new_chunk;
+        chunk = new_chunk;
+    }
+
+    ctx->arena_cur = chunk;
+    ptr = MD_ARENA_CHUNK_DATA(chunk) + chunk->used;
+    chunk->used += size;
+    return ptr;
+}
+
+/* Like realloc() but old_size must be provided by the caller. If 'ptr' is
+ * the most recent allocation, it is grown in place when possible. */
+static void*
+md_arena_realloc(MD_CTX* ctx, void* ptr, size_t old_size, size_t new_size)
+{
+    MD_ARENA_CHUNK* chunk = ctx->arena_cur;
+    void* new_ptr;
+
+    if(ptr != NULL  &&  chunk != NULL  &&
+       (char*) ptr + MD_ARENA_ROUND(old_size) == MD_ARENA_CHUNK_DATA(chunk) + chunk->used  &&
+       chunk->size - chunk->used >= MD_ARENA_ROUND(new_size) - MD_ARENA_ROUND(old_size))
+    {
+        chunk->used += MD_ARENA_ROUND(new_size) - MD_ARENA_ROUND(old_size);
+        return ptr;
+    }
+
+    new_ptr = md_arena_alloc(ctx, new_size);
+    if(new_ptr != NULL  &&  ptr != NULL)
+        memcpy(new_ptr, ptr, (old_size < new_size ? old_size : new_size));
+    return new_ptr;
+}
+
+static inline MD_ARENA_MARK
+md_arena_mark(MD_CTX* ctx)
+{
+    MD_ARENA_MARK mark;
+
+    mark.chunk = ctx->arena_cur;
+    mark.used = (mark.chunk != NULL ? mark.chunk->used : 0);
+    return mark;
+}
+
+static inline void
+md_arena_release(MD_CTX* ctx, MD_ARENA_MARK mark)
+{
+    if(mark.chunk != NULL) {
+        ctx->arena_cur = mark.chunk;
+        mark.chunk->used = mark.used;
+    } else if(ctx->arena_first != NULL) {
+        ctx->arena_cur = ctx->arena_first;
+        ctx->arena_cur->used = 0;
+    }
+}
+
+/* Discard all data in the arena but keep its memory for reuse. */
+static void
+md_arena_reset(MD_CTX* ctx)
+{
+    MD_ARENA_MARK mark = { NULL, 0 };
+    md_arena_release(ctx, mark);
+}
+
+static void
+md_arena_free(MD_CTX* ctx)
+{
+    MD_ARENA_CHUNK* chunk = ctx->arena_first;
+
+    while(chunk != NULL) {
+        MD_ARENA_CHUNK* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+
+    ctx->arena_first = NULL;
+    ctx->arena_cur = NULL;
+}
+
+
 /* Character accessors. */
 #define CH(off)                 (ctx->text[(off)])
 #define STR(off)                (ctx->text + (off))
@@ -405,6 +607,43 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
     } while(0)
 
 
+#ifdef MD4C_STATS
+    static unsigned long long
+    md_stats_now(void)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (unsigned long long) ts.tv_sec * 1000000000ULL + (unsigned long long) ts.tv_nsec;
+    }
+
+    /* Adds the time between MD_STATS_TIME_BEGIN() and MD_STATS_TIME_END() to
+     * MD_STATS::field. The variable is declared with MD_STATS_TIMER(). */
+    #define MD_STATS_TIMER(t0)          unsigned long long t0 = 0
+    #define MD_STATS_TIME_BEGIN(t0)                                         \
+        do {                                                                \
+            if(ctx->parser.stats != NULL)                                   \
+                t0 = md_stats_now();                                        \
+        } while(0)
+    #define MD_STATS_TIME_END(t0, field)                                    \
+        do {                                                                \
+            if(ctx->parser.stats != NULL)                                   \
+                ctx->parser.stats->field += md_stats_now() - (t0);          \
+        } while(0)
+
+    /* Adds n to the counter MD_STATS::field. */
+    #define MD_STATS_COUNT(field, n)                                        \
+        do {                                                                \
+            if(ctx->parser.stats != NULL)                                   \
+                ctx->parser.stats->field += (n);                            \
+        } while(0)
+#else
+    #define MD_STATS_TIMER(t0)
+    #define MD_STATS_TIME_BEGIN(t0)         do {} while(0)
+    #define MD_STATS_TIME_END(t0, field)    do {} while(0)
+    #define MD_STATS_COUNT(field, n)        do {} while(0)
+#endif
+
+
 #define MD_ENTER_BLOCK(type, arg)                                           \
     do {                                                                    \
         ret = ctx->parser.enter_block((type), (arg), ctx->userdata);        \
@@ -464,6 +703,91 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
     } while(0)
 
 
+#ifdef MD4C_HTML_OUTPUT
+
+static void
+md_html_append(MD_HTML_OUTPUT* out, const CHAR* str, SZ size)
+{
+    MD_HTML_BUFFER* buf = out->buf;
+
+    if((size_t)(buf->end - buf->ptr) < size)
+        out->reserve(buf, size);
+    memcpy(buf->ptr, str, size);
+    buf->ptr += size;
+}
+
+static void
+md_html_append_escaped(MD_HTML_OUTPUT* out, const CHAR* str, SZ size)
+{
+    MD_HTML_BUFFER* buf = out->buf;
+
+    /* Only scan for the exact size if the worst case does not fit. */
+    if((size_t)(buf->end - buf->ptr) < (size_t) size * 6)
+        out->reserve(buf, (SZ) html_escaped_len(str, size));
+    buf->ptr = html_escape(buf->ptr, str, size);
+}
+
+/* Writes the text as HTML and returns TRUE, or returns FALSE if the text type
+ * has to be reported through the text() callback. */
+static inline int
+md_html_text(MD_HTML_OUTPUT* out, MD_TEXTTYPE type, const CHAR* str, SZ size)
+{
+    switch(type) {
+        case MD_TEXT_NORMAL:
+        case MD_TEXT_CODE:
+        case MD_TEXT_LATEXMATH:
+            md_html_append_escaped(out, str, size);
+            return TRUE;
+
+        case MD_TEXT_ENTITY:
+        case MD_TEXT_HTML:
+            md_html_append(out, str, size);
+            return TRUE;
+
+        case MD_TEXT_SOFTBR:
+            md_html_append(out, _T("\n"), 1);
+            return TRUE;
+
+        default:
+            return FALSE;
+    }
+}
+
+#define MD_HTML_DIRECT()    (ctx->html != NULL  &&  ctx->html->enabled)
+
+/* Variants of MD_ENTER_SPAN(), MD_LEAVE_SPAN() and MD_TEXT() for
+ * md_process_inlines() which write the HTML directly when possible. */
+#define MD_INLINE_ENTER_SPAN(type, tag)                                     \
+    do {                                                                    \
+        if(MD_HTML_DIRECT())                                                \
+            md_html_append(ctx->html, _T("<" tag ">"), sizeof(tag) + 1);    \
+        else                                                                \
+            MD_ENTER_SPAN((type), NULL);                                    \
+    } while(0)
+
+#define MD_INLINE_LEAVE_SPAN(type, tag)                                     \
+    do {                                                                    \
+        if(MD_HTML_DIRECT())                                                \
+            md_html_append(ctx->html, _T("</" tag ">"), sizeof(tag) + 2);   \
+        else                                                                \
+            MD_LEAVE_SPAN((type), NULL);                                    \
+    } while(0)
+
+#define MD_INLINE_TEXT(type, str, size)                                     \
+    do {                                                                    \
+        if(!MD_HTML_DIRECT()  ||  !md_html_text(ctx->html, (type), (str), (size))) \
+            MD_TEXT((type), (str), (size));                                 \
+    } while(0)
+
+#else
+
+#define MD_INLINE_ENTER_SPAN(type, tag)     MD_ENTER_SPAN((type), NULL)
+#define MD_INLINE_LEAVE_SPAN(type, tag)     MD_LEAVE_SPAN((type), NULL)
+#define MD_INLINE_TEXT(type, str, size)     MD_TEXT((type), (str), (size))
+
+#endif  /* MD4C_HTML_OUTPUT */
+
+
 
 /*************************
  ***  Unicode Support  ***
@@ -477,213 +801,42 @@ struct MD_UNICODE_FOLD_INFO_tag {
 
 
 #if defined MD4C_USE_UTF16 || defined MD4C_USE_UTF8
-    /* Binary search over sorted "map" of codepoints. Consecutive sequences
-     * of codepoints may be encoded in the map by just using the
-     * (MIN_CODEPOINT | 0x40000000) and (MAX_CODEPOINT | 0x80000000).
-     *
-     * Returns index of the found record in the map (in the case of ranges,
-     * the minimal value is used); or -1 on failure. */
-    static int
-    md_unicode_bsearch__(unsigned codepoint, const unsigned* map, size_t map_size)
-    {
-        int beg, end;
-        int pivot_beg, pivot_end;
-
-        beg = 0;
-        end = (int) map_size-1;
-        while(beg <= end) {
-            /* Pivot may be a range, not just a single value. */
-            pivot_beg = pivot_end = (beg + end) / 2;
-            if(map[pivot_end] & 0x40000000)
-                pivot_end++;
-            if(map[pivot_beg] & 0x80000000)
-                pivot_beg--;
-
-            if(codepoint < (map[pivot_beg] & 0x00ffffff))
-                end = pivot_beg - 1;
-            else if(codepoint > (map[pivot_end] & 0x00ffffff))
-                beg = pivot_end + 1;
-            else
-                return pivot_beg;
-        }
+    /* The tables map each codepoint in two steps, through the page (i.e. the
+     * block of 256 codepoints) it is in, so a lookup is just two loads.
+     * (generated by misc/gen_unicode_tables.py) */
+    #include "md4c_unicode.h"
 
-        return -1;
-    }
+    #define MD_UNICODE_BIT__(map, codepoint)                                    \
+        ((codepoint) >> 8 < MD_##map##_N_PAGES  &&                              \
+         ((MD_##map##_BITS[MD_##map##_PAGES[(codepoint) >> 8]][((codepoint) >> 5) & 7] \
+           >> ((codepoint) & 31)) & 1))
 
     static int
     md_is_unicode_whitespace__(unsigned codepoint)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
-        /* Unicode "Zs" category.
-         * (generated by scripts/build_whitespace_map.py) */
-        static const unsigned WHITESPACE_MAP[] = {
-            S(0x0020), S(0x00a0), S(0x1680), R(0x2000,0x200a), S(0x202f), S(0x205f), S(0x3000)
-        };
-#undef R
-#undef S
-
         /* The ASCII ones are the most frequently used ones, also CommonMark
          * specification requests few more in this range. */
         if(codepoint <= 0x7f)
             return ISWHITESPACE_(codepoint);
 
-        return (md_unicode_bsearch__(codepoint, WHITESPACE_MAP, SIZEOF_ARRAY(WHITESPACE_MAP)) >= 0);
+        return MD_UNICODE_BIT__(WHITESPACE, codepoint);
     }
 
     static int
     md_is_unicode_punct__(unsigned codepoint)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
-        /* Unicode "Pc", "Pd", "Pe", "Pf", "Pi", "Po", "Ps" categories.
-         * (generated by scripts/build_punct_map.py) */
-        static const unsigned PUNCT_MAP[] = {
-            R(0x0021,0x0023), R(0x0025,0x002a), R(0x002c,0x002f), R(0x003a,0x003b), R(0x003f,0x0040),
-            R(0x005b,0x005d), S(0x005f), S(0x007b), S(0x007d), S(0x00a1), S(0x00a7), S(0x00ab), R(0x00b6,0x00b7),
-            S(0x00bb), S(0x00bf), S(0x037e), S(0x0387), R(0x055a,0x055f), R(0x0589,0x058a), S(0x05be), S(0x05c0),
-            S(0x05c3), S(0x05c6), R(0x05f3,0x05f4), R(0x0609,0x060a), R(0x060c,0x060d), S(0x061b), R(0x061e,0x061f),
-            R(0x066a,0x066d), S(0x06d4), R(0x0700,0x070d), R(0x07f7,0x07f9), R(0x0830,0x083e), S(0x085e),
-            R(0x0964,0x0965), S(0x0970), S(0x09fd), S(0x0a76), S(0x0af0), S(0x0c77), S(0x0c84), S(0x0df4), S(0x0e4f),
-            R(0x0e5a,0x0e5b), R(0x0f04,0x0f12), S(0x0f14), R(0x0f3a,0x0f3d), S(0x0f85), R(0x0fd0,0x0fd4),
-            R(0x0fd9,0x0fda), R(0x104a,0x104f), S(0x10fb), R(0x1360,0x1368), S(0x1400), S(0x166e), R(0x169b,0x169c),
-            R(0x16eb,0x16ed), R(0x1735,0x1736), R(0x17d4,0x17d6), R(0x17d8,0x17da), R(0x1800,0x180a),
-            R(0x1944,0x1945), R(0x1a1e,0x1a1f), R(0x1aa0,0x1aa6), R(0x1aa8,0x1aad), R(0x1b5a,0x1b60),
-            R(0x1bfc,0x1bff), R(0x1c3b,0x1c3f), R(0x1c7e,0x1c7f), R(0x1cc0,0x1cc7), S(0x1cd3), R(0x2010,0x2027),
-            R(0x2030,0x2043), R(0x2045,0x2051), R(0x2053,0x205e), R(0x207d,0x207e), R(0x208d,0x208e),
-            R(0x2308,0x230b), R(0x2329,0x232a), R(0x2768,0x2775), R(0x27c5,0x27c6), R(0x27e6,0x27ef),
-            R(0x2983,0x2998), R(0x29d8,0x29db), R(0x29fc,0x29fd), R(0x2cf9,0x2cfc), R(0x2cfe,0x2cff), S(0x2d70),
-            R(0x2e00,0x2e2e), R(0x2e30,0x2e4f), S(0x2e52), R(0x3001,0x3003), R(0x3008,0x3011), R(0x3014,0x301f),
-            S(0x3030), S(0x303d), S(0x30a0), S(0x30fb), R(0xa4fe,0xa4ff), R(0xa60d,0xa60f), S(0xa673), S(0xa67e),
-            R(0xa6f2,0xa6f7), R(0xa874,0xa877), R(0xa8ce,0xa8cf), R(0xa8f8,0xa8fa), S(0xa8fc), R(0xa92e,0xa92f),
-            S(0xa95f), R(0xa9c1,0xa9cd), R(0xa9de,0xa9df), R(0xaa5c,0xaa5f), R(0xaade,0xaadf), R(0xaaf0,0xaaf1),
-            S(0xabeb), R(0xfd3e,0xfd3f), R(0xfe10,0xfe19), R(0xfe30,0xfe52), R(0xfe54,0xfe61), S(0xfe63), S(0xfe68),
-            R(0xfe6a,0xfe6b), R(0xff01,0xff03), R(0xff05,0xff0a), R(0xff0c,0xff0f), R(0xff1a,0xff1b),
-            R(0xff1f,0xff20), R(0xff3b,0xff3d), S(0xff3f), S(0xff5b), S(0xff5d), R(0xff5f,0xff65), R(0x10100,0x10102),
-            S(0x1039f), S(0x103d0), S(0x1056f), S(0x10857), S(0x1091f), S(0x1093f), R(0x10a50,0x10a58), S(0x10a7f),
-            R(0x10af0,0x10af6), R(0x10b39,0x10b3f), R(0x10b99,0x10b9c), S(0x10ead), R(0x10f55,0x10f59),
-            R(0x11047,0x1104d), R(0x110bb,0x110bc), R(0x110be,0x110c1), R(0x11140,0x11143), R(0x11174,0x11175),
-            R(0x111c5,0x111c8), S(0x111cd), S(0x111db), R(0x111dd,0x111df), R(0x11238,0x1123d), S(0x112a9),
-            R(0x1144b,0x1144f), R(0x1145a,0x1145b), S(0x1145d), S(0x114c6), R(0x115c1,0x115d7), R(0x11641,0x11643),
-            R(0x11660,0x1166c), R(0x1173c,0x1173e), S(0x1183b), R(0x11944,0x11946), S(0x119e2), R(0x11a3f,0x11a46),
-            R(0x11a9a,0x11a9c), R(0x11a9e,0x11aa2), R(0x11c41,0x11c45), R(0x11c70,0x11c71), R(0x11ef7,0x11ef8),
-            S(0x11fff), R(0x12470,0x12474), R(0x16a6e,0x16a6f), S(0x16af5), R(0x16b37,0x16b3b), S(0x16b44),
-            R(0x16e97,0x16e9a), S(0x16fe2), S(0x1bc9f), R(0x1da87,0x1da8b), R(0x1e95e,0x1e95f)
-        };
-#undef R
-#undef S
-
         /* The ASCII ones are the most frequently used ones, also CommonMark
          * specification requests few more in this range. */
         if(codepoint <= 0x7f)
             return ISPUNCT_(codepoint);
 
-        return (md_unicode_bsearch__(codepoint, PUNCT_MAP, SIZEOF_ARRAY(PUNCT_MAP)) >= 0);
+        return MD_UNICODE_BIT__(PUNCT, codepoint);
     }
 
     static void
     md_get_unicode_fold_info(unsigned codepoint, MD_UNICODE_FOLD_INFO* info)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
-        /* Unicode "Pc", "Pd", "Pe", "Pf", "Pi", "Po", "Ps" categories.
-         * (generated by scripts/build_punct_map.py) */
-        static const unsigned FOLD_MAP_1[] = {
-            R(0x0041,0x005a), S(0x00b5), R(0x00c0,0x00d6), R(0x00d8,0x00de), R(0x0100,0x012e), R(0x0132,0x0136),
-            R(0x0139,0x0147), R(0x014a,0x0176), S(0x0178), R(0x0179,0x017d), S(0x017f), S(0x0181), S(0x0182),
-            S(0x0184), S(0x0186), S(0x0187), S(0x0189), S(0x018a), S(0x018b), S(0x018e), S(0x018f), S(0x0190),
-            S(0x0191), S(0x0193), S(0x0194), S(0x0196), S(0x0197), S(0x0198), S(0x019c), S(0x019d), S(0x019f),
-            R(0x01a0,0x01a4), S(0x01a6), S(0x01a7), S(0x01a9), S(0x01ac), S(0x01ae), S(0x01af), S(0x01b1), S(0x01b2),
-            S(0x01b3), S(0x01b5), S(0x01b7), S(0x01b8), S(0x01bc), S(0x01c4), S(0x01c5), S(0x01c7), S(0x01c8),
-            S(0x01ca), R(0x01cb,0x01db), R(0x01de,0x01ee), S(0x01f1), S(0x01f2), S(0x01f4), S(0x01f6), S(0x01f7),
-            R(0x01f8,0x021e), S(0x0220), R(0x0222,0x0232), S(0x023a), S(0x023b), S(0x023d), S(0x023e), S(0x0241),
-            S(0x0243), S(0x0244), S(0x0245), R(0x0246,0x024e), S(0x0345), S(0x0370), S(0x0372), S(0x0376), S(0x037f),
-            S(0x0386), R(0x0388,0x038a), S(0x038c), S(0x038e), S(0x038f), R(0x0391,0x03a1), R(0x03a3,0x03ab),
-            S(0x03c2), S(0x03cf), S(0x03d0), S(0x03d1), S(0x03d5), S(0x03d6), R(0x03d8,0x03ee), S(0x03f0), S(0x03f1),
-            S(0x03f4), S(0x03f5), S(0x03f7), S(0x03f9), S(0x03fa), R(0x03fd,0x03ff), R(0x0400,0x040f),
-            R(0x0410,0x042f), R(0x0460,0x0480), R(0x048a,0x04be), S(0x04c0), R(0x04c1,0x04cd), R(0x04d0,0x052e),
-            R(0x0531,0x0556), R(0x10a0,0x10c5), S(0x10c7), S(0x10cd), R(0x13f8,0x13fd), S(0x1c80), S(0x1c81),
-            S(0x1c82), S(0x1c83), S(0x1c84), S(0x1c85), S(0x1c86), S(0x1c87), S(0x1c88), R(0x1c90,0x1cba),
-            R(0x1cbd,0x1cbf), R(0x1e00,0x1e94), S(0x1e9b), R(0x1ea0,0x1efe), R(0x1f08,0x1f0f), R(0x1f18,0x1f1d),
-            R(0x1f28,0x1f2f), R(0x1f38,0x1f3f), R(0x1f48,0x1f4d), S(0x1f59), S(0x1f5b), S(0x1f5d), S(0x1f5f),
-            R(0x1f68,0x1f6f), S(0x1fb8), S(0x1fb9), S(0x1fba), S(0x1fbb), S(0x1fbe), R(0x1fc8,0x1fcb), S(0x1fd8),
-            S(0x1fd9), S(0x1fda), S(0x1fdb), S(0x1fe8), S(0x1fe9), S(0x1fea), S(0x1feb), S(0x1fec), S(0x1ff8),
-            S(0x1ff9), S(0x1ffa), S(0x1ffb), S(0x2126), S(0x212a), S(0x212b), S(0x2132), R(0x2160,0x216f), S(0x2183),
-            R(0x24b6,0x24cf), R(0x2c00,0x2c2e), S(0x2c60), S(0x2c62), S(0x2c63), S(0x2c64), R(0x2c67,0x2c6b),
-            S(0x2c6d), S(0x2c6e), S(0x2c6f), S(0x2c70), S(0x2c72), S(0x2c75), S(0x2c7e), S(0x2c7f), R(0x2c80,0x2ce2),
-            S(0x2ceb), S(0x2ced), S(0x2cf2), R(0xa640,0xa66c), R(0xa680,0xa69a), R(0xa722,0xa72e), R(0xa732,0xa76e),
-            S(0xa779), S(0xa77b), S(0xa77d), R(0xa77e,0xa786), S(0xa78b), S(0xa78d), S(0xa790), S(0xa792),
-            R(0xa796,0xa7a8), S(0xa7aa), S(0xa7ab), S(0xa7ac), S(0xa7ad), S(0xa7ae), S(0xa7b0), S(0xa7b1), S(0xa7b2),
-            S(0xa7b3), R(0xa7b4,0xa7be), S(0xa7c2), S(0xa7c4), S(0xa7c5), S(0xa7c6), S(0xa7c7), S(0xa7c9), S(0xa7f5),
-            R(0xab70,0xabbf), R(0xff21,0xff3a), R(0x10400,0x10427), R(0x104b0,0x104d3), R(0x10c80,0x10cb2),
-            R(0x118a0,0x118bf), R(0x16e40,0x16e5f), R(0x1e900,0x1e921)
-        };
-        static const unsigned FOLD_MAP_1_DATA[] = {
-            0x0061, 0x007a, 0x03bc, 0x00e0, 0x00f6, 0x00f8, 0x00fe, 0x0101, 0x012f, 0x0133, 0x0137, 0x013a, 0x0148,
-            0x014b, 0x0177, 0x00ff, 0x017a, 0x017e, 0x0073, 0x0253, 0x0183, 0x0185, 0x0254, 0x0188, 0x0256, 0x0257,
-            0x018c, 0x01dd, 0x0259, 0x025b, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026f, 0x0272, 0x0275,
-            0x01a1, 0x01a5, 0x0280, 0x01a8, 0x0283, 0x01ad, 0x0288, 0x01b0, 0x028a, 0x028b, 0x01b4, 0x01b6, 0x0292,
-            0x01b9, 0x01bd, 0x01c6, 0x01c6, 0x01c9, 0x01c9, 0x01cc, 0x01cc, 0x01dc, 0x01df, 0x01ef, 0x01f3, 0x01f3,
-            0x01f5, 0x0195, 0x01bf, 0x01f9, 0x021f, 0x019e, 0x0223, 0x0233, 0x2c65, 0x023c, 0x019a, 0x2c66, 0x0242,
-            0x0180, 0x0289, 0x028c, 0x0247, 0x024f, 0x03b9, 0x0371, 0x0373, 0x0377, 0x03f3, 0x03ac, 0x03ad, 0x03af,
-            0x03cc, 0x03cd, 0x03ce, 0x03b1, 0x03c1, 0x03c3, 0x03cb, 0x03c3, 0x03d7, 0x03b2, 0x03b8, 0x03c6, 0x03c0,
-            0x03d9, 0x03ef, 0x03ba, 0x03c1, 0x03b8, 0x03b5, 0x03f8, 0x03f2, 0x03fb, 0x037b, 0x037d, 0x0450, 0x045f,
-            0x0430, 0x044f, 0x0461, 0x0481, 0x048b, 0x04bf, 0x04cf, 0x04c2, 0x04ce, 0x04d1, 0x052f, 0x0561, 0x0586,
-            0x2d00, 0x2d25, 0x2d27, 0x2d2d, 0x13f0, 0x13f5, 0x0432, 0x0434, 0x043e, 0x0441, 0x0442, 0x0442, 0x044a,
-            0x0463, 0xa64b, 0x10d0, 0x10fa, 0x10fd, 0x10ff, 0x1e01, 0x1e95, 0x1e61, 0x1ea1, 0x1eff, 0x1f00, 0x1f07,
-            0x1f10, 0x1f15, 0x1f20, 0x1f27, 0x1f30, 0x1f37, 0x1f40, 0x1f45, 0x1f51, 0x1f53, 0x1f55, 0x1f57, 0x1f60,
-            0x1f67, 0x1fb0, 0x1fb1, 0x1f70, 0x1f71, 0x03b9, 0x1f72, 0x1f75, 0x1fd0, 0x1fd1, 0x1f76, 0x1f77, 0x1fe0,
-            0x1fe1, 0x1f7a, 0x1f7b, 0x1fe5, 0x1f78, 0x1f79, 0x1f7c, 0x1f7d, 0x03c9, 0x006b, 0x00e5, 0x214e, 0x2170,
-            0x217f, 0x2184, 0x24d0, 0x24e9, 0x2c30, 0x2c5e, 0x2c61, 0x026b, 0x1d7d, 0x027d, 0x2c68, 0x2c6c, 0x0251,
-            0x0271, 0x0250, 0x0252, 0x2c73, 0x2c76, 0x023f, 0x0240, 0x2c81, 0x2ce3, 0x2cec, 0x2cee, 0x2cf3, 0xa641,
-            0xa66d, 0xa681, 0xa69b, 0xa723, 0xa72f, 0xa733, 0xa76f, 0xa77a, 0xa77c, 0x1d79, 0xa77f, 0xa787, 0xa78c,
-            0x0265, 0xa791, 0xa793, 0xa797, 0xa7a9, 0x0266, 0x025c, 0x0261, 0x026c, 0x026a, 0x029e, 0x0287, 0x029d,
-            0xab53, 0xa7b5, 0xa7bf, 0xa7c3, 0xa794, 0x0282, 0x1d8e, 0xa7c8, 0xa7ca, 0xa7f6, 0x13a0, 0x13ef, 0xff41,
-            0xff5a, 0x10428, 0x1044f, 0x104d8, 0x104fb, 0x10cc0, 0x10cf2, 0x118c0, 0x118df, 0x16e60, 0x16e7f, 0x1e922,
-            0x1e943
-        };
-        static const unsigned FOLD_MAP_2[] = {
-            S(0x00df), S(0x0130), S(0x0149), S(0x01f0), S(0x0587), S(0x1e96), S(0x1e97), S(0x1e98), S(0x1e99),
-            S(0x1e9a), S(0x1e9e), S(0x1f50), R(0x1f80,0x1f87), R(0x1f88,0x1f8f), R(0x1f90,0x1f97), R(0x1f98,0x1f9f),
-            R(0x1fa0,0x1fa7), R(0x1fa8,0x1faf), S(0x1fb2), S(0x1fb3), S(0x1fb4), S(0x1fb6), S(0x1fbc), S(0x1fc2),
-            S(0x1fc3), S(0x1fc4), S(0x1fc6), S(0x1fcc), S(0x1fd6), S(0x1fe4), S(0x1fe6), S(0x1ff2), S(0x1ff3),
-            S(0x1ff4), S(0x1ff6), S(0x1ffc), S(0xfb00), S(0xfb01), S(0xfb02), S(0xfb05), S(0xfb06), S(0xfb13),
-            S(0xfb14), S(0xfb15), S(0xfb16), S(0xfb17)
-        };
-        static const unsigned FOLD_MAP_2_DATA[] = {
-            0x0073,0x0073, 0x0069,0x0307, 0x02bc,0x006e, 0x006a,0x030c, 0x0565,0x0582, 0x0068,0x0331, 0x0074,0x0308,
-            0x0077,0x030a, 0x0079,0x030a, 0x0061,0x02be, 0x0073,0x0073, 0x03c5,0x0313, 0x1f00,0x03b9, 0x1f07,0x03b9,
-            0x1f00,0x03b9, 0x1f07,0x03b9, 0x1f20,0x03b9, 0x1f27,0x03b9, 0x1f20,0x03b9, 0x1f27,0x03b9, 0x1f60,0x03b9,
-            0x1f67,0x03b9, 0x1f60,0x03b9, 0x1f67,0x03b9, 0x1f70,0x03b9, 0x03b1,0x03b9, 0x03ac,0x03b9, 0x03b1,0x0342,
-            0x03b1,0x03b9, 0x1f74,0x03b9, 0x03b7,0x03b9, 0x03ae,0x03b9, 0x03b7,0x0342, 0x03b7,0x03b9, 0x03b9,0x0342,
-            0x03c1,0x0313, 0x03c5,0x0342, 0x1f7c,0x03b9, 0x03c9,0x03b9, 0x03ce,0x03b9, 0x03c9,0x0342, 0x03c9,0x03b9,
-            0x0066,0x0066, 0x0066,0x0069, 0x0066,0x006c, 0x0073,0x0074, 0x0073,0x0074, 0x0574,0x0576, 0x0574,0x0565,
-            0x0574,0x056b, 0x057e,0x0576, 0x0574,0x056d
-        };
-        static const unsigned FOLD_MAP_3[] = {
-            S(0x0390), S(0x03b0), S(0x1f52), S(0x1f54), S(0x1f56), S(0x1fb7), S(0x1fc7), S(0x1fd2), S(0x1fd3),
-            S(0x1fd7), S(0x1fe2), S(0x1fe3), S(0x1fe7), S(0x1ff7), S(0xfb03), S(0xfb04)
-        };
-        static const unsigned FOLD_MAP_3_DATA[] = {
-            0x03b9,0x0308,0x0301, 0x03c5,0x0308,0x0301, 0x03c5,0x0313,0x0300, 0x03c5,0x0313,0x0301,
-            0x03c5,0x0313,0x0342, 0x03b1,0x0342,0x03b9, 0x03b7,0x0342,0x03b9, 0x03b9,0x0308,0x0300,
-            0x03b9,0x0308,0x0301, 0x03b9,0x0308,0x0342, 0x03c5,0x0308,0x0300, 0x03c5,0x0308,0x0301,
-            0x03c5,0x0308,0x0342, 0x03c9,0x0342,0x03b9, 0x0066,0x0066,0x0069, 0x0066,0x0066,0x006c
-        };
-#undef R
-#undef S
-        static const struct {
-            const unsigned* map;
-            const unsigned* data;
-            size_t map_size;
-            unsigned n_codepoints;
-        } FOLD_MAP_LIST[] = {
-            { FOLD_MAP_1, FOLD_MAP_1_DATA, SIZEOF_ARRAY(FOLD_MAP_1), 1 },
-            { FOLD_MAP_2, FOLD_MAP_2_DATA, SIZEOF_ARRAY(FOLD_MAP_2), 2 },
-            { FOLD_MAP_3, FOLD_MAP_3_DATA, SIZEOF_ARRAY(FOLD_MAP_3), 3 }
-        };
-
-        int i;
+        const int* fold_case;
 
         /* Fast path for ASCII characters. */
         if(codepoint <= 0x7f) {
@@ -694,39 +847,31 @@ struct MD_UNICODE_FOLD_INFO_tag {
             return;
         }
 
-        /* Try to locate the codepoint in any of the maps. */
-        for(i = 0; i < (int) SIZEOF_ARRAY(FOLD_MAP_LIST); i++) {
-            unsigned index;
-
-            index = md_unicode_bsearch__(codepoint, FOLD_MAP_LIST[i].map, FOLD_MAP_LIST[i].map_size);
-            if(index >= 0) {
-                /* Found the mapping. */
-                unsigned n_codepoints = FOLD_MAP_LIST[i].n_codepoints;
-                const unsigned* map = FOLD_MAP_LIST[i].map;
-                const unsigned* codepoints = FOLD_MAP_LIST[i].data + (index * n_codepoints);
-
-                memcpy(info->codepoints, codepoints, sizeof(unsigned) * n_codepoints);
-                info->n_codepoints = n_codepoints;
-
-                if(FOLD_MAP_LIST[i].map[index] != codepoint) {
-                    /* The found mapping maps whole range of codepoints,
-                     * i.e. we have to offset info->codepoints[0] accordingly. */
-                    if((map[index] & 0x00ffffff)+1 == codepoints[0]) {
-                        /* Alternating type of the range. */
-                        info->codepoints[0] = codepoint + ((codepoint & 0x1) == (map[index] & 0x1) ? 1 : 0);
-                    } else {
-                        /* Range to range kind of mapping. */
-                        info->codepoints[0] += (codepoint - (map[index] & 0x00ffffff));
-                    }
-                }
-
-                return;
-            }
+        if(codepoint >> 8 >= MD_FOLD_N_PAGES) {
+            fold_case = MD_FOLD_CASES[0];
+        } else {
+            fold_case = MD_FOLD_CASES[MD_FOLD_INDEX[MD_FOLD_PAGES[codepoint >> 8]][codepoint & 0xff]];
         }
 
-        /* No mapping found. Map the codepoint to itself. */
-        info->codepoints[0] = codepoint;
-        info->n_codepoints = 1;
+        switch(fold_case[0]) {
+            case 0:
+                /* No mapping. Map the codepoint to itself. */
+                info->codepoints[0] = codepoint;
+                info->n_codepoints = 1;
+                break;
+
+            case 1:
+                info->codepoints[0] = codepoint + fold_case[1];
+                info->n_codepoints = 1;
+                break;
+
+            default:
+                info->codepoints[0] = fold_case[1];
+                info->codepoints[1] = fold_case[2];
+                info->codepoints[2] = fold_case[3];
+                info->n_codepoints = fold_case[0];
+                break;
+        }
     }
 #endif
 
@@ -925,7 +1070,8 @@ md_merge_lines(MD_CTX* ctx, OFF beg, OFF end, const MD_LINE* lines,
     }
 }
 
-/* Wrapper of md_merge_lines() which allocates new buffer for the output string.
+/* Wrapper of md_merge_lines() which allocates new buffer for the output string
+ * (from the arena).
  */
 static int
 md_merge_lines_alloc(MD_CTX* ctx, OFF beg, OFF end, const MD_LINE* lines,
@@ -933,11 +1079,9 @@ md_merge_lines_alloc(MD_CTX* ctx, OFF beg, OFF end, const MD_LINE* lines,
 {
     CHAR* buffer;
 
-    buffer = (CHAR*) malloc(sizeof(CHAR) * (end - beg));
-    if(buffer == NULL) {
-        MD_LOG("malloc() failed.");
+    buffer = (CHAR*) md_arena_alloc(ctx, sizeof(CHAR) * (end - beg));
+    if(buffer == NULL)
         return -1;
-    }
 
     md_merge_lines(ctx, beg, end, lines,
                 line_break_replacement_char, buffer, p_size);
@@ -1349,24 +1493,22 @@ md_build_attr_append_substr(MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build,
     if(build->substr_count >= build->substr_alloc) {
         MD_TEXTTYPE* new_substr_types;
         OFF* new_substr_offsets;
+        int old_alloc = build->substr_alloc;
 
         build->substr_alloc = (build->substr_alloc > 0
                 ? build->substr_alloc + build->substr_alloc / 2
                 : 8);
-        new_substr_types = (MD_TEXTTYPE*) realloc(build->substr_types,
+        new_substr_types = (MD_TEXTTYPE*) md_arena_realloc(ctx, build->substr_types,
+                                    old_alloc * sizeof(MD_TEXTTYPE),
                                     build->substr_alloc * sizeof(MD_TEXTTYPE));
-        if(new_substr_types == NULL) {
-            MD_LOG("realloc() failed.");
+        if(new_substr_types == NULL)
             return -1;
-        }
         /* Note +1 to reserve space for final offset (== raw_size). */
-        new_substr_offsets = (OFF*) realloc(build->substr_offsets,
+        new_substr_offsets = (OFF*) md_arena_realloc(ctx, build->substr_offsets,
+                                    (old_alloc > 0 ? old_alloc+1 : 0) * sizeof(OFF),
                                     (build->substr_alloc+1) * sizeof(OFF));
-        if(new_substr_offsets == NULL) {
-            MD_LOG("realloc() failed.");
-            free(new_substr_types);
+        if(new_substr_offsets == NULL)
             return -1;
-        }
 
         build->substr_types = new_substr_types;
         build->substr_offsets = new_substr_offsets;
@@ -1378,28 +1520,19 @@ md_build_attr_append_substr(MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build,
     return 0;
 }
 
-static void
-md_free_attribute(MD_UNUSED MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build)
-{
-    if(build->substr_alloc > 0) {
-        free(build->text);
-        free(build->substr_types);
-        free(build->substr_offsets);
-    }
-}
-
 static int
 md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
                    unsigned flags, MD_ATTRIBUTE* attr, MD_ATTRIBUTE_BUILD* build)
 {
     OFF raw_off, off;
     int is_trivial;
+    int is_verbatim;
     int ret = 0;
 
     memset(build, 0, sizeof(MD_ATTRIBUTE_BUILD));
 
     /* If there is no backslash and no ampersand, build trivial attribute
-     * without any malloc(). */
+     * without any allocation. */
     is_trivial = TRUE;
     for(raw_off = 0; raw_off < raw_size; raw_off++) {
         if(ISANYOF3_(raw_text[raw_off], _T('\\'), _T('&'), _T('\0'))) {
@@ -1408,6 +1541,20 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
         }
     }
 
+    /* Only backslash escapes make the text differ from the raw text. Without
+     * them, the text is not copied so that it still points into the document
+     * (which lets the application find its offset) and only the substrings
+     * are built. */
+    is_verbatim = TRUE;
+    if(!is_trivial  &&  !(flags & MD_BUILD_ATTR_NO_ESCAPES)) {
+        for(; raw_off < raw_size; raw_off++) {
+            if(raw_text[raw_off] == _T('\\')) {
+                is_verbatim = FALSE;
+                break;
+            }
+        }
+    }
+
     if(is_trivial) {
         build->text = (CHAR*) (raw_size ? raw_text : NULL);
         build->substr_types = build->trivial_types;
@@ -1419,10 +1566,12 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
         build->trivial_offsets[1] = raw_size;
         off = raw_size;
     } else {
-        build->text = (CHAR*) malloc(raw_size * sizeof(CHAR));
-        if(build->text == NULL) {
-            MD_LOG("malloc() failed.");
-            goto abort;
+        if(is_verbatim) {
+            build->text = (CHAR*) raw_text;
+        } else {
+            build->text = (CHAR*) md_arena_alloc(ctx, raw_size * sizeof(CHAR));
+            if(build->text == NULL)
+                goto abort;
         }
 
         raw_off = 0;
@@ -1431,7 +1580,8 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
         while(raw_off < raw_size) {
             if(raw_text[raw_off] == _T('\0')) {
                 MD_CHECK(md_build_attr_append_substr(ctx, build, MD_TEXT_NULLCHAR, off));
-                memcpy(build->text + off, raw_text + raw_off, 1);
+                if(!is_verbatim)
+                    memcpy(build->text + off, raw_text + raw_off, 1);
                 off++;
                 raw_off++;
                 continue;
@@ -1442,7 +1592,8 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
 
                 if(md_is_entity_str(ctx, raw_text, raw_off, raw_size, &ent_end)) {
                     MD_CHECK(md_build_attr_append_substr(ctx, build, MD_TEXT_ENTITY, off));
-                    memcpy(build->text + off, raw_text + raw_off, ent_end - raw_off);
+                    if(!is_verbatim)
+                        memcpy(build->text + off, raw_text + raw_off, ent_end - raw_off);
                     off += ent_end - raw_off;
                     raw_off = ent_end;
                     continue;
@@ -1452,6 +1603,12 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
             if(build->substr_count == 0  ||  build->substr_types[build->substr_count-1] != MD_TEXT_NORMAL)
                 MD_CHECK(md_build_attr_append_substr(ctx, build, MD_TEXT_NORMAL, off));
 
+            if(is_verbatim) {
+                off++;
+                raw_off++;
+                continue;
+            }
+
             if(!(flags & MD_BUILD_ATTR_NO_ESCAPES)  &&
                raw_text[raw_off] == _T('\\')  &&  raw_off+1 < raw_size  &&
                (ISPUNCT_(raw_text[raw_off+1]) || ISNEWLINE_(raw_text[raw_off+1])))
@@ -1469,7 +1626,6 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
     return 0;
 
 abort:
-    md_free_attribute(ctx, build);
     return -1;
 }
 
@@ -1481,37 +1637,71 @@ abort:
 #define MD_FNV1A_BASE       2166136261U
 #define MD_FNV1A_PRIME      16777619U
 
-static inline unsigned
-md_fnv1a(unsigned base, const void* data, size_t n)
-{
-    const unsigned char* buf = (const unsigned char*) data;
-    unsigned hash = base;
-    size_t i;
-
-    for(i = 0; i < n; i++) {
-        hash ^= buf[i];
-        hash *= MD_FNV1A_PRIME;
-    }
-
-    return hash;
-}
+/* Link labels are hashed with FNV-1a applied to the codepoints of the case
+ * folded label (rather than to bytes), so that ASCII characters take a single
+ * step. */
+#define MD_LABEL_HASH_STEP(hash, codepoint)     (((hash) ^ (codepoint)) * MD_FNV1A_PRIME)
 
 
 struct MD_REF_DEF_tag {
     CHAR* label;
     CHAR* title;
-    unsigned hash;
+    CHAR* dest;
     SZ label_size;
     SZ title_size;
-    OFF dest_beg;
-    OFF dest_end;
-    unsigned char label_needs_free : 1;
-    unsigned char title_needs_free : 1;
+    SZ dest_size;
 };
 
 /* Label equivalence is quite complicated with regards to whitespace and case
  * folding. This complicates computing a hash of it as well as direct comparison
- * of two labels. */
+ * of two labels.
+ *
+ * Most labels are plain ASCII though, which is handled by a fast path: the
+ * table below gives the case folded ASCII character, or ' ' for any whitespace
+ * (including new lines). */
+static const unsigned char md_label_fold_ascii[128] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f
+};
+
+#ifndef MD4C_USE_UTF16
+    /* With byte-sized characters, runs of eight characters which are all ASCII
+     * other than whitespace and control characters (i.e. 0x21 - 0x7f, which
+     * fold one to one) are also processed a word at a time. */
+    #define MD_LABEL_WORD_ONES      ((uint64_t) 0x0101010101010101ULL)
+
+    static inline uint64_t
+    md_label_load_word(const CHAR* str)
+    {
+        uint64_t word;
+        memcpy(&word, str, sizeof(uint64_t));
+        return word;
+    }
+
+    static inline int
+    md_label_word_is_plain(uint64_t word)
+    {
+        /* A byte below 0x21 borrows (and sets its high bit) in the subtraction;
+         * one above 0x7f has its high bit set already. */
+        return (((word - MD_LABEL_WORD_ONES * 0x21) | word) & (MD_LABEL_WORD_ONES * 0x80)) == 0;
+    }
+
+    /* Case folds a plain word (see above). */
+    static inline uint64_t
+    md_label_fold_word(uint64_t word)
+    {
+        uint64_t upper = (word + MD_LABEL_WORD_ONES * (0x80 - 'A'))
+                       & ~(word + MD_LABEL_WORD_ONES * (0x80 - 'Z' - 1))
+                       & (MD_LABEL_WORD_ONES * 0x80);
+        return word | (upper >> 2);
+    }
+#endif
 
 static unsigned
 md_link_label_hash(const CHAR* label, SZ size)
@@ -1519,24 +1709,51 @@ md_link_label_hash(const CHAR* label, SZ size)
     unsigned hash = MD_FNV1A_BASE;
     OFF off;
     unsigned codepoint;
-    int is_whitespace = FALSE;
 
     off = md_skip_unicode_whitespace(label, 0, size);
     while(off < size) {
         SZ char_size;
 
-        codepoint = md_decode_unicode(label, off, size, &char_size);
-        is_whitespace = ISUNICODEWHITESPACE_(codepoint) || ISNEWLINE_(label[off]);
+#ifndef MD4C_USE_UTF16
+        while(off + 8 <= size  &&  md_label_word_is_plain(md_label_load_word(label + off))) {
+            const unsigned char* p = (const unsigned char*) label + off;
+            int i;
+
+            for(i = 0; i < 8; i++)
+                hash = MD_LABEL_HASH_STEP(hash, md_label_fold_ascii[p[i]]);
+            off += 8;
+        }
+        if(off >= size)
+            break;
+#endif
 
-        if(is_whitespace) {
-            codepoint = ' ';
-            hash = md_fnv1a(hash, &codepoint, sizeof(unsigned));
+        /* A run of whitespace counts as one space, and trailing whitespace
+         * not at all (as in md_link_label_cmp()). */
+        if(ISASCII_(label[off])) {
+            codepoint = md_label_fold_ascii[(unsigned) label[off]];
+            if(codepoint == _T(' ')) {
+                off = md_skip_unicode_whitespace(label, off, size);
+                if(off < size)
+                    hash = MD_LABEL_HASH_STEP(hash, codepoint);
+            } else {
+                hash = MD_LABEL_HASH_STEP(hash, codepoint);
+                off++;
+            }
+            continue;
+        }
+
+        codepoint = md_decode_unicode(label, off, size, &char_size);
+        if(ISUNICODEWHITESPACE_(codepoint)) {
             off = md_skip_unicode_whitespace(label, off, size);
+            if(off < size)
+                hash = MD_LABEL_HASH_STEP(hash, _T(' '));
         } else {
             MD_UNICODE_FOLD_INFO fold_info;
+            unsigned i;
 
             md_get_unicode_fold_info(codepoint, &fold_info);
-            hash = md_fnv1a(hash, fold_info.codepoints, fold_info.n_codepoints * sizeof(unsigned));
+            for(i = 0; i < fold_info.n_codepoints; i++)
+                hash = MD_LABEL_HASH_STEP(hash, fold_info.codepoints[i]);
             off += char_size;
         }
     }
@@ -1556,10 +1773,16 @@ md_link_label_cmp_load_fold_info(const CHAR* label, OFF off, SZ size,
         goto whitespace;
     }
 
-    if(ISNEWLINE_(label[off])) {
-        /* Treat new lines as a whitespace. */
+    if(ISASCII_(label[off])) {
+        codepoint = md_label_fold_ascii[(unsigned) label[off]];
         off++;
-        goto whitespace;
+        if(codepoint == _T(' ')) {
+            /* Treat all whitespace, including new lines, as equivalent. */
+            goto whitespace;
+        }
+        fold_info->codepoints[0] = codepoint;
+        fold_info->n_codepoints = 1;
+        return off;
     }
 
     codepoint = md_decode_unicode(label, off, size, &char_size);
@@ -1594,6 +1817,22 @@ md_link_label_cmp(const CHAR* a_label, SZ a_size, const CHAR* b_label, SZ b_size
 
     a_off = md_skip_unicode_whitespace(a_label, 0, a_size);
     b_off = md_skip_unicode_whitespace(b_label, 0, b_size);
+
+#ifndef MD4C_USE_UTF16
+    /* Skip the common prefix of plain words; the rest (including any
+     * difference in it) is compared character by character below. */
+    while(a_off + 8 <= a_size  &&  b_off + 8 <= b_size) {
+        uint64_t a_word = md_label_load_word(a_label + a_off);
+        uint64_t b_word = md_label_load_word(b_label + b_off);
+
+        if(!md_label_word_is_plain(a_word)  ||  !md_label_word_is_plain(b_word)  ||
+           md_label_fold_word(a_word) != md_label_fold_word(b_word))
+            break;
+        a_off += 8;
+        b_off += 8;
+    }
+#endif
+
     while(!a_reached_end  ||  !b_reached_end) {
         /* If needed, load fold info for next char. */
         if(a_fi_off >= a_fi.n_codepoints) {
@@ -1618,221 +1857,115 @@ md_link_label_cmp(const CHAR* a_label, SZ a_size, const CHAR* b_label, SZ b_size
     return 0;
 }
 
-typedef struct MD_REF_DEF_LIST_tag MD_REF_DEF_LIST;
-struct MD_REF_DEF_LIST_tag {
-    int n_ref_defs;
-    int alloc_ref_defs;
-    MD_REF_DEF* ref_defs[];  /* Valid items always  point into ctx->ref_defs[] */
+/* The hashtable of reference definitions uses open addressing with linear
+ * probing. Each slot holds the hash of the label, so that only labels with
+ * the same hash are ever compared, and the index of the definition. */
+struct MD_REF_DEF_SLOT_tag {
+    unsigned hash;
+    unsigned def;       /* Index into ctx->ref_defs[] plus one; zero if empty. */
 };
 
-static int
-md_ref_def_cmp(const void* a, const void* b)
-{
-    const MD_REF_DEF* a_ref = *(const MD_REF_DEF**)a;
-    const MD_REF_DEF* b_ref = *(const MD_REF_DEF**)b;
-
-    if(a_ref->hash < b_ref->hash)
-        return -1;
-    else if(a_ref->hash > b_ref->hash)
-        return +1;
-    else
-        return md_link_label_cmp(a_ref->label, a_ref->label_size, b_ref->label, b_ref->label_size);
-}
-
-static int
-md_ref_def_cmp_for_sort(const void* a, const void* b)
-{
-    int cmp;
-
-    cmp = md_ref_def_cmp(a, b);
-
-    /* Ensure stability of the sorting. */
-    if(cmp == 0) {
-        const MD_REF_DEF* a_ref = *(const MD_REF_DEF**)a;
-        const MD_REF_DEF* b_ref = *(const MD_REF_DEF**)b;
-
-        if(a_ref < b_ref)
-            cmp = -1;
-        else if(a_ref > b_ref)
-            cmp = +1;
-        else
-            cmp = 0;
-    }
-
-    return cmp;
-}
-
 static int
 md_build_ref_def_hashtable(MD_CTX* ctx)
 {
-    int i, j;
+    unsigned mask;
+    int size;
+    int i;
 
     if(ctx->n_ref_defs == 0)
         return 0;
 
-    ctx->ref_def_hashtable_size = (ctx->n_ref_defs * 5) / 4;
-    ctx->ref_def_hashtable = malloc(ctx->ref_def_hashtable_size * sizeof(void*));
-    if(ctx->ref_def_hashtable == NULL) {
-        MD_LOG("malloc() failed.");
-        goto abort;
-    }
-    memset(ctx->ref_def_hashtable, 0, ctx->ref_def_hashtable_size * sizeof(void*));
-
-    /* Each member of ctx->ref_def_hashtable[] can be:
-     *  -- NULL,
-     *  -- pointer to the MD_REF_DEF in ctx->ref_defs[], or
-     *  -- pointer to a MD_REF_DEF_LIST, which holds multiple pointers to
-     *     such MD_REF_DEFs.
-     */
-    for(i = 0; i < ctx->n_ref_defs; i++) {
-        MD_REF_DEF* def = &ctx->ref_defs[i];
-        void* bucket;
-        MD_REF_DEF_LIST* list;
-
-        def->hash = md_link_label_hash(def->label, def->label_size);
-        bucket = ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size];
-
-        if(bucket == NULL) {
-            /* The bucket is empty. Make it just point to the def. */
-            ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size] = def;
-            continue;
-        }
+    /* Keep the table at most half full so that probe sequences stay short. */
+    size = 16;
+    while(size < 2 * ctx->n_ref_defs)
+        size *= 2;
+    mask = (unsigned) size - 1;
 
-        if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs) {
-            /* The bucket already contains one ref. def. Lets see whether it
-             * is the same label (ref. def. duplicate) or different one
-             * (hash conflict). */
-            MD_REF_DEF* old_def = (MD_REF_DEF*) bucket;
+    ctx->ref_def_hashtable = (MD_REF_DEF_SLOT*) md_arena_alloc(ctx, size * sizeof(MD_REF_DEF_SLOT));
+    if(ctx->ref_def_hashtable == NULL)
+        return -1;
+    memset(ctx->ref_def_hashtable, 0, size * sizeof(MD_REF_DEF_SLOT));
+    ctx->ref_def_hashtable_size = size;
 
-            if(md_link_label_cmp(def->label, def->label_size, old_def->label, old_def->label_size) == 0) {
-                /* Duplicate label: Ignore this ref. def. */
-                continue;
-            }
+    for(i = 0; i < ctx->n_ref_defs; i++) {
+        const MD_REF_DEF* def = &ctx->ref_defs[i];
+        unsigned hash = md_link_label_hash(def->label, def->label_size);
+        unsigned pos = hash & mask;
+        MD_REF_DEF_SLOT* slot;
+
+        while(1) {
+            slot = &ctx->ref_def_hashtable[pos];
+            if(slot->def == 0)
+                break;
+            if(slot->hash == hash) {
+                const MD_REF_DEF* old_def = &ctx->ref_defs[slot->def - 1];
 
-            /* Make the bucket complex, i.e. able to hold more ref. defs. */
-            list = (MD_REF_DEF_LIST*) malloc(sizeof(MD_REF_DEF_LIST) + 2 * sizeof(MD_REF_DEF*));
-            if(list == NULL) {
-                MD_LOG("malloc() failed.");
-                goto abort;
+                /* Duplicate label: The first ref. def. wins. */
+                if(md_link_label_cmp(def->label, def->label_size, old_def->label, old_def->label_size) == 0)
+                    break;
             }
-            list->ref_defs[0] = old_def;
-            list->ref_defs[1] = def;
-            list->n_ref_defs = 2;
-            list->alloc_ref_defs = 2;
-            ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size] = list;
-            continue;
+            pos = (pos + 1) & mask;
         }
 
-        /* Append the def to the complex bucket list.
-         *
-         * Note in this case we ignore potential duplicates to avoid expensive
-         * iterating over the complex bucket. Below, we revisit all the complex
-         * buckets and handle it more cheaply after the complex bucket contents
-         * is sorted. */
-        list = (MD_REF_DEF_LIST*) bucket;
-        if(list->n_ref_defs >= list->alloc_ref_defs) {
-            int alloc_ref_defs = list->alloc_ref_defs + list->alloc_ref_defs / 2;
-            MD_REF_DEF_LIST* list_tmp = (MD_REF_DEF_LIST*) realloc(list,
-                        sizeof(MD_REF_DEF_LIST) + alloc_ref_defs * sizeof(MD_REF_DEF*));
-            if(list_tmp == NULL) {
-                MD_LOG("realloc() failed.");
-                goto abort;
-            }
-            list = list_tmp;
-            list->alloc_ref_defs = alloc_ref_defs;
-            ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size] = list;
+        if(slot->def == 0) {
+            slot->hash = hash;
+            slot->def = i + 1;
         }
-
-        list->ref_defs[list->n_ref_defs] = def;
-        list->n_ref_defs++;
     }
 
-    /* Sort the complex buckets so we can use bsearch() with them. */
-    for(i = 0; i < ctx->ref_def_hashtable_size; i++) {
-        void* bucket = ctx->ref_def_hashtable[i];
-        MD_REF_DEF_LIST* list;
-
-        if(bucket == NULL)
-            continue;
-        if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs)
-            continue;
+    return 0;
+}
 
-        list = (MD_REF_DEF_LIST*) bucket;
-        qsort(list->ref_defs, list->n_ref_defs, sizeof(MD_REF_DEF*), md_ref_def_cmp_for_sort);
+/* Shared reference definitions (see md_ref_defs_create()) are kept in the
+ * context they were analyzed with, of which only the reference definitions
+ * and the arena holding them are used. */
+struct MD_REF_DEFS_tag {
+    MD_CTX ctx;
+    CHAR* text;
+};
 
-        /* Disable all duplicates in the complex bucket by forcing all such
-         * records to point to the 1st such ref. def. I.e. no matter which
-         * record is found during the lookup, it will always point to the right
-         * ref. def. in ctx->ref_defs[]. */
-        for(j = 1; j < list->n_ref_defs; j++) {
-            if(md_ref_def_cmp(&list->ref_defs[j-1], &list->ref_defs[j]) == 0)
-                list->ref_defs[j] = list->ref_defs[j-1];
-        }
-    }
+static const MD_REF_DEF*
+md_lookup_ref_def_in(const MD_CTX* ctx, const CHAR* label, SZ label_size, unsigned hash)
+{
+    unsigned mask = (unsigned) ctx->ref_def_hashtable_size - 1;
+    unsigned pos = hash & mask;
 
-    return 0;
+    if(ctx->ref_def_hashtable_size == 0)
+        return NULL;
 
-abort:
-    return -1;
-}
+    while(ctx->ref_def_hashtable[pos].def != 0) {
+        const MD_REF_DEF_SLOT* slot = &ctx->ref_def_hashtable[pos];
 
-static void
-md_free_ref_def_hashtable(MD_CTX* ctx)
-{
-    if(ctx->ref_def_hashtable != NULL) {
-        int i;
+        if(slot->hash == hash) {
+            const MD_REF_DEF* def = &ctx->ref_defs[slot->def - 1];
 
-        for(i = 0; i < ctx->ref_def_hashtable_size; i++) {
-            void* bucket = ctx->ref_def_hashtable[i];
-            if(bucket == NULL)
-                continue;
-            if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs)
-                continue;
-            free(bucket);
+            if(md_link_label_cmp(def->label, def->label_size, label, label_size) == 0)
+                return def;
         }
-
-        free(ctx->ref_def_hashtable);
+        pos = (pos + 1) & mask;
     }
+
+    return NULL;
 }
 
+/* Definitions in the document take precedence over the shared ones, as if
+ * those were appended to the document. */
 static const MD_REF_DEF*
 md_lookup_ref_def(MD_CTX* ctx, const CHAR* label, SZ label_size)
 {
+    const MD_REF_DEF* def;
     unsigned hash;
-    void* bucket;
 
-    if(ctx->ref_def_hashtable_size == 0)
-        return NULL;
-
-    hash = md_link_label_hash(label, label_size);
-    bucket = ctx->ref_def_hashtable[hash % ctx->ref_def_hashtable_size];
+    MD_STATS_COUNT(ref_def_lookups, 1);
 
-    if(bucket == NULL) {
+    if(ctx->ref_def_hashtable_size == 0  &&  ctx->parser.ref_defs == NULL)
         return NULL;
-    } else if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs) {
-        const MD_REF_DEF* def = (MD_REF_DEF*) bucket;
 
-        if(md_link_label_cmp(def->label, def->label_size, label, label_size) == 0)
-            return def;
-        else
-            return NULL;
-    } else {
-        MD_REF_DEF_LIST* list = (MD_REF_DEF_LIST*) bucket;
-        MD_REF_DEF key_buf;
-        const MD_REF_DEF* key = &key_buf;
-        const MD_REF_DEF** ret;
-
-        key_buf.label = (CHAR*) label;
-        key_buf.label_size = label_size;
-        key_buf.hash = md_link_label_hash(key_buf.label, key_buf.label_size);
-
-        ret = (const MD_REF_DEF**) bsearch(&key, list->ref_defs,
-                    list->n_ref_defs, sizeof(MD_REF_DEF*), md_ref_def_cmp);
-        if(ret != NULL)
-            return *ret;
-        else
-            return NULL;
-    }
+    hash = md_link_label_hash(label, label_size);
+    def = md_lookup_ref_def_in(ctx, label, label_size, hash);
+    if(def == NULL  &&  ctx->parser.ref_defs != NULL)
+        def = md_lookup_ref_def_in(&ctx->parser.ref_defs->ctx, label, label_size, hash);
+    return def;
 }
 
 
@@ -1846,12 +1979,13 @@ md_lookup_ref_def(MD_CTX* ctx, const CHAR* label, SZ label_size)
 
 typedef struct MD_LINK_ATTR_tag MD_LINK_ATTR;
 struct MD_LINK_ATTR_tag {
-    OFF dest_beg;
-    OFF dest_end;
+    /* Not necessarily in ctx->text; the destination of a link to a shared
+     * reference definition (see MD_REF_DEFS) is in the text of those. */
+    CHAR* dest;
+    SZ dest_size;
 
     CHAR* title;
     SZ title_size;
-    int title_needs_free;
 };
 
 
@@ -2155,11 +2289,10 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
         ctx->alloc_ref_defs = (ctx->alloc_ref_defs > 0
                 ? ctx->alloc_ref_defs + ctx->alloc_ref_defs / 2
                 : 16);
-        new_defs = (MD_REF_DEF*) realloc(ctx->ref_defs, ctx->alloc_ref_defs * sizeof(MD_REF_DEF));
-        if(new_defs == NULL) {
-            MD_LOG("realloc() failed.");
+        new_defs = (MD_REF_DEF*) md_arena_realloc(ctx, ctx->ref_defs,
+                    ctx->n_ref_defs * sizeof(MD_REF_DEF), ctx->alloc_ref_defs * sizeof(MD_REF_DEF));
+        if(new_defs == NULL)
             goto abort;
-        }
 
         ctx->ref_defs = new_defs;
     }
@@ -2170,7 +2303,6 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
         MD_CHECK(md_merge_lines_alloc(ctx, label_contents_beg, label_contents_end,
                     lines + label_contents_line_index,
                     _T(' '), &def->label, &def->label_size));
-        def->label_needs_free = TRUE;
     } else {
         def->label = (CHAR*) STR(label_contents_beg);
         def->label_size = label_contents_end - label_contents_beg;
@@ -2180,14 +2312,13 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
         MD_CHECK(md_merge_lines_alloc(ctx, title_contents_beg, title_contents_end,
                     lines + title_contents_line_index,
                     _T('\n'), &def->title, &def->title_size));
-        def->title_needs_free = TRUE;
     } else {
         def->title = (CHAR*) STR(title_contents_beg);
         def->title_size = title_contents_end - title_contents_beg;
     }
 
-    def->dest_beg = dest_contents_beg;
-    def->dest_end = dest_contents_end;
+    def->dest = (CHAR*) STR(dest_contents_beg);
+    def->dest_size = dest_contents_end - dest_contents_beg;
 
     /* Success. */
     ctx->n_ref_defs++;
@@ -2195,10 +2326,6 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 
 abort:
     /* Failure. */
-    if(def != NULL  &&  def->label_needs_free)
-        free(def->label);
-    if(def != NULL  &&  def->title_needs_free)
-        free(def->title);
     return ret;
 }
 
@@ -2239,16 +2366,12 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
 
     def = md_lookup_ref_def(ctx, label, label_size);
     if(def != NULL) {
-        attr->dest_beg = def->dest_beg;
-        attr->dest_end = def->dest_end;
+        attr->dest = def->dest;
+        attr->dest_size = def->dest_size;
         attr->title = def->title;
         attr->title_size = def->title_size;
-        attr->title_needs_free = FALSE;
     }
 
-    if(beg_line != end_line)
-        free(label);
-
     ret = (def != NULL);
 
 abort:
@@ -2265,6 +2388,8 @@ md_is_inline_link_spec(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
     OFF title_contents_end;
     int title_contents_line_index;
     int title_is_multiline;
+    OFF dest_contents_beg;
+    OFF dest_contents_end;
     OFF off = beg;
     int ret = FALSE;
 
@@ -2277,7 +2402,7 @@ md_is_inline_link_spec(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
     /* Optional white space with up to one line break. */
     while(off < lines[line_index].end  &&  ISWHITESPACE(off))
         off++;
-    if(off >= lines[line_index].end  &&  ISNEWLINE(off)) {
+    if(off >= lines[line_index].end  &&  (off >= ctx->size  ||  ISNEWLINE(off))) {
         line_index++;
         if(line_index >= n_lines)
             return FALSE;
@@ -2286,11 +2411,10 @@ md_is_inline_link_spec(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
 
     /* Link destination may be omitted, but only when not also having a title. */
     if(off < ctx->size  &&  CH(off) == _T(')')) {
-        attr->dest_beg = off;
-        attr->dest_end = off;
+        attr->dest = (CHAR*) STR(off);
+        attr->dest_size = 0;
         attr->title = NULL;
         attr->title_size = 0;
-        attr->title_needs_free = FALSE;
         off++;
         *p_end = off;
         return TRUE;
@@ -2298,8 +2422,10 @@ md_is_inline_link_spec(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
 
     /* Link destination. */
     if(!md_is_link_destination(ctx, off, lines[line_index].end,
-                        &off, &attr->dest_beg, &attr->dest_end))
+                        &off, &dest_contents_beg, &dest_contents_end))
         return FALSE;
+    attr->dest = (CHAR*) STR(dest_contents_beg);
+    attr->dest_size = dest_contents_end - dest_contents_beg;
 
     /* (Optional) title. */
     if(md_is_link_title(ctx, lines + line_index, n_lines - line_index, off,
@@ -2320,29 +2446,26 @@ md_is_inline_link_spec(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
     /* Optional whitespace followed with final ')'. */
     while(off < lines[line_index].end  &&  ISWHITESPACE(off))
         off++;
-    if(off >= lines[line_index].end  &&  ISNEWLINE(off)) {
+    if(off >= lines[line_index].end  &&  (off >= ctx->size  ||  ISNEWLINE(off))) {
         line_index++;
         if(line_index >= n_lines)
             return FALSE;
         off = lines[line_index].beg;
     }
-    if(CH(off) != _T(')'))
+    if(off >= ctx->size  ||  CH(off) != _T(')'))
         goto abort;
     off++;
 
     if(title_contents_beg >= title_contents_end) {
         attr->title = NULL;
         attr->title_size = 0;
-        attr->title_needs_free = FALSE;
     } else if(!title_is_multiline) {
         attr->title = (CHAR*) STR(title_contents_beg);
         attr->title_size = title_contents_end - title_contents_beg;
-        attr->title_needs_free = FALSE;
     } else {
         MD_CHECK(md_merge_lines_alloc(ctx, title_contents_beg, title_contents_end,
                     lines + title_contents_line_index,
                     _T('\n'), &attr->title, &attr->title_size));
-        attr->title_needs_free = TRUE;
     }
 
     *p_end = off;
@@ -2352,24 +2475,6 @@ abort:
     return ret;
 }
 
-static void
-md_free_ref_defs(MD_CTX* ctx)
-{
-    int i;
-
-    for(i = 0; i < ctx->n_ref_defs; i++) {
-        MD_REF_DEF* def = &ctx->ref_defs[i];
-
-        if(def->label_needs_free)
-            free(def->label);
-        if(def->title_needs_free)
-            free(def->title);
-    }
-
-    free(ctx->ref_defs);
-}
-
-
 /******************************************
  ***  Processing Inlines (a.k.a Spans)  ***
  ******************************************/
@@ -2434,22 +2539,27 @@ md_free_ref_defs(MD_CTX* ctx)
  * the special meaning.
  *
  * (Keep this struct as small as possible to fit as much of them into CPU
- * cache line.)
+ * cache line. Most passes over ctx->marks only look at these members of each
+ * mark, so the chain links are stored separately in MD_MARKLINK.)
  */
 struct MD_MARK_tag {
     OFF beg;
     OFF end;
+    CHAR ch;
+    unsigned char flags;
+};
 
-    /* For unresolved openers, 'prev' and 'next' form the chain of open openers
-     * of given type 'ch'.
-     *
-     * During resolving, we disconnect from the chain and point to the
-     * corresponding counterpart so opener points to its closer and vice versa.
-     */
+/* Chain links of the mark of the same index, in ctx->mark_links[].
+ *
+ * For unresolved openers, 'prev' and 'next' form the chain of open openers
+ * of given type 'ch'.
+ *
+ * During resolving, we disconnect from the chain and point to the
+ * corresponding counterpart so opener points to its closer and vice versa.
+ */
+struct MD_MARKLINK_tag {
     int prev;
     int next;
-    CHAR ch;
-    unsigned char flags;
 };
 
 /* Mark flags (these apply to ALL mark types). */
@@ -2503,19 +2613,32 @@ md_push_mark(MD_CTX* ctx)
 {
     if(ctx->n_marks >= ctx->alloc_marks) {
         MD_MARK* new_marks;
-
-        ctx->alloc_marks = (ctx->alloc_marks > 0
+        MD_MARKLINK* new_mark_links;
+        int alloc_marks = (ctx->alloc_marks > 0
                 ? ctx->alloc_marks + ctx->alloc_marks / 2
                 : 64);
-        new_marks = realloc(ctx->marks, ctx->alloc_marks * sizeof(MD_MARK));
+
+        new_marks = realloc(ctx->marks, alloc_marks * sizeof(MD_MARK));
         if(new_marks == NULL) {
             MD_LOG("realloc() failed.");
             return NULL;
         }
-
         ctx->marks = new_marks;
+
+        new_mark_links = realloc(ctx->mark_links, alloc_marks * sizeof(MD_MARKLINK));
+        if(new_mark_links == NULL) {
+            MD_LOG("realloc() failed.");
+            return NULL;
+        }
+        ctx->mark_links = new_mark_links;
+
+        ctx->alloc_marks = alloc_marks;
     }
 
+    ctx->mark_links[ctx->n_marks].prev = -1;
+    ctx->mark_links[ctx->n_marks].next = -1;
+
+    MD_STATS_COUNT(marks, 1);
     return &ctx->marks[ctx->n_marks++];
 }
 
@@ -2533,8 +2656,6 @@ md_push_mark(MD_CTX* ctx)
             PUSH_MARK_();                                               \
             mark->beg = (beg_);                                         \
             mark->end = (end_);                                         \
-            mark->prev = -1;                                            \
-            mark->next = -1;                                            \
             mark->ch = (char)(ch_);                                     \
             mark->flags = (flags_);                                     \
         } while(0)
@@ -2544,12 +2665,12 @@ static void
 md_mark_chain_append(MD_CTX* ctx, MD_MARKCHAIN* chain, int mark_index)
 {
     if(chain->tail >= 0)
-        ctx->marks[chain->tail].next = mark_index;
+        ctx->mark_links[chain->tail].next = mark_index;
     else
         chain->head = mark_index;
 
-    ctx->marks[mark_index].prev = chain->tail;
-    ctx->marks[mark_index].next = -1;
+    ctx->mark_links[mark_index].prev = chain->tail;
+    ctx->mark_links[mark_index].next = -1;
     chain->tail = mark_index;
 }
 
@@ -2582,24 +2703,25 @@ md_resolve_range(MD_CTX* ctx, MD_MARKCHAIN* chain, int opener_index, int closer_
 {
     MD_MARK* opener = &ctx->marks[opener_index];
     MD_MARK* closer = &ctx->marks[closer_index];
+    MD_MARKLINK* opener_link = &ctx->mark_links[opener_index];
 
     /* Remove opener from the list of openers. */
     if(chain != NULL) {
-        if(opener->prev >= 0)
-            ctx->marks[opener->prev].next = opener->next;
+        if(opener_link->prev >= 0)
+            ctx->mark_links[opener_link->prev].next = opener_link->next;
         else
-            chain->head = opener->next;
+            chain->head = opener_link->next;
 
-        if(opener->next >= 0)
-            ctx->marks[opener->next].prev = opener->prev;
+        if(opener_link->next >= 0)
+            ctx->mark_links[opener_link->next].prev = opener_link->prev;
         else
-            chain->tail = opener->prev;
+            chain->tail = opener_link->prev;
     }
 
     /* Interconnect opener and closer and mark both as resolved. */
-    opener->next = closer_index;
+    opener_link->next = closer_index;
     opener->flags |= MD_MARK_OPENER | MD_MARK_RESOLVED;
-    closer->prev = opener_index;
+    ctx->mark_links[closer_index].prev = opener_index;
     closer->flags |= MD_MARK_CLOSER | MD_MARK_RESOLVED;
 }
 
@@ -2628,15 +2750,17 @@ md_rollback(MD_CTX* ctx, int opener_index, int closer_index, int how)
     int i;
     int mark_index;
 
+    MD_STATS_COUNT(rollbacks, 1);
+
     /* Cut all unresolved openers at the mark index. */
     for(i = OPENERS_CHAIN_FIRST; i < OPENERS_CHAIN_LAST+1; i++) {
         MD_MARKCHAIN* chain = &ctx->mark_chains[i];
 
         while(chain->tail >= opener_index)
-            chain->tail = ctx->marks[chain->tail].prev;
+            chain->tail = ctx->mark_links[chain->tail].prev;
 
         if(chain->tail >= 0)
-            ctx->marks[chain->tail].next = -1;
+            ctx->mark_links[chain->tail].next = -1;
         else
             chain->head = -1;
     }
@@ -2650,7 +2774,7 @@ md_rollback(MD_CTX* ctx, int opener_index, int closer_index, int how)
         int discard_flag = (how == MD_ROLLBACK_ALL);
 
         if(mark->flags & MD_MARK_CLOSER) {
-            int mark_opener_index = mark->prev;
+            int mark_opener_index = ctx->mark_links[mark_index].prev;
 
             /* Undo opener BEFORE the range. */
             if(mark_opener_index < opener_index) {
@@ -2673,10 +2797,10 @@ md_rollback(MD_CTX* ctx, int opener_index, int closer_index, int how)
         /* Jump as far as we can over unresolved or non-interesting marks. */
         switch(how) {
             case MD_ROLLBACK_CROSSING:
-                if((mark_flags & MD_MARK_CLOSER)  &&  mark->prev > opener_index) {
+                if((mark_flags & MD_MARK_CLOSER)  &&  ctx->mark_links[mark_index].prev > opener_index) {
                     /* If we are closer with opener INSIDE the range, there may
                      * not be any other crosser inside the subrange. */
-                    mark_index = mark->prev;
+                    mark_index = ctx->mark_links[mark_index].prev;
                     break;
                 }
                 /* Pass through. */
@@ -2720,17 +2844,101 @@ md_build_mark_char_map(MD_CTX* ctx)
     if(ctx->parser.flags & MD_FLAG_PERMISSIVEWWWAUTOLINKS)
         ctx->mark_char_map['.'] = 1;
 
-    if((ctx->parser.flags & MD_FLAG_TABLES) || (ctx->parser.flags & MD_FLAG_WIKILINKS))
-        ctx->mark_char_map['|'] = 1;
+    if((ctx->parser.flags & MD_FLAG_TABLES) || (ctx->parser.flags & MD_FLAG_WIKILINKS))
+        ctx->mark_char_map['|'] = 1;
+
+    if(ctx->parser.flags & MD_FLAG_COLLAPSEWHITESPACE) {
+        int i;
+
+        for(i = 0; i < (int) sizeof(ctx->mark_char_map); i++) {
+            if(ISWHITESPACE_(i))
+                ctx->mark_char_map[i] = 1;
+        }
+    }
+
+#ifdef MD4C_SIMD
+    {
+        int i;
+
+        /* All mark chars are ASCII, so bits 0-7 (for the high nibble) suffice. */
+        memset(ctx->mark_char_nibbles, 0, sizeof(ctx->mark_char_nibbles));
+        for(i = 0; i < 128; i++) {
+            MD_ASSERT(ctx->mark_char_map[i + 128] == 0);
+            if(ctx->mark_char_map[i])
+                ctx->mark_char_nibbles[i & 0xf] |= (unsigned char)(1 << (i >> 4));
+        }
+    }
+#endif
+}
+
+#ifdef MD4C_SIMD
+/* Returns a bitmask with bit N set if p[N] is a mark char, for N in [0,16). */
+static inline unsigned
+md_mark_char_mask16(MD_CTX* ctx, const CHAR* p)
+{
+#if defined MD4C_SIMD_WASM
+    const v128_t nibbles = wasm_v128_load(ctx->mark_char_nibbles);
+    const v128_t hibits = wasm_i8x16_const(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    v128_t v = wasm_v128_load(p);
+    v128_t lo = wasm_i8x16_swizzle(nibbles, wasm_v128_and(v, wasm_i8x16_splat(0x0f)));
+    v128_t hi = wasm_i8x16_swizzle(hibits, wasm_u8x16_shr(v, 4));
+    v128_t hit = wasm_v128_and(lo, hi);
+    return (unsigned) wasm_i8x16_bitmask(wasm_i8x16_ne(hit, wasm_i8x16_splat(0)));
+#elif defined MD4C_SIMD_SSSE3
+    const __m128i nibbles = _mm_loadu_si128((const __m128i*) ctx->mark_char_nibbles);
+    const __m128i hibits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i low4 = _mm_set1_epi8(0x0f);
+    __m128i v = _mm_loadu_si128((const __m128i*) p);
+    __m128i lo = _mm_shuffle_epi8(nibbles, _mm_and_si128(v, low4));
+    __m128i hi = _mm_shuffle_epi8(hibits, _mm_and_si128(_mm_srli_epi16(v, 4), low4));
+    __m128i miss = _mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128());
+    return (unsigned) _mm_movemask_epi8(miss) ^ 0xffff;
+#elif defined MD4C_SIMD_NEON
+    static const uint8_t hibits_data[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0 };
+    static const uint8_t lanebits_data[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t v = vld1q_u8((const uint8_t*) p);
+    uint8x16_t lo = vqtbl1q_u8(vld1q_u8(ctx->mark_char_nibbles), vandq_u8(v, vdupq_n_u8(0x0f)));
+    uint8x16_t hi = vqtbl1q_u8(vld1q_u8(hibits_data), vshrq_n_u8(v, 4));
+    uint8x16_t hit = vandq_u8(vtstq_u8(lo, hi), vld1q_u8(lanebits_data));
+    return (unsigned) vaddv_u8(vget_low_u8(hit)) | ((unsigned) vaddv_u8(vget_high_u8(hit)) << 8);
+#endif
+}
+#endif
+
+/* Returns offset of the first mark char in the range [off, end), or end if
+ * there is none. */
+static inline OFF
+md_scan_mark_chars(MD_CTX* ctx, OFF off, OFF end)
+{
+#ifdef MD4C_USE_UTF16
+    /* For UTF-16, mark_char_map[] covers only ASCII. */
+    #define IS_MARK_CHAR(off)   ((CH(off) < SIZEOF_ARRAY(ctx->mark_char_map))  &&  \
+                                (ctx->mark_char_map[(unsigned char) CH(off)]))
+#else
+    /* For 8-bit encodings, mark_char_map[] covers all 256 elements. */
+    #define IS_MARK_CHAR(off)   (ctx->mark_char_map[(unsigned char) CH(off)])
+#endif
+
+#ifdef MD4C_SIMD
+    /* Check 16 chars at a time. */
+    while(off + 16 <= end) {
+        unsigned mask = md_mark_char_mask16(ctx, STR(off));
+        if(mask != 0)
+            return off + (OFF) __builtin_ctz(mask);
+        off += 16;
+    }
+#endif
+
+    /* Optimization: Use some loop unrolling. */
+    while(off + 3 < end  &&  !IS_MARK_CHAR(off+0)  &&  !IS_MARK_CHAR(off+1)
+                         &&  !IS_MARK_CHAR(off+2)  &&  !IS_MARK_CHAR(off+3))
+        off += 4;
+    while(off < end  &&  !IS_MARK_CHAR(off+0))
+        off++;
 
-    if(ctx->parser.flags & MD_FLAG_COLLAPSEWHITESPACE) {
-        int i;
+    return off;
 
-        for(i = 0; i < (int) sizeof(ctx->mark_char_map); i++) {
-            if(ISWHITESPACE_(i))
-                ctx->mark_char_map[i] = 1;
-        }
-    }
+#undef IS_MARK_CHAR
 }
 
 /* We limit code span marks to lower than 32 backticks. This solves the
@@ -2976,25 +3184,12 @@ md_collect_marks(MD_CTX* ctx, const MD_LINE* lines, int n_lines, int table_mode)
         OFF off = line->beg;
         OFF line_end = line->end;
 
+        MD_STATS_COUNT(scanned_bytes, line_end - off);
+
         while(TRUE) {
             CHAR ch;
 
-#ifdef MD4C_USE_UTF16
-    /* For UTF-16, mark_char_map[] covers only ASCII. */
-    #define IS_MARK_CHAR(off)   ((CH(off) < SIZEOF_ARRAY(ctx->mark_char_map))  &&  \
-                                (ctx->mark_char_map[(unsigned char) CH(off)]))
-#else
-    /* For 8-bit encodings, mark_char_map[] covers all 256 elements. */
-    #define IS_MARK_CHAR(off)   (ctx->mark_char_map[(unsigned char) CH(off)])
-#endif
-
-            /* Optimization: Use some loop unrolling. */
-            while(off + 3 < line_end  &&  !IS_MARK_CHAR(off+0)  &&  !IS_MARK_CHAR(off+1)
-                                      &&  !IS_MARK_CHAR(off+2)  &&  !IS_MARK_CHAR(off+3))
-                off += 4;
-            while(off < line_end  &&  !IS_MARK_CHAR(off+0))
-                off++;
-
+            off = md_scan_mark_chars(ctx, off, line_end);
             if(off >= line_end)
                 break;
 
@@ -3091,8 +3286,8 @@ md_collect_marks(MD_CTX* ctx, const MD_LINE* lines, int n_lines, int table_mode)
                 if(is_code_span) {
                     PUSH_MARK(_T('`'), opener_beg, opener_end, MD_MARK_OPENER | MD_MARK_RESOLVED);
                     PUSH_MARK(_T('`'), closer_beg, closer_end, MD_MARK_CLOSER | MD_MARK_RESOLVED);
-                    ctx->marks[ctx->n_marks-2].next = ctx->n_marks-1;
-                    ctx->marks[ctx->n_marks-1].prev = ctx->n_marks-2;
+                    ctx->mark_links[ctx->n_marks-2].next = ctx->n_marks-1;
+                    ctx->mark_links[ctx->n_marks-1].prev = ctx->n_marks-2;
 
                     off = closer_end;
 
@@ -3144,8 +3339,8 @@ md_collect_marks(MD_CTX* ctx, const MD_LINE* lines, int n_lines, int table_mode)
                     if(is_html) {
                         PUSH_MARK(_T('<'), off, off, MD_MARK_OPENER | MD_MARK_RESOLVED);
                         PUSH_MARK(_T('>'), html_end, html_end, MD_MARK_CLOSER | MD_MARK_RESOLVED);
-                        ctx->marks[ctx->n_marks-2].next = ctx->n_marks-1;
-                        ctx->marks[ctx->n_marks-1].prev = ctx->n_marks-2;
+                        ctx->mark_links[ctx->n_marks-2].next = ctx->n_marks-1;
+                        ctx->mark_links[ctx->n_marks-1].prev = ctx->n_marks-2;
                         off = html_end;
 
                         /* Advance the current line accordingly. */
@@ -3165,8 +3360,8 @@ md_collect_marks(MD_CTX* ctx, const MD_LINE* lines, int n_lines, int table_mode)
                                 MD_MARK_OPENER | MD_MARK_RESOLVED | MD_MARK_AUTOLINK);
                     PUSH_MARK(_T('>'), autolink_end-1, autolink_end,
                                 MD_MARK_CLOSER | MD_MARK_RESOLVED | MD_MARK_AUTOLINK);
-                    ctx->marks[ctx->n_marks-2].next = ctx->n_marks-1;
-                    ctx->marks[ctx->n_marks-1].prev = ctx->n_marks-2;
+                    ctx->mark_links[ctx->n_marks-2].next = ctx->n_marks-1;
+                    ctx->mark_links[ctx->n_marks-1].prev = ctx->n_marks-2;
                     off = autolink_end;
                     continue;
                 }
@@ -3363,26 +3558,26 @@ md_analyze_bracket(MD_CTX* ctx, int mark_index)
     if(BRACKET_OPENERS.tail >= 0) {
         /* Pop the opener from the chain. */
         int opener_index = BRACKET_OPENERS.tail;
-        MD_MARK* opener = &ctx->marks[opener_index];
-        if(opener->prev >= 0)
-            ctx->marks[opener->prev].next = -1;
+        MD_MARKLINK* opener_link = &ctx->mark_links[opener_index];
+        if(opener_link->prev >= 0)
+            ctx->mark_links[opener_link->prev].next = -1;
         else
             BRACKET_OPENERS.head = -1;
-        BRACKET_OPENERS.tail = opener->prev;
+        BRACKET_OPENERS.tail = opener_link->prev;
 
         /* Interconnect the opener and closer. */
-        opener->next = mark_index;
-        mark->prev = opener_index;
+        opener_link->next = mark_index;
+        ctx->mark_links[mark_index].prev = opener_index;
 
         /* Add the pair into chain of potential links for md_resolve_links().
-         * Note we misuse opener->prev for this as opener->next points to its
+         * Note we misuse opener's prev for this as its next points to its
          * closer. */
         if(ctx->unresolved_link_tail >= 0)
-            ctx->marks[ctx->unresolved_link_tail].prev = opener_index;
+            ctx->mark_links[ctx->unresolved_link_tail].prev = opener_index;
         else
             ctx->unresolved_link_head = opener_index;
         ctx->unresolved_link_tail = opener_index;
-        opener->prev = -1;
+        opener_link->prev = -1;
     }
 }
 
@@ -3400,9 +3595,9 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 
     while(opener_index >= 0) {
         MD_MARK* opener = &ctx->marks[opener_index];
-        int closer_index = opener->next;
+        int closer_index = ctx->mark_links[opener_index].next;
         MD_MARK* closer = &ctx->marks[closer_index];
-        int next_index = opener->prev;
+        int next_index = ctx->mark_links[opener_index].prev;
         MD_MARK* next_opener;
         MD_MARK* next_closer;
         MD_LINK_ATTR attr;
@@ -3410,7 +3605,7 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 
         if(next_index >= 0) {
             next_opener = &ctx->marks[next_index];
-            next_closer = &ctx->marks[next_opener->next];
+            next_closer = &ctx->marks[ctx->mark_links[next_index].next];
         } else {
             next_opener = NULL;
             next_closer = NULL;
@@ -3493,11 +3688,11 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                 }
 
                 opener->beg = next_opener->beg;
-                opener->next = closer_index;
+                ctx->mark_links[opener_index].next = closer_index;
                 opener->flags |= MD_MARK_OPENER | MD_MARK_RESOLVED;
 
                 closer->end = next_closer->end;
-                closer->prev = opener_index;
+                ctx->mark_links[closer_index].prev = opener_index;
                 closer->flags |= MD_MARK_CLOSER | MD_MARK_RESOLVED;
 
                 last_link_beg = opener->beg;
@@ -3511,7 +3706,7 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                     md_rollback(ctx, opener_index, closer_index, MD_ROLLBACK_ALL);
                 }
 
-                opener_index = next_opener->prev;
+                opener_index = ctx->mark_links[next_index].prev;
                 continue;
             }
         }
@@ -3534,7 +3729,7 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 
                 /* Do not analyze the label as a standalone link in the next
                  * iteration. */
-                next_index = ctx->marks[next_index].prev;
+                next_index = ctx->mark_links[next_index].prev;
             }
         } else {
             if(closer->end < ctx->size  &&  CH(closer->end) == _T('(')) {
@@ -3556,15 +3751,13 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                         if(mark->beg >= inline_link_end)
                             break;
                         if((mark->flags & (MD_MARK_OPENER | MD_MARK_RESOLVED)) == (MD_MARK_OPENER | MD_MARK_RESOLVED)) {
-                            if(ctx->marks[mark->next].beg >= inline_link_end) {
+                            if(ctx->marks[ctx->mark_links[i].next].beg >= inline_link_end) {
                                 /* Cancel the link status. */
-                                if(attr.title_needs_free)
-                                    free(attr.title);
                                 is_link = FALSE;
                                 break;
                             }
 
-                            i = mark->next + 1;
+                            i = ctx->mark_links[i].next + 1;
                         } else {
                             i++;
                         }
@@ -3593,15 +3786,12 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
             /* If it is a link, we store the destination and title in the two
              * dummy marks after the opener. */
             MD_ASSERT(ctx->marks[opener_index+1].ch == 'D');
-            ctx->marks[opener_index+1].beg = attr.dest_beg;
-            ctx->marks[opener_index+1].end = attr.dest_end;
+            md_mark_store_ptr(ctx, opener_index+1, attr.dest);
+            ctx->mark_links[opener_index+1].prev = attr.dest_size;
 
             MD_ASSERT(ctx->marks[opener_index+2].ch == 'D');
             md_mark_store_ptr(ctx, opener_index+2, attr.title);
-            /* The title might or might not have been allocated for us. */
-            if(attr.title_needs_free)
-                md_mark_chain_append(ctx, &PTR_CHAIN, opener_index+2);
-            ctx->marks[opener_index+2].prev = attr.title_size;
+            ctx->mark_links[opener_index+2].prev = attr.title_size;
 
             if(opener->ch == '[') {
                 last_link_beg = opener->beg;
@@ -3675,6 +3865,7 @@ md_split_emph_mark(MD_CTX* ctx, int mark_index, SZ n)
     MD_ASSERT(dummy->ch == 'D');
 
     memcpy(dummy, mark, sizeof(MD_MARK));
+    memcpy(&ctx->mark_links[new_mark_index], &ctx->mark_links[mark_index], sizeof(MD_MARKLINK));
     mark->end -= n;
     dummy->beg = mark->end;
 
@@ -3935,8 +4126,8 @@ md_analyze_marks(MD_CTX* ctx, int mark_beg, int mark_end, const CHAR* mark_chars
         /* Skip resolved spans. */
         if(mark->flags & MD_MARK_RESOLVED) {
             if(mark->flags & MD_MARK_OPENER) {
-                MD_ASSERT(i < mark->next);
-                i = mark->next + 1;
+                MD_ASSERT(i < ctx->mark_links[i].next);
+                i = ctx->mark_links[i].next + 1;
             } else {
                 i++;
             }
@@ -4049,8 +4240,6 @@ md_enter_leave_span_a(MD_CTX* ctx, int enter, MD_SPANTYPE type,
         MD_LEAVE_SPAN(type, &det);
 
 abort:
-    md_free_attribute(ctx, &href_build);
-    md_free_attribute(ctx, &title_build);
     return ret;
 }
 
@@ -4070,7 +4259,6 @@ md_enter_leave_span_wikilink(MD_CTX* ctx, int enter, const CHAR* target, SZ targ
         MD_LEAVE_SPAN(MD_SPAN_WIKILINK, &det);
 
 abort:
-    md_free_attribute(ctx, &target_build);
     return ret;
 }
 
@@ -4102,7 +4290,7 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
         /* Process the text up to the next mark or end-of-line. */
         OFF tmp = (line->end < mark->beg ? line->end : mark->beg);
         if(tmp > off) {
-            MD_TEXT(text_type, STR(off), tmp - off);
+            MD_INLINE_TEXT(text_type, STR(off), tmp - off);
             off = tmp;
         }
 
@@ -4113,19 +4301,19 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                     if(ISNEWLINE(mark->beg+1))
                         enforce_hardbreak = 1;
                     else
-                        MD_TEXT(text_type, STR(mark->beg+1), 1);
+                        MD_INLINE_TEXT(text_type, STR(mark->beg+1), 1);
                     break;
 
                 case ' ':       /* Non-trivial space. */
-                    MD_TEXT(text_type, _T(" "), 1);
+                    MD_INLINE_TEXT(text_type, _T(" "), 1);
                     break;
 
                 case '`':       /* Code span. */
                     if(mark->flags & MD_MARK_OPENER) {
-                        MD_ENTER_SPAN(MD_SPAN_CODE, NULL);
+                        MD_INLINE_ENTER_SPAN(MD_SPAN_CODE, "code");
                         text_type = MD_TEXT_CODE;
                     } else {
-                        MD_LEAVE_SPAN(MD_SPAN_CODE, NULL);
+                        MD_INLINE_LEAVE_SPAN(MD_SPAN_CODE, "code");
                         text_type = MD_TEXT_NORMAL;
                     }
                     break;
@@ -4134,12 +4322,12 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                     if(ctx->parser.flags & MD_FLAG_UNDERLINE) {
                         if(mark->flags & MD_MARK_OPENER) {
                             while(off < mark->end) {
-                                MD_ENTER_SPAN(MD_SPAN_U, NULL);
+                                MD_INLINE_ENTER_SPAN(MD_SPAN_U, "u");
                                 off++;
                             }
                         } else {
                             while(off < mark->end) {
-                                MD_LEAVE_SPAN(MD_SPAN_U, NULL);
+                                MD_INLINE_LEAVE_SPAN(MD_SPAN_U, "u");
                                 off++;
                             }
                         }
@@ -4150,20 +4338,20 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                 case '*':       /* Emphasis, strong emphasis. */
                     if(mark->flags & MD_MARK_OPENER) {
                         if((mark->end - off) % 2) {
-                            MD_ENTER_SPAN(MD_SPAN_EM, NULL);
+                            MD_INLINE_ENTER_SPAN(MD_SPAN_EM, "em");
                             off++;
                         }
                         while(off + 1 < mark->end) {
-                            MD_ENTER_SPAN(MD_SPAN_STRONG, NULL);
+                            MD_INLINE_ENTER_SPAN(MD_SPAN_STRONG, "b");
                             off += 2;
                         }
                     } else {
                         while(off + 1 < mark->end) {
-                            MD_LEAVE_SPAN(MD_SPAN_STRONG, NULL);
+                            MD_INLINE_LEAVE_SPAN(MD_SPAN_STRONG, "b");
                             off += 2;
                         }
                         if((mark->end - off) % 2) {
-                            MD_LEAVE_SPAN(MD_SPAN_EM, NULL);
+                            MD_INLINE_LEAVE_SPAN(MD_SPAN_EM, "em");
                             off++;
                         }
                     }
@@ -4171,9 +4359,9 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 
                 case '~':
                     if(mark->flags & MD_MARK_OPENER)
-                        MD_ENTER_SPAN(MD_SPAN_DEL, NULL);
+                        MD_INLINE_ENTER_SPAN(MD_SPAN_DEL, "del");
                     else
-                        MD_LEAVE_SPAN(MD_SPAN_DEL, NULL);
+                        MD_INLINE_LEAVE_SPAN(MD_SPAN_DEL, "del");
                     break;
 
                 case '$':
@@ -4190,8 +4378,9 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                 case '!':
                 case ']':
                 {
-                    const MD_MARK* opener = (mark->ch != ']' ? mark : &ctx->marks[mark->prev]);
-                    const MD_MARK* closer = &ctx->marks[opener->next];
+                    int opener_index = (mark->ch != ']' ? (int)(mark - ctx->marks) : ctx->mark_links[mark - ctx->marks].prev);
+                    const MD_MARK* opener = &ctx->marks[opener_index];
+                    const MD_MARK* closer = &ctx->marks[ctx->mark_links[opener_index].next];
                     const MD_MARK* dest_mark;
                     const MD_MARK* title_mark;
 
@@ -4221,8 +4410,8 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 
                     MD_CHECK(md_enter_leave_span_a(ctx, (mark->ch != ']'),
                                 (opener->ch == '!' ? MD_SPAN_IMG : MD_SPAN_A),
-                                STR(dest_mark->beg), dest_mark->end - dest_mark->beg, FALSE,
-                                md_mark_get_ptr(ctx, title_mark - ctx->marks), title_mark->prev));
+                                md_mark_get_ptr(ctx, opener_index+1), ctx->mark_links[opener_index+1].prev, FALSE,
+                                md_mark_get_ptr(ctx, opener_index+2), ctx->mark_links[opener_index+2].prev));
 
                     /* link/image closer may span multiple lines. */
                     if(mark->ch == ']') {
@@ -4249,8 +4438,9 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                 case ':':       /* Permissive URL autolink. */
                 case '.':       /* Permissive WWW autolink. */
                 {
-                    MD_MARK* opener = ((mark->flags & MD_MARK_OPENER) ? mark : &ctx->marks[mark->prev]);
-                    MD_MARK* closer = &ctx->marks[opener->next];
+                    int opener_index = ((mark->flags & MD_MARK_OPENER) ? (int)(mark - ctx->marks) : ctx->mark_links[mark - ctx->marks].prev);
+                    MD_MARK* opener = &ctx->marks[opener_index];
+                    MD_MARK* closer = &ctx->marks[ctx->mark_links[opener_index].next];
                     const CHAR* dest = STR(opener->end);
                     SZ dest_size = closer->beg - opener->end;
 
@@ -4280,7 +4470,7 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                 }
 
                 case '&':       /* Entity. */
-                    MD_TEXT(MD_TEXT_ENTITY, STR(mark->beg), mark->end - mark->beg);
+                    MD_INLINE_TEXT(MD_TEXT_ENTITY, STR(mark->beg), mark->end - mark->beg);
                     break;
 
                 case '\0':
@@ -4319,11 +4509,11 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                 while(off < ctx->size  &&  ISBLANK(off))
                     off++;
                 if(off > tmp)
-                    MD_TEXT(text_type, STR(tmp), off-tmp);
+                    MD_INLINE_TEXT(text_type, STR(tmp), off-tmp);
 
                 /* and new lines are transformed into single spaces. */
                 if(prev_mark->end < off  &&  off < mark->beg)
-                    MD_TEXT(text_type, _T(" "), 1);
+                    MD_INLINE_TEXT(text_type, _T(" "), 1);
             } else if(text_type == MD_TEXT_HTML) {
                 /* Inside raw HTML, we output the new line verbatim, including
                  * any trailing spaces. */
@@ -4332,8 +4522,8 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                 while(tmp < end  &&  ISBLANK(tmp))
                     tmp++;
                 if(tmp > off)
-                    MD_TEXT(MD_TEXT_HTML, STR(off), tmp - off);
-                MD_TEXT(MD_TEXT_HTML, _T("\n"), 1);
+                    MD_INLINE_TEXT(MD_TEXT_HTML, STR(off), tmp - off);
+                MD_INLINE_TEXT(MD_TEXT_HTML, _T("\n"), 1);
             } else {
                 /* Output soft or hard line break. */
                 MD_TEXTTYPE break_type = MD_TEXT_SOFTBR;
@@ -4345,7 +4535,7 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                         break_type = MD_TEXT_BR;
                 }
 
-                MD_TEXT(break_type, _T("\n"), 1);
+                MD_INLINE_TEXT(break_type, _T("\n"), 1);
             }
 
             /* Move to the next line. */
@@ -4421,6 +4611,7 @@ static int
 md_process_table_row(MD_CTX* ctx, MD_BLOCKTYPE cell_type, OFF beg, OFF end,
                      const MD_ALIGN* align, int col_count)
 {
+    MD_ARENA_MARK arena_mark = md_arena_mark(ctx);
     MD_LINE line;
     OFF* pipe_offs = NULL;
     int i, j, k, n;
@@ -4436,15 +4627,14 @@ md_process_table_row(MD_CTX* ctx, MD_BLOCKTYPE cell_type, OFF beg, OFF end,
     /* We have to remember the cell boundaries in local buffer because
      * ctx->marks[] shall be reused during cell contents processing. */
     n = ctx->n_table_cell_boundaries + 2;
-    pipe_offs = (OFF*) malloc(n * sizeof(OFF));
+    pipe_offs = (OFF*) md_arena_alloc(ctx, n * sizeof(OFF));
     if(pipe_offs == NULL) {
-        MD_LOG("malloc() failed.");
         ret = -1;
         goto abort;
     }
     j = 0;
     pipe_offs[j++] = beg;
-    for(i = TABLECELLBOUNDARIES.head; i >= 0; i = ctx->marks[i].next) {
+    for(i = TABLECELLBOUNDARIES.head; i >= 0; i = ctx->mark_links[i].next) {
         MD_MARK* mark = &ctx->marks[i];
         pipe_offs[j++] = mark->end;
     }
@@ -4464,14 +4654,8 @@ md_process_table_row(MD_CTX* ctx, MD_BLOCKTYPE cell_type, OFF beg, OFF end,
     MD_LEAVE_BLOCK(MD_BLOCK_TR, NULL);
 
 abort:
-    free(pipe_offs);
-
-    /* Free any temporary memory blocks stored within some dummy marks. */
-    for(i = PTR_CHAIN.head; i >= 0; i = ctx->marks[i].next)
-        free(md_mark_get_ptr(ctx, i));
-    PTR_CHAIN.head = -1;
-    PTR_CHAIN.tail = -1;
-
+    /* Release any temporary memory used by the row (e.g. link titles). */
+    md_arena_release(ctx, arena_mark);
     return ret;
 }
 
@@ -4486,9 +4670,8 @@ md_process_table_block_contents(MD_CTX* ctx, int col_count, const MD_LINE* lines
      * with the underlines. */
     MD_ASSERT(n_lines >= 2);
 
-    align = malloc(col_count * sizeof(MD_ALIGN));
+    align = md_arena_alloc(ctx, col_count * sizeof(MD_ALIGN));
     if(align == NULL) {
-        MD_LOG("malloc() failed.");
         ret = -1;
         goto abort;
     }
@@ -4508,7 +4691,6 @@ md_process_table_block_contents(MD_CTX* ctx, int col_count, const MD_LINE* lines
     MD_LEAVE_BLOCK(MD_BLOCK_TBODY, NULL);
 
 abort:
-    free(align);
     return ret;
 }
 
@@ -4522,6 +4704,7 @@ abort:
 #define MD_BLOCK_CONTAINER          (MD_BLOCK_CONTAINER_OPENER | MD_BLOCK_CONTAINER_CLOSER)
 #define MD_BLOCK_LOOSE_LIST         0x04
 #define MD_BLOCK_SETEXT_HEADER      0x08
+#define MD_BLOCK_SOURCE_MARK        0x10
 
 struct MD_BLOCK_tag {
     MD_BLOCKTYPE type  :  8;
@@ -4556,19 +4739,12 @@ struct MD_CONTAINER_tag {
 static int
 md_process_normal_block_contents(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 {
-    int i;
     int ret;
 
     MD_CHECK(md_analyze_inlines(ctx, lines, n_lines, FALSE));
     MD_CHECK(md_process_inlines(ctx, lines, n_lines));
 
 abort:
-    /* Free any temporary memory blocks stored within some dummy marks. */
-    for(i = PTR_CHAIN.head; i >= 0; i = ctx->marks[i].next)
-        free(md_mark_get_ptr(ctx, i));
-    PTR_CHAIN.head = -1;
-    PTR_CHAIN.tail = -1;
-
     return ret;
 }
 
@@ -4677,8 +4853,8 @@ md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
     } det;
     MD_ATTRIBUTE_BUILD info_build;
     MD_ATTRIBUTE_BUILD lang_build;
+    MD_ARENA_MARK arena_mark = md_arena_mark(ctx);
     int is_in_tight_list;
-    int clean_fence_code_detail = FALSE;
     int ret = 0;
 
     memset(&det, 0, sizeof(det));
@@ -4697,7 +4873,6 @@ md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
             /* For fenced code block, we may need to set the info string. */
             if(block->data != 0) {
                 memset(&det.code, 0, sizeof(MD_BLOCK_CODE_DETAIL));
-                clean_fence_code_detail = TRUE;
                 MD_CHECK(md_setup_fenced_code_detail(ctx, block, &det.code, &info_build, &lang_build));
             }
             break;
@@ -4741,17 +4916,17 @@ md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
         MD_LEAVE_BLOCK(block->type, (void*) &det);
 
 abort:
-    if(clean_fence_code_detail) {
-        md_free_attribute(ctx, &info_build);
-        md_free_attribute(ctx, &lang_build);
-    }
+    /* All the temporary memory used for the block contents (attributes, link
+     * titles etc.) is released here at once. */
+    md_arena_release(ctx, arena_mark);
     return ret;
 }
 
+/* Processes blocks in ctx->block_bytes from byte_off up to byte_end. The range
+ * has to start at a top-level block, i.e. outside of any container. */
 static int
-md_process_all_blocks(MD_CTX* ctx)
+md_process_blocks(MD_CTX* ctx, int byte_off, int byte_end)
 {
-    int byte_off = 0;
     int ret = 0;
 
     /* ctx->containers now is not needed for detection of lists and list items
@@ -4760,7 +4935,7 @@ md_process_all_blocks(MD_CTX* ctx)
      * level of lists. */
     ctx->n_containers = 0;
 
-    while(byte_off < ctx->n_block_bytes) {
+    while(byte_off < byte_end) {
         MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
         union {
             MD_BLOCK_UL_DETAIL ul;
@@ -4768,6 +4943,12 @@ md_process_all_blocks(MD_CTX* ctx)
             MD_BLOCK_LI_DETAIL li;
         } det;
 
+        if(block->flags & MD_BLOCK_SOURCE_MARK) {
+            ctx->parser.top_block((OFF) block->n_lines, ctx->userdata);
+            byte_off += sizeof(MD_BLOCK);
+            continue;
+        }
+
         switch(block->type) {
             case MD_BLOCK_UL:
                 det.ul.is_tight = (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
@@ -4825,12 +5006,20 @@ md_process_all_blocks(MD_CTX* ctx)
         byte_off += sizeof(MD_BLOCK);
     }
 
-    ctx->n_block_bytes = 0;
-
 abort:
     return ret;
 }
 
+static int
+md_process_all_blocks(MD_CTX* ctx)
+{
+    int ret;
+
+    ret = md_process_blocks(ctx, 0, ctx->n_block_bytes);
+    ctx->n_block_bytes = 0;
+    return ret;
+}
+
 
 /************************************
  ***  Grouping Lines into Blocks  ***
@@ -4867,6 +5056,27 @@ md_push_block_bytes(MD_CTX* ctx, int n_bytes)
     return ptr;
 }
 
+/* Pushes a pseudo-block recording that a top-level block starts on the
+ * current line. It is reported via MD_PARSER::top_block in
+ * md_process_all_blocks(), in order with the rendering callbacks. */
+static int
+md_push_source_mark(MD_CTX* ctx)
+{
+    MD_BLOCK* block;
+
+    MD_ASSERT(ctx->current_block == NULL);
+
+    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
+    if(block == NULL)
+        return -1;
+
+    block->type = MD_BLOCK_DOC;
+    block->flags = MD_BLOCK_SOURCE_MARK;
+    block->data = 0;
+    block->n_lines = ctx->line_beg;
+    return 0;
+}
+
 static int
 md_start_new_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* line)
 {
@@ -4874,9 +5084,15 @@ md_start_new_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* line)
 
     MD_ASSERT(ctx->current_block == NULL);
 
+    if(ctx->parser.top_block != NULL  &&  ctx->n_containers == 0) {
+        if(md_push_source_mark(ctx) != 0)
+            return -1;
+    }
+
     block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
     if(block == NULL)
         return -1;
+    MD_STATS_COUNT(blocks, 1);
 
     switch(line->type) {
         case MD_LINE_HR:
@@ -4946,6 +5162,19 @@ md_consume_link_reference_definitions(MD_CTX* ctx)
         if(n_link_ref_lines < 0)
             return -1;
 
+        if(ctx->parser.ref_def != NULL) {
+            MD_ARENA_MARK mark = md_arena_mark(ctx);
+            OFF beg = lines[n].beg;
+            OFF end = lines[n + n_link_ref_lines - 1].end;
+            CHAR* str;
+            SZ size;
+
+            if(md_merge_lines_alloc(ctx, beg, end, lines + n, _T('\n'), &str, &size) != 0)
+                return -1;
+            ctx->parser.ref_def(beg, end, str, size, ctx->userdata);
+            md_arena_release(ctx, mark);
+        }
+
         n += n_link_ref_lines;
     }
 
@@ -4983,7 +5212,7 @@ md_end_current_block(MD_CTX* ctx)
        (ctx->current_block->type == MD_BLOCK_H  &&  (ctx->current_block->flags & MD_BLOCK_SETEXT_HEADER)))
     {
         MD_LINE* lines = (MD_LINE*) (ctx->current_block + 1);
-        if(CH(lines[0].beg) == _T('[')) {
+        if(lines[0].beg < ctx->size  &&  CH(lines[0].beg) == _T('[')) {
             MD_CHECK(md_consume_link_reference_definitions(ctx));
             if(ctx->current_block == NULL)
                 return ret;
@@ -5060,6 +5289,9 @@ md_push_container_bytes(MD_CTX* ctx, MD_BLOCKTYPE type, unsigned start,
     block->data = data;
     block->n_lines = start;
 
+    if(type == MD_BLOCK_LI  &&  (flags & MD_BLOCK_CONTAINER_OPENER))
+        ctx->li_opener_end = ctx->n_block_bytes;
+
 abort:
     return ret;
 }
@@ -5416,17 +5648,17 @@ md_is_html_block_end_condition(MD_CTX* ctx, OFF beg, OFF* p_end)
 
             while(off < ctx->size  &&  !ISNEWLINE(off)) {
                 if(CH(off) == _T('<')) {
-                    if(md_ascii_case_eq(STR(off), _T("</script>"), 9)) {
+                    if(off + 9 <= ctx->size  &&  md_ascii_case_eq(STR(off), _T("</script>"), 9)) {
                         *p_end = off + 9;
                         return TRUE;
                     }
 
-                    if(md_ascii_case_eq(STR(off), _T("</style>"), 8)) {
+                    if(off + 8 <= ctx->size  &&  md_ascii_case_eq(STR(off), _T("</style>"), 8)) {
                         *p_end = off + 8;
                         return TRUE;
                     }
 
-                    if(md_ascii_case_eq(STR(off), _T("</pre>"), 6)) {
+                    if(off + 6 <= ctx->size  &&  md_ascii_case_eq(STR(off), _T("</pre>"), 6)) {
                         *p_end = off + 6;
                         return TRUE;
                     }
@@ -5453,7 +5685,7 @@ md_is_html_block_end_condition(MD_CTX* ctx, OFF beg, OFF* p_end)
         case 6:     /* Pass through */
         case 7:
             *p_end = beg;
-            return (ISNEWLINE(beg) ? ctx->html_block_type : FALSE);
+            return ((beg >= ctx->size || ISNEWLINE(beg)) ? ctx->html_block_type : FALSE);
 
         default:
             MD_UNREACHABLE();
@@ -5496,6 +5728,7 @@ md_push_container(MD_CTX* ctx, const MD_CONTAINER* container)
     }
 
     memcpy(&ctx->containers[ctx->n_containers++], container, sizeof(MD_CONTAINER));
+    MD_STATS_COUNT(containers, 1);
     return 0;
 }
 
@@ -5509,6 +5742,11 @@ md_enter_child_containers(MD_CTX* ctx, int n_children, unsigned data)
         MD_CONTAINER* c = &ctx->containers[i];
         int is_ordered_list = FALSE;
 
+        if(i == 0  &&  ctx->parser.top_block != NULL) {
+            MD_CHECK(md_end_current_block(ctx));
+            MD_CHECK(md_push_source_mark(ctx));
+        }
+
         switch(c->ch) {
             case _T(')'):
             case _T('.'):
@@ -5754,24 +5992,28 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
 
         /* Check whether we are HTML block continuation. */
         if(pivot_line->type == MD_LINE_HTML  &&  ctx->html_block_type > 0) {
-            int html_block_type;
+            if(n_parents < ctx->n_containers) {
+                /* HTML block is implicitly ended if the enclosing container
+                 * block ends. */
+                ctx->html_block_type = 0;
+            } else {
+                int html_block_type;
 
-            html_block_type = md_is_html_block_end_condition(ctx, off, &off);
-            if(html_block_type > 0) {
-                MD_ASSERT(html_block_type == ctx->html_block_type);
+                html_block_type = md_is_html_block_end_condition(ctx, off, &off);
+                if(html_block_type > 0) {
+                    MD_ASSERT(html_block_type == ctx->html_block_type);
 
-                /* Make sure this is the last line of the block. */
-                ctx->html_block_type = 0;
+                    /* Make sure this is the last line of the block. */
+                    ctx->html_block_type = 0;
 
-                /* Some end conditions serve as blank lines at the same time. */
-                if(html_block_type == 6 || html_block_type == 7) {
-                    line->type = MD_LINE_BLANK;
-                    line->indent = 0;
-                    break;
+                    /* Some end conditions serve as blank lines at the same time. */
+                    if(html_block_type == 6 || html_block_type == 7) {
+                        line->type = MD_LINE_BLANK;
+                        line->indent = 0;
+                        break;
+                    }
                 }
-            }
 
-            if(n_parents == ctx->n_containers) {
                 line->type = MD_LINE_HTML;
                 break;
             }
@@ -5804,11 +6046,9 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
                  */
                 if(n_parents > 0  &&  ctx->containers[n_parents-1].ch != _T('>')  &&
                    n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
-                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK))
+                   ctx->n_block_bytes == ctx->li_opener_end)
                 {
-                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
-                    if(top_block->type == MD_BLOCK_LI)
-                        ctx->last_list_item_starts_with_two_blank_lines = TRUE;
+                    ctx->last_list_item_starts_with_two_blank_lines = TRUE;
                 }
     #endif
             }
@@ -5822,11 +6062,9 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
             if(ctx->last_list_item_starts_with_two_blank_lines) {
                 if(n_parents > 0  &&  ctx->containers[n_parents-1].ch != _T('>')  &&
                    n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
-                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK))
+                   ctx->n_block_bytes == ctx->li_opener_end)
                 {
-                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
-                    if(top_block->type == MD_BLOCK_LI)
-                        n_parents--;
+                    n_parents--;
                 }
 
                 ctx->last_list_item_starts_with_two_blank_lines = FALSE;
@@ -6033,7 +6271,7 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
                 task_container->is_task = TRUE;
                 task_container->task_mark_off = tmp + 1;
                 off = tmp + 3;
-                while(ISWHITESPACE(off))
+                while(off < ctx->size  &&  ISWHITESPACE(off))
                     off++;
                 line->beg = off;
             }
@@ -6208,21 +6446,24 @@ abort:
     return ret;
 }
 
+/* Analyzes the whole document into ctx->block_bytes and collects all the link
+ * reference definitions. */
 static int
-md_process_doc(MD_CTX *ctx)
+md_analyze_doc(MD_CTX* ctx)
 {
     const MD_LINE_ANALYSIS* pivot_line = &md_dummy_blank_line;
     MD_LINE_ANALYSIS line_buf[2];
     MD_LINE_ANALYSIS* line = &line_buf[0];
     OFF off = 0;
     int ret = 0;
+    MD_STATS_TIMER(t0);
 
-    MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
-
+    MD_STATS_TIME_BEGIN(t0);
     while(off < ctx->size) {
         if(line == pivot_line)
             line = (line == &line_buf[0] ? &line_buf[1] : &line_buf[0]);
 
+        ctx->line_beg = off;
         MD_CHECK(md_analyze_line(ctx, off, &off, pivot_line, line));
         MD_CHECK(md_process_line(ctx, &pivot_line, line));
     }
@@ -6230,10 +6471,30 @@ md_process_doc(MD_CTX *ctx)
     md_end_current_block(ctx);
 
     MD_CHECK(md_build_ref_def_hashtable(ctx));
+    MD_CHECK(md_leave_child_containers(ctx, 0));
+    MD_STATS_COUNT(ref_defs, ctx->n_ref_defs);
+
+abort:
+    MD_STATS_TIME_END(t0, analyze_ns);
+    return ret;
+}
+
+static int
+md_process_doc(MD_CTX *ctx)
+{
+    int ret = 0;
+    MD_STATS_TIMER(t0);
+
+    MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
+
+    MD_CHECK(md_analyze_doc(ctx));
 
     /* Process all blocks. */
-    MD_CHECK(md_leave_child_containers(ctx, 0));
-    MD_CHECK(md_process_all_blocks(ctx));
+    MD_STATS_TIME_BEGIN(t0);
+    ret = md_process_all_blocks(ctx);
+    MD_STATS_TIME_END(t0, process_ns);
+    if(ret < 0)
+        goto abort;
 
     MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
 
@@ -6252,7 +6513,7 @@ abort:
         MD_LOG(buffer);
 
         sprintf(buffer, "Alloced %u bytes for marks buffer.",
-                    (unsigned)(ctx->alloc_marks * sizeof(MD_MARK)));
+                    (unsigned)(ctx->alloc_marks * (sizeof(MD_MARK) + sizeof(MD_MARKLINK))));
         MD_LOG(buffer);
 
         sprintf(buffer, "Alloced %u bytes for aux. buffer.",
@@ -6269,12 +6530,15 @@ abort:
  ***  Public API  ***
  ********************/
 
-int
-md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+/* Sets up a context which is either zeroed or has been used by previous
+ * calls for parsing of a new document; the growable buffers (ctx->buffer,
+ * ctx->marks, ctx->block_bytes and ctx->containers), the arena and the mark
+ * char map are retained across calls while all the other state is reset. */
+static int
+md_setup_ctx(MD_CTX* ctx, const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
 {
-    MD_CTX ctx;
+    MD_CTX retained;
     int i;
-    int ret;
 
     if(parser->abi_version != 0) {
         if(parser->debug_log != NULL)
@@ -6283,33 +6547,394 @@ md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userd
     }
 
     /* Setup context structure. */
-    memset(&ctx, 0, sizeof(MD_CTX));
-    ctx.text = text;
-    ctx.size = size;
-    memcpy(&ctx.parser, parser, sizeof(MD_PARSER));
-    ctx.userdata = userdata;
-    ctx.code_indent_offset = (ctx.parser.flags & MD_FLAG_NOINDENTEDCODEBLOCKS) ? (OFF)(-1) : 4;
-    md_build_mark_char_map(&ctx);
-    ctx.doc_ends_with_newline = (size > 0  &&  ISNEWLINE_(text[size-1]));
+    memcpy(&retained, ctx, sizeof(MD_CTX));
+    memset(ctx, 0, sizeof(MD_CTX));
+    ctx->buffer = retained.buffer;
+    ctx->alloc_buffer = retained.alloc_buffer;
+    ctx->marks = retained.marks;
+    ctx->mark_links = retained.mark_links;
+    ctx->alloc_marks = retained.alloc_marks;
+    ctx->block_bytes = retained.block_bytes;
+    ctx->alloc_block_bytes = retained.alloc_block_bytes;
+    ctx->containers = retained.containers;
+    ctx->alloc_containers = retained.alloc_containers;
+    ctx->arena_first = retained.arena_first;
+    md_arena_reset(ctx);
+
+    ctx->text = text;
+    ctx->size = size;
+    memcpy(&ctx->parser, parser, sizeof(MD_PARSER));
+    ctx->userdata = userdata;
+#ifdef MD4C_HTML_OUTPUT
+    ctx->html = (parser->html_output != NULL ? parser->html_output(userdata) : NULL);
+#endif
+    ctx->code_indent_offset = (ctx->parser.flags & MD_FLAG_NOINDENTEDCODEBLOCKS) ? (OFF)(-1) : 4;
+    if(retained.mark_char_map_valid  &&  retained.mark_char_map_flags == parser->flags) {
+        memcpy(ctx->mark_char_map, retained.mark_char_map, sizeof(ctx->mark_char_map));
+#ifdef MD4C_SIMD
+        memcpy(ctx->mark_char_nibbles, retained.mark_char_nibbles, sizeof(ctx->mark_char_nibbles));
+#endif
+    } else {
+        md_build_mark_char_map(ctx);
+    }
+    ctx->mark_char_map_flags = parser->flags;
+    ctx->mark_char_map_valid = TRUE;
+    ctx->doc_ends_with_newline = (size > 0  &&  ISNEWLINE_(text[size-1]));
 
     /* Reset all unresolved opener mark chains. */
-    for(i = 0; i < (int) SIZEOF_ARRAY(ctx.mark_chains); i++) {
-        ctx.mark_chains[i].head = -1;
-        ctx.mark_chains[i].tail = -1;
+    for(i = 0; i < (int) SIZEOF_ARRAY(ctx->mark_chains); i++) {
+        ctx->mark_chains[i].head = -1;
+        ctx->mark_chains[i].tail = -1;
     }
-    ctx.unresolved_link_head = -1;
-    ctx.unresolved_link_tail = -1;
+    ctx->unresolved_link_head = -1;
+    ctx->unresolved_link_tail = -1;
+
+    return 0;
+}
+
+static int
+md_parse_with_ctx(MD_CTX* ctx, const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+{
+    int ret;
+
+    ret = md_setup_ctx(ctx, text, size, parser, userdata);
+    if(ret != 0)
+        return ret;
 
     /* All the work. */
-    ret = md_process_doc(&ctx);
+    ret = md_process_doc(ctx);
+
+    return ret;
+}
+
+static void
+md_free_ctx_buffers(MD_CTX* ctx)
+{
+    free(ctx->buffer);
+    free(ctx->marks);
+    free(ctx->mark_links);
+    free(ctx->block_bytes);
+    free(ctx->containers);
+    md_arena_free(ctx);
+}
+
+int
+md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+{
+    MD_CTX ctx;
+    int ret;
+
+    memset(&ctx, 0, sizeof(MD_CTX));
+    ret = md_parse_with_ctx(&ctx, text, size, parser, userdata);
+    md_free_ctx_buffers(&ctx);
+
+    return ret;
+}
+
+MD_PARSER_CTX*
+md_ctx_create(void)
+{
+    return (MD_PARSER_CTX*) calloc(1, sizeof(MD_CTX));
+}
+
+int
+md_ctx_parse(MD_PARSER_CTX* ctx, const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+{
+    return md_parse_with_ctx(ctx, text, size, parser, userdata);
+}
+
+void
+md_ctx_reset(MD_PARSER_CTX* ctx)
+{
+    md_free_ctx_buffers(ctx);
+    memset(ctx, 0, sizeof(MD_CTX));
+}
+
+void
+md_ctx_destroy(MD_PARSER_CTX* ctx)
+{
+    if(ctx != NULL) {
+        md_free_ctx_buffers(ctx);
+        free(ctx);
+    }
+}
+
+MD_REF_DEFS*
+md_ref_defs_create(const MD_CHAR* text, MD_SIZE size, unsigned flags)
+{
+    MD_REF_DEFS* defs;
+    MD_PARSER parser;
+    MD_CTX* ctx;
+
+    defs = (MD_REF_DEFS*) calloc(1, sizeof(MD_REF_DEFS));
+    if(defs == NULL)
+        return NULL;
+    defs->text = (CHAR*) malloc(size > 0 ? size * sizeof(CHAR) : 1);
+    if(defs->text == NULL) {
+        free(defs);
+        return NULL;
+    }
+    memcpy(defs->text, text, size * sizeof(CHAR));
+
+    /* Only the analysis of the block structure is needed, which collects the
+     * reference definitions and builds the hashtable of them. The definitions
+     * point into defs->text and the arena, which is all that is kept. */
+    memset(&parser, 0, sizeof(MD_PARSER));
+    parser.flags = flags;
+    ctx = &defs->ctx;
+    if(md_setup_ctx(ctx, defs->text, size, &parser, NULL) != 0  ||  md_analyze_doc(ctx) != 0) {
+        md_ref_defs_destroy(defs);
+        return NULL;
+    }
+
+    free(ctx->buffer);
+    free(ctx->marks);
+    free(ctx->mark_links);
+    free(ctx->block_bytes);
+    free(ctx->containers);
+    ctx->buffer = NULL;
+    ctx->marks = NULL;
+    ctx->mark_links = NULL;
+    ctx->block_bytes = NULL;
+    ctx->containers = NULL;
+    return defs;
+}
+
+void
+md_ref_defs_destroy(MD_REF_DEFS* defs)
+{
+    if(defs != NULL) {
+        md_free_ctx_buffers(&defs->ctx);
+        free(defs->text);
+        free(defs);
+    }
+}
+
+
+/*****************************
+ ***  Parallel Processing  ***
+ *****************************/
+
+/* Maximal number of parts md_parse_parallel() splits a document into, and
+ * the minimal size of the document text per part; splitting up less text
+ * than that costs more than it saves. */
+#define MD_PARALLEL_MAX_PARTS           64
+#define MD_PARALLEL_MIN_PART_SIZE       (32 * 1024)
+
+typedef struct MD_PART_tag MD_PART;
+struct MD_PART_tag {
+    MD_CTX ctx;
+    int byte_beg;
+    int byte_end;
+    int ret;
+#ifdef MD4C_USE_THREADS
+    pthread_t thread;
+    int has_thread;
+#endif
+#ifdef MD4C_STATS
+    MD_STATS stats;     /* counters of the part, added up when done */
+#endif
+};
+
+/* Splits ctx->block_bytes into (at most) n_parts ranges of roughly the same
+ * size. A range may only start at a top-level block, so that processing of
+ * each range starts with no open containers. A source mark (see
+ * md_push_source_mark()) stays in the same range as the block it precedes.
+ * Fills starts[] with the ranges' starting offsets and returns their count. */
+static unsigned
+md_split_blocks(MD_CTX* ctx, unsigned n_parts, int* starts)
+{
+    int byte_off = 0;
+    int depth = 0;
+    int after_mark = FALSE;
+    unsigned n = 1;
+
+    starts[0] = 0;
+    while(byte_off < ctx->n_block_bytes  &&  n < n_parts) {
+        MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
+
+        if(depth == 0  &&  !after_mark  &&
+           byte_off >= (int) (((long long) ctx->n_block_bytes * n) / n_parts))
+        {
+            starts[n++] = byte_off;
+        }
+
+        after_mark = (block->flags & MD_BLOCK_SOURCE_MARK);
+        if(after_mark) {
+            byte_off += sizeof(MD_BLOCK);
+            continue;
+        }
+
+        if(block->flags & MD_BLOCK_CONTAINER) {
+            if(block->flags & MD_BLOCK_CONTAINER_CLOSER)
+                depth--;
+            if(block->flags & MD_BLOCK_CONTAINER_OPENER)
+                depth++;
+        } else if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML) {
+            byte_off += block->n_lines * sizeof(MD_VERBATIMLINE);
+        } else {
+            byte_off += block->n_lines * sizeof(MD_LINE);
+        }
+
+        byte_off += sizeof(MD_BLOCK);
+    }
+
+    return n;
+}
+
+static void*
+md_process_part(void* arg)
+{
+    MD_PART* part = (MD_PART*) arg;
+
+    part->ret = md_process_blocks(&part->ctx, part->byte_beg, part->byte_end);
+    return NULL;
+}
+
+int
+md_parse_parallel(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser,
+                  void** userdata, unsigned n_parts, unsigned* p_n_parts)
+{
+    MD_CTX main_ctx;
+    MD_CTX* ctx = &main_ctx;
+    MD_PART* parts = NULL;
+    int starts[MD_PARALLEL_MAX_PARTS];
+    unsigned n = 1;
+    unsigned i;
+    int ret;
+    MD_STATS_TIMER(t0);
+
+    if(n_parts > MD_PARALLEL_MAX_PARTS)
+        n_parts = MD_PARALLEL_MAX_PARTS;
+    if(n_parts > size / MD_PARALLEL_MIN_PART_SIZE)
+        n_parts = size / MD_PARALLEL_MIN_PART_SIZE;
+
+    memset(ctx, 0, sizeof(MD_CTX));
+    ret = md_setup_ctx(ctx, text, size, parser, userdata[0]);
+    if(ret != 0)
+        goto abort;
+
+    MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
+    MD_CHECK(md_analyze_doc(ctx));
+
+    MD_STATS_TIME_BEGIN(t0);
+    if(n_parts > 1)
+        n = md_split_blocks(ctx, n_parts, starts);
+
+    if(n > 1) {
+        parts = (MD_PART*) calloc(n, sizeof(MD_PART));
+        if(parts == NULL) {
+            MD_LOG("calloc() failed.");
+            n = 1;
+        }
+    }
+
+    if(n == 1) {
+        MD_CHECK(md_process_all_blocks(ctx));
+        MD_STATS_TIME_END(t0, process_ns);
+        MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
+        goto abort;
+    }
 
-    /* Clean-up. */
-    md_free_ref_defs(&ctx);
-    md_free_ref_def_hashtable(&ctx);
-    free(ctx.buffer);
-    free(ctx.marks);
-    free(ctx.block_bytes);
-    free(ctx.containers);
+    /* Each part gets its own copy of the context, sharing the (from now on
+     * read-only) results of the analysis. The 1st part uses the main context
+     * itself. */
+    for(i = 0; i < n; i++) {
+        MD_PART* part = &parts[i];
+
+        part->byte_beg = starts[i];
+        part->byte_end = (i + 1 < n ? starts[i+1] : ctx->n_block_bytes);
+        if(i == 0)
+            continue;
+
+        memcpy(&part->ctx, ctx, sizeof(MD_CTX));
+        part->ctx.userdata = userdata[i];
+#ifdef MD4C_HTML_OUTPUT
+        part->ctx.html = (ctx->parser.html_output != NULL ? ctx->parser.html_output(userdata[i]) : NULL);
+#endif
+#ifdef MD4C_STATS
+        part->ctx.parser.stats = (ctx->parser.stats != NULL ? &part->stats : NULL);
+#endif
+        part->ctx.buffer = NULL;
+        part->ctx.alloc_buffer = 0;
+        part->ctx.marks = NULL;
+        part->ctx.mark_links = NULL;
+        part->ctx.n_marks = 0;
+        part->ctx.alloc_marks = 0;
+        part->ctx.arena_first = NULL;
+        part->ctx.arena_cur = NULL;
+        part->ctx.containers = NULL;
+        if(ctx->alloc_containers > 0) {
+            part->ctx.containers = (MD_CONTAINER*) malloc(ctx->alloc_containers * sizeof(MD_CONTAINER));
+            if(part->ctx.containers == NULL) {
+                MD_LOG("malloc() failed.");
+                part->ret = -1;
+            }
+        }
+    }
+
+#ifdef MD4C_USE_THREADS
+    for(i = 1; i < n; i++) {
+        if(parts[i].ret == 0  &&
+           pthread_create(&parts[i].thread, NULL, md_process_part, &parts[i]) == 0)
+            parts[i].has_thread = TRUE;
+    }
+#endif
+
+    parts[0].ret = md_process_blocks(ctx, parts[0].byte_beg, parts[0].byte_end);
+
+    for(i = 1; i < n; i++) {
+#ifdef MD4C_USE_THREADS
+        if(parts[i].has_thread) {
+            pthread_join(parts[i].thread, NULL);
+            continue;
+        }
+#endif
+        /* No threads, or a thread could not be started: Process the part
+         * here and now. */
+        if(parts[i].ret == 0)
+            md_process_part(&parts[i]);
+    }
+    MD_STATS_TIME_END(t0, process_ns);
+#ifdef MD4C_STATS
+    if(ctx->parser.stats != NULL) {
+        for(i = 1; i < n; i++) {
+            MD_STATS* stats = &parts[i].stats;
+            MD_STATS_COUNT(scanned_bytes, stats->scanned_bytes);
+            MD_STATS_COUNT(marks, stats->marks);
+            MD_STATS_COUNT(rollbacks, stats->rollbacks);
+            MD_STATS_COUNT(ref_def_lookups, stats->ref_def_lookups);
+        }
+    }
+#endif
+
+    ret = 0;
+    for(i = 0; i < n; i++) {
+        if(parts[i].ret != 0) {
+            ret = parts[i].ret;
+            break;
+        }
+    }
+    ctx->n_block_bytes = 0;
+
+    if(ret == 0) {
+        ctx = &parts[n-1].ctx;
+        MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
+    }
 
+abort:
+    if(parts != NULL) {
+        for(i = 1; i < n; i++) {
+            free(parts[i].ctx.buffer);
+            free(parts[i].ctx.marks);
+            free(parts[i].ctx.mark_links);
+            free(parts[i].ctx.containers);
+            md_arena_free(&parts[i].ctx);
+        }
+        free(parts);
+    }
+    md_free_ctx_buffers(&main_ctx);
+    if(p_n_parts != NULL)
+        *p_n_parts = n;
     return ret;
 }
@@ -324,6 +324,65 @@ typedef struct MD_SPAN_WIKILINK {
 #define MD_DIALECT_COMMONMARK               0
 #define MD_DIALECT_GITHUB                   (MD_FLAG_PERMISSIVEAUTOLINKS | MD_FLAG_TABLES | MD_FLAG_STRIKETHROUGH | MD_FLAG_TASKLISTS)
 
+/* Parser statistics.
+ *
+ * Collected only when md4c is built with MD4C_STATS defined and
+ * MD_PARSER::stats is set. Values are added to, so one MD_STATS may be used
+ * to accumulate the statistics of many documents.
+ */
+typedef struct MD_STATS {
+    /* Wall time in nanoseconds spent on analysis of the block structure
+     * (which includes collecting the link reference definitions) and on
+     * processing the blocks (inline analysis and all the callbacks but
+     * the enter_block() and leave_block() of MD_BLOCK_DOC). */
+    unsigned long long analyze_ns;
+    unsigned long long process_ns;
+
+    /* Work done, which for pathological documents may be far out of
+     * proportion to their size. */
+    unsigned long long scanned_bytes;   /* bytes of inline content scanned for marks */
+    unsigned long long marks;           /* inline marks (potential delimiters) pushed */
+    unsigned long long rollbacks;       /* rollbacks of marks when resolving inlines */
+    unsigned long long blocks;          /* leaf blocks */
+    unsigned long long containers;      /* container blocks (block quotes and list items) */
+    unsigned long long ref_defs;        /* link reference definitions */
+    unsigned long long ref_def_lookups; /* look-ups of link reference definitions */
+} MD_STATS;
+
+
+/* Direct HTML output of inline content.
+ *
+ * An HTML renderer may provide this (see MD_PARSER::html_output) to have the
+ * parser write the HTML of the most common inline content straight into the
+ * renderer's output buffer, instead of reporting it through the text(),
+ * enter_span() and leave_span() callbacks one piece at a time. This covers
+ * normal text, code span text, entities, raw HTML, soft line breaks and the
+ * emphasis (<em>), strong emphasis (<b>), underline (<u>), code span (<code>)
+ * and strikethrough (<del>) spans. Everything else, like links, images and
+ * hard line breaks, is still reported through the callbacks.
+ *
+ * The renderer sets 'enabled' to zero while it has to see the inline content
+ * through the callbacks, e.g. inside an image's alt text where no tags may be
+ * output.
+ *
+ * Only supported when MD_CHAR is char (i.e. not with MD4C_USE_UTF16).
+ */
+typedef struct MD_HTML_BUFFER {
+    MD_CHAR* start;     /* start of the data */
+    MD_CHAR* end;       /* end of the allocated space */
+    MD_CHAR* ptr;       /* end of the data */
+} MD_HTML_BUFFER;
+
+typedef struct MD_HTML_OUTPUT {
+    MD_HTML_BUFFER* buf;
+
+    /* Grows buf so that at least size bytes are available at buf->ptr. */
+    void (*reserve)(MD_HTML_BUFFER* buf, MD_SIZE size);
+
+    int enabled;
+} MD_HTML_OUTPUT;
+
+
 /* Parser structure.
  */
 typedef struct MD_PARSER {
@@ -370,6 +429,42 @@ typedef struct MD_PARSER {
     /* Reserved. Set to NULL.
      */
     void (*syntax)(void);
+
+    /* Source position callbacks. Optional (may be NULL).
+     *
+     * These let the application map the output back onto the input, e.g. to
+     * re-parse only a part of the document after it has been edited.
+     *
+     * top_block() is called whenever a top-level block (i.e. one not nested
+     * in any container block) begins, right before the respective
+     * enter_block() callback. The offset is the start of the input line on
+     * which the block begins. A paragraph which is consumed completely as
+     * link reference definitions is reported too, with no enter_block()
+     * callback following.
+     *
+     * ref_def() is called for each link reference definition with the input
+     * range it occupies and its text with any container marks stripped and
+     * its lines joined with '\n'. Note it is called when the definition is
+     * recognized, i.e. before any rendering callbacks are.
+     */
+    void (*top_block)(MD_OFFSET /*offset*/, void* /*userdata*/);
+    void (*ref_def)(MD_OFFSET /*beg*/, MD_OFFSET /*end*/, const MD_CHAR* /*text*/, MD_SIZE /*size*/, void* /*userdata*/);
+
+    /* Statistics to add to. Optional (may be NULL). See MD_STATS.
+     */
+    MD_STATS* stats;
+
+    /* Direct HTML output. Optional (may be NULL). See MD_HTML_OUTPUT.
+     *
+     * Called once per md_parse() (and per part of md_parse_parallel()) with
+     * the respective userdata.
+     */
+    MD_HTML_OUTPUT* (*html_output)(void* /*userdata*/);
+
+    /* Shared link reference definitions to fall back to for labels the
+     * document does not define. Optional (may be NULL). See MD_REF_DEFS.
+     */
+    const struct MD_REF_DEFS_tag* ref_defs;
 } MD_PARSER;
 
 
@@ -390,6 +485,75 @@ typedef MD_PARSER MD_RENDERER;
 int md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata);
 
 
+/* Reusable parser context.
+ *
+ * md_parse() sets up and tears down all its internal state on every call.
+ * Applications parsing many documents can instead create a context once and
+ * pass it to md_ctx_parse(), which then keeps its internal growable buffers
+ * (and, as long as MD_PARSER::flags do not change, some precomputed tables)
+ * allocated from one call to the next.
+ *
+ * md_ctx_reset() releases the retained memory while keeping the context
+ * usable; md_ctx_destroy() releases the context itself.
+ *
+ * A context must not be used by more than one md_ctx_parse() at a time.
+ */
+typedef struct MD_CTX_tag MD_PARSER_CTX;
+
+MD_PARSER_CTX* md_ctx_create(void);
+int md_ctx_parse(MD_PARSER_CTX* ctx, const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata);
+void md_ctx_reset(MD_PARSER_CTX* ctx);
+void md_ctx_destroy(MD_PARSER_CTX* ctx);
+
+
+/* Shared link reference definitions.
+ *
+ * Applications whose documents all use the same link reference definitions
+ * (e.g. a common footer) can parse those once with md_ref_defs_create() and
+ * pass the result as MD_PARSER::ref_defs instead of appending them to every
+ * document. A link label which the document does not define itself is then
+ * looked up in them, as if they followed the document.
+ *
+ * Anything in 'text' other than link reference definitions is ignored. The
+ * 'flags' are MD_PARSER::flags, which affect what is a reference definition
+ * (e.g. not the content of an indented code block). 'text' is copied.
+ *
+ * The definitions are immutable, so they may be used by any number of
+ * parses at the same time, but must outlive them. Returns NULL if out of
+ * memory.
+ */
+typedef struct MD_REF_DEFS_tag MD_REF_DEFS;
+
+MD_REF_DEFS* md_ref_defs_create(const MD_CHAR* text, MD_SIZE size, unsigned flags);
+void md_ref_defs_destroy(MD_REF_DEFS* defs);
+
+
+/* Parallel processing of large documents.
+ *
+ * Like md_parse() but after the (sequential) analysis of the block structure,
+ * the document is split at top-level block boundaries into up to n_parts
+ * parts whose contents are then processed concurrently, each part reporting
+ * to its own userdata[i]. Concatenating the output produced for userdata[0],
+ * userdata[1], ... in order gives the same result as md_parse().
+ *
+ * Entering MD_BLOCK_DOC is reported to userdata[0], leaving it to the last
+ * part used. The number of parts actually used (which is smaller for small
+ * documents) is stored in *p_n_parts.
+ *
+ * The callbacks of different parts may be called from different threads at
+ * the same time. MD_PARSER::top_block and MD_PARSER::ref_def are reported to
+ * the part owning the respective block; ref_def always to userdata[0].
+ *
+ * Parts are processed on their own threads only when md4c is built with
+ * MD4C_USE_THREADS (and pthreads). Otherwise they are processed one after
+ * another.
+ *
+ * MD_PARSER::stats::process_ns is the wall time of processing all the parts.
+ */
+int md_parse_parallel(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser,
+                      void** userdata, unsigned n_parts, unsigned* p_n_parts);
+
+
 #ifdef __cplusplus
     }  /* extern "C" { */
 #endif
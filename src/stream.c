@@ -0,0 +1,284 @@
+#include "common.h"
+#include "fmt_html.h"
+#include "stream.h"
+
+// Pending source is only parsed again once it has doubled, or grown by at
+// least this much, so that a long block fed in small chunks is not parsed over
+// and over again.
+#define STREAM_MIN_GROWTH (16 * 1024)
+
+// top-level block
+typedef struct StreamBlock {
+  u32 srcoff;   // start of the source line the block begins on, in pending
+  u32 htmloff;  // start of the block's HTML, in tmphtml
+  u32 brackets; // FmtHTML.brackets at the start of the block
+} StreamBlock;
+
+// link reference definition
+typedef struct StreamRefDef {
+  u32 srcoff;  // in pending
+  u32 textoff; // in tmpdeftext
+  u32 textlen;
+} StreamRefDef;
+
+// state of one fmt_html run, passed to the callbacks via FmtHTML.userdata
+typedef struct StreamParse {
+  StreamDoc* doc;
+  u32        srcbeg;  // start of the pending source in tmpsrc (it follows reftext)
+  WBuf       defs;    // StreamRefDef[] found in the pending source
+  WBuf       deftext;
+} StreamParse;
+
+
+#define blocksv(b)  ((StreamBlock*)(b)->start)
+#define nblocks(b)  ((u32)(WBufLen(b) / sizeof(StreamBlock)))
+
+
+static void on_top_block(MD_OFFSET srcoff, void* userdata) {
+  FmtHTML* fmt = (FmtHTML*)userdata;
+  StreamParse* p = (StreamParse*)fmt->userdata;
+  if (srcoff >= p->srcbeg) {
+    StreamBlock b = { srcoff - p->srcbeg, (u32)WBufLen(fmt->outbuf), fmt->brackets };
+    WBufAppendBytes(&p->doc->tmpblocks, &b, sizeof(b));
+  }
+}
+
+
+static void on_ref_def(
+  MD_OFFSET beg, MD_OFFSET end, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+  FmtHTML* fmt = (FmtHTML*)userdata;
+  StreamParse* p = (StreamParse*)fmt->userdata;
+  if (beg >= p->srcbeg) {
+    StreamRefDef def = { beg - p->srcbeg, (u32)WBufLen(&p->deftext), size };
+    WBufAppendBytes(&p->defs, &def, sizeof(def));
+    WBufAppendBytes(&p->deftext, text, size);
+  }
+}
+
+
+// parses the link reference definitions seen so far followed by the pending
+// source from srcbeg to srcend
+static int render(StreamDoc* d, StreamParse* p, u32 srcbeg, u32 srcend) {
+  WBufReset(&d->tmpsrc);
+  if (WBufLen(&d->reftext) > 0)
+    WBufAppendBytes(&d->tmpsrc, d->reftext.start, WBufLen(&d->reftext));
+  if (srcend > srcbeg)
+    WBufAppendBytes(&d->tmpsrc, d->pending.start + srcbeg, srcend - srcbeg);
+  WBufReset(&d->tmphtml);
+  WBufReset(&d->tmpblocks);
+  WBufReset(&p->defs);
+  WBufReset(&p->deftext);
+  p->srcbeg = (u32)WBufLen(&d->reftext);
+
+  FmtHTML fmt = {
+    .flags = d->flags,
+    .parserFlags = d->parserFlags,
+    .outbuf = &d->tmphtml,
+    .mdctx = d->mdctx,
+    .onTopBlock = on_top_block,
+    .onRefDef = on_ref_def,
+    .userdata = p,
+    .countBrackets = true,
+  };
+  return fmt_html(d->tmpsrc.start, WBufLen(&d->tmpsrc), &fmt);
+}
+
+
+// true if the line before off is blank (or off is the start of the source)
+static bool follows_blank_line(const char* src, u32 off) {
+  if (off == 0)
+    return true;
+  const char* p = src + off - 1; // '\n' ending the previous line
+  while (p > src) {
+    char c = *--p;
+    if (c == '\n')
+      return true;
+    if (c != ' ' && c != '\t' && c != '\r')
+      return false;
+  }
+  return true;
+}
+
+
+// index of the last block at or before i which follows a blank line; 0 if none
+static u32 find_cut(const char* src, const StreamBlock* blocks, u32 i) {
+  while (i > 0 && !follows_blank_line(src, blocks[i].srcoff))
+    i--;
+  return i;
+}
+
+
+// Parses the pending source from srcbeg to srcend on its own and sets same to
+// whether its HTML is that from htmlbeg to htmlend in tmphtml, which is kept.
+static int render_same(
+  StreamDoc* d, u32 srcbeg, u32 srcend, u32 htmlbeg, u32 htmlend, bool* same)
+{
+  WBuf html = d->tmphtml;
+  d->tmphtml = (WBuf){0};
+  StreamParse p = { .doc = d };
+  int err = render(d, &p, srcbeg, srcend);
+  u32 beg = nblocks(&d->tmpblocks) > 0 ? blocksv(&d->tmpblocks)[0].htmloff : 0;
+  *same = !err &&
+    WBufLen(&d->tmphtml) - beg == htmlend - htmlbeg &&
+    memcmp(d->tmphtml.start + beg, html.start + htmlbeg, htmlend - htmlbeg) == 0;
+  WBufFree(&d->tmphtml);
+  WBufFree(&p.defs);
+  WBufFree(&p.deftext);
+  d->tmphtml = html;
+  return err;
+}
+
+
+static int output(StreamDoc* d, const char* data, size_t len) {
+  if (len == 0)
+    return 0;
+  return d->onOutput(data, len, d->userdata);
+}
+
+
+// Outputs the HTML of the complete blocks at the start of the pending source
+// and removes them from it.
+static int output_complete(StreamDoc* d, StreamParse* p) {
+  u32 pendinglen = (u32)WBufLen(&d->pending);
+  d->nextTry = max(pendinglen * 2, pendinglen + STREAM_MIN_GROWTH);
+
+  // only parse complete lines
+  u32 srclen = pendinglen;
+  while (srclen > 0 && d->pending.start[srclen - 1] != '\n')
+    srclen--;
+  if (srclen == 0)
+    return 0;
+
+  if (render(d, p, 0, srclen) != 0)
+    return -1;
+
+  // The last block may continue in the input to come. Before it, the blocks up
+  // to the last one which follows a blank line are complete.
+  StreamBlock* blocks = blocksv(&d->tmpblocks);
+  u32 n = nblocks(&d->tmpblocks);
+  if (n < 2)
+    return 0;
+  u32 k = find_cut(d->pending.start, blocks, n - 1);
+
+  // Text which may be a reference to a link reference definition still to come
+  // holds back everything from its block on.
+  for (u32 i = 0; i < k; i++) {
+    if (blocks[i + 1].brackets != blocks[i].brackets) {
+      k = find_cut(d->pending.start, blocks, i);
+      d->deferred = true;
+      break;
+    }
+  }
+  if (k == 0)
+    return 0;
+
+  u32 cut = blocks[k].srcoff;
+  u32 htmlbeg = blocks[0].htmloff;
+  u32 htmlend = blocks[k].htmloff;
+  u32 htmllen = (u32)WBufLen(&d->tmphtml);
+  bool same;
+
+  // Definitions in the incomplete blocks may still change. If any of them did
+  // make a difference to the complete blocks, they are references to
+  // definitions still to come.
+  const StreamRefDef* defs = (const StreamRefDef*)p->defs.start;
+  u32 ndefs = (u32)(WBufLen(&p->defs) / sizeof(StreamRefDef));
+  u32 ncomplete = 0;
+  while (ncomplete < ndefs && defs[ncomplete].srcoff < cut)
+    ncomplete++;
+  if (ncomplete < ndefs) {
+    if (render_same(d, 0, cut, htmlbeg, htmlend, &same) != 0)
+      return -1;
+    if (!same) {
+      d->deferred = true;
+      return 0;
+    }
+  }
+
+  // The blocks from the cut on are parsed on their own from now on, which they
+  // must survive: a block which follows a blank line may still depend on what
+  // comes before it, e.g. on a list which has just ended.
+  u32 reflen = (u32)WBufLen(&d->reftext);
+  for (u32 i = 0; i < ncomplete; i++) {
+    WBufAppendBytes(&d->reftext, p->deftext.start + defs[i].textoff, defs[i].textlen);
+    WBufAppendBytes(&d->reftext, "\n\n", 2);
+  }
+  int err = render_same(d, cut, srclen, htmlend, htmllen, &same);
+  if (err || !same) {
+    d->reftext.ptr = d->reftext.start + reflen;
+    return err;
+  }
+
+  if (output(d, d->tmphtml.start + htmlbeg, htmlend - htmlbeg) != 0)
+    return -1;
+
+  u32 rest = pendinglen - cut;
+  memmove(d->pending.start, d->pending.start + cut, rest);
+  d->pending.ptr = d->pending.start + rest;
+  d->nextTry = max(rest * 2, rest + STREAM_MIN_GROWTH);
+  return 0;
+}
+
+
+StreamDoc* StreamDocCreate(
+  u32 parserFlags,
+  OutputFlags flags,
+  int (*onOutput)(const char* data, size_t len, void* userdata),
+  void* userdata)
+{
+  StreamDoc* d = calloc(1, sizeof(StreamDoc));
+  if (!d)
+    return NULL;
+  d->parserFlags = parserFlags;
+  d->flags = flags;
+  d->onOutput = onOutput;
+  d->userdata = userdata;
+  d->nextTry = STREAM_MIN_GROWTH;
+  d->mdctx = md_ctx_create();
+  if (!d->mdctx) {
+    free(d);
+    return NULL;
+  }
+  return d;
+}
+
+
+void StreamDocFree(StreamDoc* d) {
+  md_ctx_destroy(d->mdctx);
+  WBufFree(&d->pending);
+  WBufFree(&d->reftext);
+  WBufFree(&d->tmpsrc);
+  WBufFree(&d->tmphtml);
+  WBufFree(&d->tmpblocks);
+  free(d);
+}
+
+
+int StreamDocWrite(StreamDoc* d, const char* src, u32 len) {
+  WBufAppendBytes(&d->pending, src, len);
+  if (d->deferred || WBufLen(&d->pending) < d->nextTry)
+    return 0;
+  StreamParse p = { .doc = d };
+  int err = output_complete(d, &p);
+  WBufFree(&p.defs);
+  WBufFree(&p.deftext);
+  return err;
+}
+
+
+int StreamDocEnd(StreamDoc* d) {
+  StreamParse p = { .doc = d };
+  int err = render(d, &p, 0, (u32)WBufLen(&d->pending));
+  WBufFree(&p.defs);
+  WBufFree(&p.deftext);
+  if (!err) {
+    u32 htmlbeg = nblocks(&d->tmpblocks) > 0 ? blocksv(&d->tmpblocks)[0].htmloff : 0;
+    err = output(d, d->tmphtml.start + htmlbeg, WBufLen(&d->tmphtml) - htmlbeg);
+  }
+  WBufReset(&d->pending);
+  WBufReset(&d->reftext);
+  d->nextTry = STREAM_MIN_GROWTH;
+  d->deferred = false;
+  return err;
+}
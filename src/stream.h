@@ -0,0 +1,51 @@
+#pragma once
+#include "md4c.h"
+
+// StreamDoc parses a document which is fed to it in chunks, for example as it
+// arrives over the network, without holding on to all of its source.
+//
+// HTML is produced for top-level blocks as soon as later input can no longer
+// affect them: a block is complete once the next top-level block, following a
+// blank line, has started, and the blocks from there on parse the same on
+// their own. Only the source of the blocks not yet complete and the text of
+// all link reference definitions seen so far are kept in memory.
+//
+// A link reference definition may also be used by links before it. A complete
+// block which contains text that may be such a reference (i.e. a "]" which did
+// not turn out to be a link) is held back along with everything after it until
+// the end of the document ("deferred" mode), so the output is always the same
+// as for parsing the whole document at once.
+typedef struct StreamDoc {
+  u32            parserFlags;
+  OutputFlags    flags;
+  MD_PARSER_CTX* mdctx;   // reused for every parse
+
+  // receives the HTML, in order
+  int (*onOutput)(const char* data, size_t len, void* userdata);
+  void* userdata;
+
+  WBuf pending; // source of the blocks not yet output
+  WBuf reftext; // text of all link reference definitions output so far,
+                // each one followed by "\n\n"
+  u32  nextTry; // length of pending at which to next try to output blocks
+  bool deferred;
+
+  // scratch space
+  WBuf tmpsrc;
+  WBuf tmphtml;
+  WBuf tmpblocks;
+} StreamDoc;
+
+StreamDoc* StreamDocCreate(
+  u32 parserFlags,
+  OutputFlags flags,
+  int (*onOutput)(const char* data, size_t len, void* userdata),
+  void* userdata);
+void StreamDocFree(StreamDoc*);
+
+// StreamDocWrite adds len bytes of source. Returns 0 on success.
+int StreamDocWrite(StreamDoc*, const char* src, u32 len);
+
+// StreamDocEnd outputs whatever is left at the end of the document. The
+// StreamDoc can then be used for a new document. Returns 0 on success.
+int StreamDocEnd(StreamDoc*);
@@ -10,8 +10,8 @@ void WBufFree(WBuf* b) {
   free(b->start);
 }
 
+// empties the buffer, keeping its capacity
 void WBufReset(WBuf* b) {
-  b->end = b->start;
   b->ptr = b->start;
 }
 
@@ -19,18 +19,15 @@ inline size_t WBufCap(WBuf* b) { return b->end - b->start; } // total capacity (
 inline size_t WBufLen(WBuf* b) { return b->ptr - b->start; } // valid bytes at start
 inline size_t WBufAvail(WBuf* b) { return b->end - b->ptr; } // bytes available
 
-// grows buffer so that there is at least minspace available space
+// grows buffer so that there is at least minspace available space.
+// The capacity at least doubles, so a buffer which has been reserved for an estimated
+// size grows geometrically from that size rather than from a power of two.
 static void WBufGrow(WBuf* b, size_t minspace) {
-  // size_t avail = b->end - b->ptr;
   size_t len = WBufLen(b); // store len before changing b
   size_t cap = WBufCap(b);
-  do {
-    if (cap == 0) {
-      cap = 512;
-    } else {
-      cap *= 2;
-    }
-  } while (cap - len < minspace);
+  cap = cap == 0 ? 512 : cap * 2;
+  if (cap - len < minspace)
+    cap = len + minspace;
   b->start = realloc(b->start, cap);
   b->end = b->start + cap;
   b->ptr = b->start + len;
@@ -71,7 +68,7 @@ void _WBufAppendHtml(WBuf* b, const char* pch, bool isattr) {
   while (*pch) {
     u32 slen = 0;
     const char* s = NULL;
-    #define S(cstr) s = cstr; slen = strlen(cstr); break;
+    #define S(cstr) { s = cstr; slen = strlen(cstr); break; }
     switch (*pch) {
       case '&': S("&amp;")
       case '<': S("&lt;")
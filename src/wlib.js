@@ -350,9 +350,14 @@ export const utf8 = typeof TextEncoder != 'undefined' ? (() => {
   // Modern browsers
   const enc = new TextEncoder("utf-8")
   const dec = new TextDecoder("utf-8")
+  // TextDecoder does not accept views of shared memory (i.e. the heap of a
+  // threaded build), so those are copied first
+  const isShared = typeof SharedArrayBuffer != 'undefined' ?
+    b => b.buffer instanceof SharedArrayBuffer :
+    b => false
   return {
     encode: s => enc.encode(s),
-    decode: b => dec.decode(b),
+    decode: b => dec.decode(isShared(b) ? b.slice() : b),
   };
 })() : typeof Buffer != 'undefined' ? {
   // Nodejs
@@ -0,0 +1,232 @@
+// The "binary" format: walking the tree with an ASTReader must give the same tree as the
+// "json" format of parse()
+const { md, checkEqual, random, randomSource, decodeEntity, log, exit } = require("./testutil")
+const { ASTKind, BlockType, SpanType, TextType, AttrType, ASTFlags } = md
+
+const enc = new TextEncoder()
+const dec = new TextDecoder()
+
+const blockNames = ["doc", "quote", "ul", "ol", "li", "hr", "h", "code", "html", "p",
+  "table", "thead", "tbody", "tr", "th", "td"]
+const spanNames = ["em", "strong", "a", "img", "code", "del", "math", "math", "wikilink", "u"]
+const alignNames = [undefined, "left", "center", "right"]
+
+
+// toJSON returns node i of the reader as the "json" format has it. Attributes are in the
+// same order, so that the trees can be compared as JSON text.
+function toJSON(r, i) {
+  const names = r.kind(i) == ASTKind.BLOCK ? blockNames : spanNames
+  const node = { _: names[r.type(i)] }
+  // the entities in attributes are decoded in the "json" format
+  const attr = type => {
+    const j = r.attr(i, type)
+    if (j != -1)
+      return r.text(j).replace(/&(#[0-9]+|#[xX][0-9a-fA-F]+|[a-zA-Z0-9]+);/g, decodeEntity)
+  }
+  const set = (key, value) => {
+    if (value !== undefined)
+      node[key] = value
+  }
+
+  if (r.kind(i) == ASTKind.BLOCK) {
+    switch (r.type(i)) {
+      case BlockType.UL:
+        set("tight", (r.flags(i) & ASTFlags.TIGHT) ? true : undefined)
+        break
+      case BlockType.OL:
+        set("start", r.a(i) != 1 ? r.a(i) : undefined)
+        set("tight", (r.flags(i) & ASTFlags.TIGHT) ? true : undefined)
+        set("delimiter", r.b(i) != 0x2E ? ")" : undefined)
+        break
+      case BlockType.LI:
+        if (r.flags(i) & ASTFlags.TASK)
+          set("checked", !!(r.flags(i) & ASTFlags.CHECKED))
+        break
+      case BlockType.HR:
+        return node
+      case BlockType.H:
+        set("level", r.a(i))
+        break
+      case BlockType.CODE:
+        set("lang", attr(AttrType.LANG))
+        set("info", attr(AttrType.INFO))
+        break
+      case BlockType.TH:
+      case BlockType.TD:
+        set("align", alignNames[r.a(i)])
+        break
+    }
+  } else {
+    switch (r.type(i)) {
+      case SpanType.A:
+        set("href", attr(AttrType.HREF))
+        set("title", attr(AttrType.TITLE))
+        break
+      case SpanType.IMG:
+        set("src", attr(AttrType.SRC))
+        set("title", attr(AttrType.TITLE))
+        break
+      case SpanType.WIKILINK:
+        set("target", attr(AttrType.TARGET))
+        break
+      case SpanType.LATEXMATH_DISPLAY:
+        set("display", true)
+        break
+    }
+  }
+
+  // runs of text are joined into one string, and runs of inline HTML into one node
+  const isInlineHTML = n => n && n._ == "html" && n.text !== undefined
+  const children = node.children = []
+  const add = child => {
+    const last = children[children.length - 1]
+    if (typeof child == "string" && typeof last == "string")
+      children[children.length - 1] += child
+    else if (isInlineHTML(child) && isInlineHTML(last))
+      last.text += child.text
+    else
+      children.push(child)
+  }
+  for (let j = i + 1; j < r.end(i); j = r.next(j)) {
+    switch (r.kind(j)) {
+      case ASTKind.ATTR:
+        break
+      case ASTKind.BLOCK:
+      case ASTKind.SPAN:
+        add(toJSON(r, j))
+        break
+      case ASTKind.TEXT:
+        switch (r.type(j)) {
+          case TextType.NULLCHAR: add("�"); break
+          case TextType.BR:       add({ _: "br" }); break
+          case TextType.SOFTBR:   add("\n"); break
+          case TextType.ENTITY:
+            // adjacent entities are in one record
+            for (const text of r.text(j).match(/&[^&;]*;/g)) {
+              const decoded = decodeEntity(text)
+              add(decoded != text ? decoded : { _: "entity", text })
+            }
+            break
+          case TextType.HTML:
+            add(node._ == "html" ? r.text(j) : { _: "html", text: r.text(j) })
+            break
+          default:
+            add(r.text(j))
+        }
+        break
+      default:
+        throw new Error(`unexpected record ${j} of kind ${r.kind(j)} in ${node._}`)
+    }
+  }
+  return node
+}
+
+
+// checkRecords returns a description of the first record which is inconsistent with the
+// others or with the source, or null if they are all fine
+function checkRecords(r, bytes) {
+  for (let i = 0; i < r.length; i++) {
+    const kind = r.kind(i)
+    if (kind == ASTKind.BLOCK || kind == ASTKind.SPAN) {
+      if (r.end(i) >= r.length || r.kind(r.end(i)) != ASTKind.END)
+        return `record ${i} ends at ${r.end(i)}, which is not an END record`
+      if (r.next(i) != r.end(i) + 1)
+        return `next(${i}) is ${r.next(i)}`
+    } else if (kind == ASTKind.TEXT || kind == ASTKind.ATTR) {
+      const off = r.offset(i)
+      const text = r.text(i)
+      if (dec.decode(r.textBytes(i)) != text)
+        return `text and textBytes of record ${i} differ`
+      if (off != -1 && dec.decode(bytes.subarray(off, off + r.b(i))) != text)
+        return `text of record ${i} is not at offset ${off} in the source`
+    } else if (kind != ASTKind.END) {
+      return `record ${i} is of kind ${kind}`
+    }
+  }
+  return r.next(0) == r.length ? null : `the document ends at ${r.end(0)} of ${r.length}`
+}
+
+
+// checkAST compares the tree of the reader with that of the "json" format, for source as
+// a string and as UTF-8 data
+function checkAST(name, source) {
+  const expected = JSON.stringify(md.parse(source, { format: "json" }))
+  const bytes = enc.encode(source)
+  for (const input of [source, bytes]) {
+    const what = typeof input == "string" ? "string" : "UTF-8"
+    const r = md.parse(input, { format: "binary" })
+    const err = checkRecords(r, bytes)
+    if (err)
+      return checkEqual(`${name} (${what}, records)`, err, "")
+    if (!checkEqual(`${name} (${what})`, JSON.stringify(toJSON(r, 0)), expected))
+      return false
+  }
+  return true
+}
+
+
+checkAST("entities", "&amp; &lt; &#35; &#x1F600; &#0; &copy;\n\n[&copy;](/a?b&amp;c 't&quot;')\n")
+checkAST("lists", "- a\n- `b`\n\n      code\n- [x] c\n- [ ] d\n\n3) e\n\n   f\n")
+checkAST("html", "<div>\n*a*\n</div>\n\nb <span>c</span><!-- d -->\n")
+checkAST("table", "| a | b | c |\n|:--|:-:|--:|\n| `d` | *e* | f |\n")
+checkAST("escapes", "\\* [a\\*](/b\\* \"c\\*\")\n\n``` js\\* e\nx\n```\n<http://a.b> www.c.d\n")
+
+{
+  const source = "# Title\n\nSome *emphasis*,  \na [link](/u) and `code`.\n"
+  const r = md.parse(source, { format: "binary" })
+  checkEqual("textContent", r.textContent(0), "TitleSome emphasis,\na link and code.")
+}
+
+// Text and attributes are read from the caller's source where its offsets are those of
+// the UTF-8 source: an ASCII string or a Uint8Array, but not any other string. Pooled
+// attributes, which differ from the source, are always read from the pool.
+{
+  // texts lists [text, offset] of the text and attribute records
+  const texts = r => {
+    const a = []
+    for (let i = 0; i < r.length; i++) {
+      if (r.kind(i) == ASTKind.TEXT || r.kind(i) == ASTKind.ATTR)
+        a.push([r.text(i), r.offset(i)])
+    }
+    return JSON.stringify(a)
+  }
+
+  const ascii = "a *b* [c](/d)\n"
+  let r = md.parse(ascii, { format: "binary" })
+  checkEqual("ASCII string (source)", String(r.srcString === ascii), "true")
+  checkEqual("ASCII string", texts(r), '[["a ",0],["b",3],[" ",5],["/d",10],["c",7]]')
+
+  const nonASCII = "é *ü* [ç](/ß)\n"
+  r = md.parse(nonASCII, { format: "binary" })
+  checkEqual("non-ASCII string (source)", String(r.srcString), "null")
+  checkEqual("non-ASCII string", texts(r), '[["é ",0],["ü",4],[" ",7],["/ß",13],["ç",9]]')
+
+  const bytes = enc.encode(nonASCII)
+  r = md.parse(bytes, { format: "binary" })
+  checkEqual("Uint8Array (source)", String(r.srcBytes === bytes), "true")
+  checkEqual("Uint8Array", texts(r), '[["é ",0],["ü",4],[" ",7],["/ß",13],["ç",9]]')
+  let j = 0
+  while (r.kind(j) != ASTKind.ATTR)
+    j++
+  checkEqual("Uint8Array (textBytes)", String(r.textBytes(j).buffer === bytes.buffer), "true")
+
+  for (const source of ["[a](/b\\*c)\n", enc.encode("[a](/b\\*c)\n")]) {
+    const what = typeof source == "string" ? "string" : "UTF-8"
+    r = md.parse(source, { format: "binary" })
+    checkEqual(`pooled attribute (${what})`, texts(r), '[["/b*c",-1],["a",1]]')
+  }
+}
+
+{
+  const rand = random(13)
+  let ndocs = 0
+  for (let i = 0; i < 300; i++) {
+    if (!checkAST(`random document ${i}`, randomSource(rand, 10 + rand(60))))
+      break
+    ndocs++
+  }
+  if (ndocs == 300)
+    log("random documents OK")
+}
+
+exit()
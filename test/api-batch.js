@@ -0,0 +1,48 @@
+// parseBatch: the HTML of each document must be that of parse() of the document alone
+const { md, checkEqual, random, randomSource, log, exit } = require("./testutil")
+
+
+function checkBatch(name, sources, options) {
+  const results = md.parseBatch(sources, options)
+  let ok = checkEqual(`${name} (count)`, String(results.length), String(sources.length))
+  for (let i = 0; ok && i < sources.length; i++)
+    ok = checkEqual(`${name} (document ${i})`, results[i], md.parse(sources[i], options))
+  return ok
+}
+
+
+// The documents are packed back to back, so each one is followed by the next
+checkBatch("link closed by the next document", ["see [a](http://x.y", ") and more"])
+checkBatch("script block ended by the next document", ["<script>\nx </scr", "ipt>\n"])
+
+// Random batches
+{
+  const rand = random(19)
+  let nbatches = 0
+  for (let i = 0; i < 100; i++) {
+    const sources = Array.from({ length: 1 + rand(8) }, () => randomSource(rand, rand(30)))
+    const options = i % 2 ? { xhtml: true } : undefined
+    if (!checkBatch(`random batch ${i}`, sources, options))
+      break
+    nbatches++
+  }
+  if (nbatches == 100)
+    log("random batches OK")
+}
+
+// Invalid options are rejected before any memory is allocated for the batch
+{
+  const refDefs = new md.RefDefs("[a]: /a\n")
+  refDefs.dispose()
+  const heapUsed = md.memoryUsage().heapUsed
+  let err = null
+  try {
+    md.parseBatch(["[a]\n", "b\n"], { refDefs })
+  } catch (e) {
+    err = e
+  }
+  checkEqual("disposed RefDefs", String(err), "Error: RefDefs has been disposed")
+  checkEqual("disposed RefDefs (heap)", String(md.memoryUsage().heapUsed), String(heapUsed))
+}
+
+exit()
@@ -0,0 +1,108 @@
+// ChunkedParser, parseChunked and parseStream: however the input and output are split,
+// the HTML must be that of parse()
+const { md, checkEqual, random, randomSource, log, exit } = require("./testutil")
+
+const enc = new TextEncoder()
+const dec = new TextDecoder()
+
+
+// concat joins the Uint8Array chunks of HTML into a string
+function concat(chunks) {
+  const buf = new Uint8Array(chunks.reduce((n, c) => n + c.length, 0))
+  let off = 0
+  for (const c of chunks) {
+    buf.set(c, off)
+    off += c.length
+  }
+  return dec.decode(buf)
+}
+
+
+// checkChunks writes source to a ChunkedParser, split at the offsets in cuts
+function checkChunks(name, source, cuts, options) {
+  const chunks = []
+  const p = new md.ChunkedParser(chunk => chunks.push(chunk.slice()), options)
+  let prev = 0
+  for (const cut of cuts.concat([source.length])) {
+    p.write(source.subarray ? source.subarray(prev, cut) : source.substring(prev, cut))
+    prev = cut
+  }
+  p.end()
+  p.dispose()
+  return checkEqual(name, concat(chunks), md.parse(source, options))
+}
+
+
+// Parts of the document are output before the end only once it is longer than 16 kB
+const padding = Array.from({ length: 1500 }, (_, i) => `paragraph ${i}\n\n`).join("")
+
+
+// The block after a list and a blank line, which is cut off by the first write, depends
+// on the list: the tab of "  \tcode" makes it an indented code block on its own.
+{
+  const source = padding + "*\n\n  \tcode\n\nafter\n"
+  checkChunks("block depending on the preceding list", source, [source.indexOf("after")])
+}
+
+// The rest of the document is parsed at the end in a buffer which held the whole of
+// what was written first, here with a ")" right after "[a](u".
+{
+  const parens = Array.from({ length: 1500 }, (_, i) => `(${String(i).padStart(8, "0")})\n\n`)
+  const source = parens.join("") + "zz)\n[a](u"
+  checkChunks("link closed by a stale ')'", source, [source.length - 5])
+}
+
+// Random documents in random chunks, as strings and as UTF-8 data
+{
+  const rand = random(7)
+  let ndocs = 0
+  for (let i = 0; i < 100; i++) {
+    const source = padding.substr(0, rand(padding.length)) + randomSource(rand, 10 + rand(80))
+    const input = i % 3 == 2 ? enc.encode(source) : source
+    const cuts = []
+    for (let n = rand(20), prev = 0; n > 0; n--) {
+      prev += rand(input.length - prev + 1)
+      cuts.push(prev)
+    }
+    const options = i % 2 ? { xhtml: true } : undefined
+    if (!checkChunks(`random document ${i}`, input, cuts, options))
+      break
+    ndocs++
+  }
+  if (ndocs == 100)
+    log("random chunks OK")
+}
+
+// parseChunked, with output chunks of various sizes
+{
+  const rand = random(8)
+  const source = padding + randomSource(rand, 200)
+  const expected = md.parse(source)
+  for (const chunkSize of [1, 100, 4096]) {
+    const chunks = []
+    md.parseChunked(source, chunk => chunks.push(chunk.slice()), { chunkSize })
+    checkEqual(`parseChunked chunkSize=${chunkSize}`, concat(chunks), expected)
+  }
+}
+
+// parseStream, as strings and as UTF-8 data
+async function checkStream(name, source, options) {
+  const chunks = []
+  const reader = md.parseStream(source, options).getReader()
+  for (;;) {
+    const { value, done } = await reader.read()
+    if (done)
+      break
+    chunks.push(value)
+  }
+  return checkEqual(name, concat(chunks), md.parse(source, options))
+}
+
+;(async () => {
+  const rand = random(9)
+  const source = padding + "😀 " + randomSource(rand, 200) + padding
+  await checkStream("parseStream", source)
+  await checkStream("parseStream chunkSize=1001", source, { chunkSize: 1001 })
+  await checkStream("parseStream UTF-8", enc.encode(source), { chunkSize: 1001 })
+  exit()
+})()
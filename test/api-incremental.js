@@ -0,0 +1,85 @@
+// IncrementalParser: after any edit, the HTML must be that of parse() of the edited source
+const { md, checkEqual, random, randomSource, log, exit } = require("./testutil")
+
+
+// checkEdits parses source with an IncrementalParser, applies the edits
+// ([offset, deleteCount, text]) one by one and compares each result with parse()
+function checkEdits(name, source, edits, options) {
+  const p = new md.IncrementalParser(options)
+  let ok = checkEqual(`${name} (initial)`, p.parse(source), md.parse(source, options))
+  for (let i = 0; ok && i < edits.length; i++) {
+    const [offset, deleteCount, text] = edits[i]
+    source = source.substr(0, offset) + text + source.substr(offset + deleteCount)
+    ok = checkEqual(`${name} (edit ${i})`, p.edit(offset, deleteCount, text), md.parse(source, options))
+  }
+  p.dispose()
+  return ok
+}
+
+
+// The block before the edited one is re-parsed without what precedes it, where the tab
+// of "  \tcode" makes it an indented code block rather than a paragraph.
+{
+  const source = "para\n\n*\n\n  \tcode\n\nafter\n\nend\n"
+  const off = source.indexOf("after") + 2
+  checkEdits("block depending on the preceding list", source, [[off, 0, "x"], [off, 1, ""]])
+}
+
+// The link reference definitions of the rest of the document must not become part of
+// an unclosed fenced code block at the end of the re-parsed blocks.
+{
+  const source = "[x]: /u\n\na\n\nbb [x]\n\n- ```\n"
+  const off = source.indexOf("bb") + 1
+  checkEdits("unclosed fence at the end", source, [[off, 0, "x"], [source.length, 0, "c"]])
+}
+
+// Deleting the final ")" of a link leaves it in the source buffer after the document,
+// where it must not close the link
+{
+  const source = "x\n\n[a](u)"
+  checkEdits("backspace at the end", source, [[source.length - 1, 1, ""]])
+}
+
+// Edits which add, change and remove link reference definitions
+checkEdits("ref. defs.", "[a] [b]\n\ntext\n\n[a]: /a\n", [
+  [0, 0, "[b]: /b\n\n"],     // add one before
+  [5, 2, "/B"],              // change it
+  [0, 9, ""],                // remove it
+  [9, 4, "[b]: /b"],         // turn a paragraph into one
+])
+
+// Random edits of random documents, as strings and as UTF-8 data
+{
+  const rand = random(5)
+  let ndocs = 0
+  for (let i = 0; i < 300; i++) {
+    let source = randomSource(rand, 10 + rand(60))
+    const edits = []
+    let len = source.length
+    for (let j = 0; j < 8; j++) {
+      const offset = rand(len + 1)
+      const deleteCount = rand(3) == 0 ? rand(Math.min(len - offset, 12) + 1) : 0
+      const text = randomSource(rand, rand(3))
+      edits.push([offset, deleteCount, text])
+      len += text.length - deleteCount
+    }
+    const options = i % 2 ? { xhtml: true } : undefined
+    if (!checkEdits(`random document ${i}`, source, edits, options))
+      break
+    ndocs++
+  }
+  if (ndocs == 300)
+    log("random edits OK")
+
+  // UTF-8 data: offsets are in bytes
+  const enc = new TextEncoder()
+  const source = "日本語 *é*\n\n> para\n\nend\n"
+  const bytes = enc.encode(source)
+  const p = new md.IncrementalParser()
+  p.parse(bytes)
+  const off = enc.encode("日本語 *é*\n\n> pa").length
+  checkEqual("UTF-8 edit", p.edit(off, 0, enc.encode("ř")), md.parse(source.replace("> pa", "> pař")))
+  p.dispose()
+}
+
+exit()
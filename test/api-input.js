@@ -0,0 +1,22 @@
+// parse() copies its source into an input buffer which it keeps for the next call. The
+// bytes of a longer earlier source, which are left after the current one, must not be
+// taken as part of it.
+const { md, checkEqual, exit } = require("./testutil")
+
+const dest = "/" + "u".repeat(1000)
+
+// checkAfterLonger parses source after a source which continues it with rest
+function checkAfterLonger(name, source, rest, expected) {
+  md.parse(source + rest)
+  checkEqual(name, md.parse(source), expected)
+  md.parse(source + rest)
+  checkEqual(`${name} (UTF-8)`, md.parse(new TextEncoder().encode(source)), expected)
+}
+
+checkAfterLonger("link without ')'", `[a](${dest}`, ")", `<p>[a](${dest}</p>\n`)
+checkAfterLonger("link with title without ')'", `[a](${dest} 't'`, ")",
+  `<p>[a](${dest} 't'</p>\n`)
+checkAfterLonger("script block without end tag", "<script>\nx </scr", "ipt>\n\n*a*\n",
+  "<script>\nx </scr\n")
+
+exit()
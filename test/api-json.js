@@ -0,0 +1,101 @@
+// The "json" format: the tree must be valid JSON and describe the same document as the
+// HTML of parse()
+const { md, checkEqual, random, randomSource, htmlOutline, log, exit } = require("./testutil")
+
+// inline HTML and HTML blocks would add elements to the HTML which are text in the tree
+const parseFlags = md.ParseFlags.DEFAULT | md.ParseFlags.NO_HTML
+
+const nodeTypes = [
+  "doc", "quote", "ul", "ol", "li", "hr", "h", "code", "html", "p", "table", "thead",
+  "tbody", "tr", "th", "td", "em", "strong", "u", "del", "a", "img", "wikilink", "math",
+  "br", "entity",
+]
+// blocks which only contain blocks
+const containers = ["doc", "quote", "ul", "ol", "table", "thead", "tbody", "tr"]
+
+
+// checkStructure returns a description of the first thing in the tree which is not as
+// described by ASTNode in markdown.d.ts, or null if there is nothing wrong with it
+function checkStructure(node) {
+  if (!nodeTypes.includes(node._))
+    return `unexpected node ${JSON.stringify(node._)}`
+  const leaf = ["hr", "br", "entity"].includes(node._) || (node._ == "html" && node.text)
+  if (leaf)
+    return node.children ? `${node._} with children` : null
+  if (!Array.isArray(node.children))
+    return `${node._} without children`
+  for (const child of node.children) {
+    const err = typeof child == "string" ?
+      (containers.includes(node._) ? `text in ${node._}` : null) :
+      checkStructure(child)
+    if (err)
+      return err
+  }
+  return null
+}
+
+
+// isCodeBlock tells a code block in a list item of a tight list, where text may be
+// too, from a code span: the lines of a code block end in newlines
+function isCodeBlock(node) {
+  const last = node.children[node.children.length - 1]
+  return node.lang !== undefined || node.info !== undefined || !last || last.endsWith("\n")
+}
+
+
+// treeOutline is the htmlOutline of the HTML which the tree stands for
+function treeOutline(node, parent) {
+  if (typeof node == "string")
+    return node.replace(/\s+/g, "")
+  let s = `⟨${node._}⟩`
+  switch (node._) {
+    case "doc":    s = ""; break
+    case "quote":  s = "⟨blockquote⟩"; break
+    case "h":      s = `⟨h${node.level}⟩`; break
+    case "strong": s = "⟨b⟩"; break
+    case "math":   s = "⟨x-equation⟩"; break
+    case "wikilink": s = "⟨x-wikilink⟩"; break
+    case "entity": return node.text
+    case "img":    return s  // the alt text is an attribute
+    case "li":     s = node.checked === undefined ? s : "⟨li⟩⟨input⟩"; break
+    case "code":
+      if ((parent == "li" && isCodeBlock(node)) || containers.includes(parent))
+        s = "⟨pre⟩⟨code⟩"
+      break
+  }
+  for (const child of node.children || [])
+    s += treeOutline(child, node._)
+  return s
+}
+
+
+function checkJSON(name, source) {
+  const tree = md.parse(source, { format: "json", parseFlags })
+  const text = Buffer.from(md.parse(source, { format: "json", parseFlags, bytes: true }))
+  const err = checkStructure(tree)
+  if (err)
+    return checkEqual(`${name} (structure)`, err, "")
+  return (
+    checkEqual(`${name} (JSON.parse)`, JSON.stringify(JSON.parse(text)), JSON.stringify(tree)) &&
+    checkEqual(`${name} (outline)`, treeOutline(tree, ""),
+      htmlOutline(md.parse(source, { parseFlags })))
+  )
+}
+
+
+checkJSON("entities", "&amp; &lt; &#35; &#x1F600; &#0; &copy; \\&amp;\n\n[&copy;](/a?b&amp;c)\n")
+checkJSON("lists", "- a\n- `b`\n\n      code\n- [x] c\n\n1. d\n\n   e\n")
+
+{
+  const rand = random(11)
+  let ndocs = 0
+  for (let i = 0; i < 300; i++) {
+    if (!checkJSON(`random document ${i}`, randomSource(rand, 10 + rand(60))))
+      break
+    ndocs++
+  }
+  if (ndocs == 300)
+    log("random documents OK")
+}
+
+exit()
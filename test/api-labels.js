@@ -0,0 +1,20 @@
+// Link labels match their reference definition regardless of case and whitespace
+const { checkHTMLResult, exit } = require("./testutil")
+
+// trailing whitespace
+checkHTMLResult("trailing space", "[a ]: /u\n\n[a ]\n", '<p><a href="/u">a </a></p>\n')
+checkHTMLResult("trailing space in link", "[a]: /u\n\n[a ]\n", '<p><a href="/u">a </a></p>\n')
+checkHTMLResult("trailing newline", "[a]: /u\n\n[a\n]\n", '<p><a href="/u">a\n</a></p>\n')
+checkHTMLResult("trailing em space", "[a]: /u\n\n[a ]\n", '<p><a href="/u">a </a></p>\n')
+checkHTMLResult("trailing space after a long label",
+  "[abcdefghijklmnop  ]: /u\n\n[ABCDEFGHIJKLMNOP]\n",
+  '<p><a href="/u">ABCDEFGHIJKLMNOP</a></p>\n')
+
+// case folding and runs of whitespace
+checkHTMLResult("case and inner whitespace",
+  "[Foo \t Bar]: /u\n\n[foo bar] [FOO\nBAR]\n",
+  '<p><a href="/u">foo bar</a> <a href="/u">FOO\nBAR</a></p>\n')
+checkHTMLResult("unicode case folding", "[ẞ]: /u\n\n[ss]\n", '<p><a href="/u">ss</a></p>\n')
+checkHTMLResult("whitespace is not ignored", "[a b]: /u\n\n[ab]\n", "<p>[ab]</p>\n")
+
+exit()
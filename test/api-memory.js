@@ -0,0 +1,58 @@
+// setMemoryPolicy, releaseMemory and memoryUsage: the internal input and output buffers
+// are freed as requested, and parsing works as before afterwards
+const { md, checkEqual, exit } = require("./testutil")
+
+const small = "paragraph *x*\n\n"
+const smallHTML = "<p>paragraph <em>x</em></p>\n"
+const big = small.repeat(20000)  // 300 kB
+const bigHTML = smallHTML.repeat(20000)
+
+// buffers returns the capacities of the input and output buffers
+function buffers() {
+  const m = md.memoryUsage()
+  return `input ${m.inputBuffer}, output ${m.outputBuffer}`
+}
+
+
+// Without a policy, the buffers keep the size of the largest document
+md.parse(big)
+checkEqual("no policy", String(md.memoryUsage().inputBuffer >= big.length &&
+  md.memoryUsage().outputBuffer >= bigHTML.length), "true")
+
+// Setting maxRetained frees the input buffer larger than it
+md.setMemoryPolicy({ maxRetained: 64 * 1024 })
+checkEqual("setMemoryPolicy", String(md.memoryUsage().inputBuffer), "0")
+
+// Both buffers are freed after a parse which made them larger than maxRetained
+checkEqual("large parse", md.parse(big), bigHTML)
+checkEqual("large parse (buffers)", buffers(), "input 0, output 0")
+checkEqual("large batch", md.parseBatch([big, small]).join(""), bigHTML + smallHTML)
+checkEqual("large batch (buffers)", buffers(), "input 0, output 0")
+
+// Smaller ones are kept
+checkEqual("small parse", md.parse(small), smallHTML)
+{
+  const m = md.memoryUsage()
+  checkEqual("small parse (buffers)", String(m.inputBuffer > 0 && m.outputBuffer > 0 &&
+    m.inputBuffer <= 64 * 1024 && m.outputBuffer <= 64 * 1024), "true")
+}
+
+// A result which refers to the buffers stays valid until the next call
+{
+  const r = md.parse(big, { format: "binary" })
+  checkEqual("large AST", r.textContent(0), "paragraph x".repeat(20000))
+  const html = md.parse(big, { bytes: true })
+  checkEqual("large bytes", new TextDecoder().decode(html), bigHTML)
+}
+
+// releaseMemory frees both buffers, after which parsing works as before
+md.setMemoryPolicy({})
+md.parse(big)
+md.releaseMemory()
+checkEqual("releaseMemory", buffers(), "input 0, output 0")
+checkEqual("parse after releaseMemory", md.parse(big), bigHTML)
+md.releaseMemory()
+checkEqual("parse UTF-8 after releaseMemory", md.parse(new TextEncoder().encode(small)),
+  smallHTML)
+
+exit()
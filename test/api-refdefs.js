@@ -0,0 +1,76 @@
+// RefDefs: shared link reference definitions resolve links as if they were appended to
+// the document
+const { md, checkEqual, random, randomSource, log, exit } = require("./testutil")
+
+
+// checkRefDefs parses source with the definitions in defs, and without them but with
+// defs appended to source instead
+function checkRefDefs(name, source, defs, options) {
+  const refDefs = new md.RefDefs(defs, options)
+  const ok = checkEqual(name,
+    md.parse(source, Object.assign({ refDefs }, options)),
+    md.parse(source + "\n\n" + defs, options))
+  refDefs.dispose()
+  return ok
+}
+
+
+checkRefDefs("fallback", "[a] [b] [c]\n", "[a]: /a\n[b]: /b 'B'\n")
+checkRefDefs("labels are matched like in the document", "[Foo  BAR] [ẞ]\n",
+  "[foo bar]: /f\n[ss]: /s\n")
+checkRefDefs("the document's definitions take precedence", "[a] [b]\n\n[a]: /doc\n",
+  "[a]: /shared\n[b]: /b\n")
+checkRefDefs("the first definition wins", "[a]\n", "[a]: /1\n[A]: /2\n\n[a]: /3\n")
+checkRefDefs("images and collapsed references", "![a] [b][] [c][a]\n", "[a]: /a\n[b]: /b\n")
+
+// Anything other than definitions in their source is ignored, and the definitions apply
+// to the other formats as well
+{
+  const shared = new md.RefDefs("# h\n\n[a]: /a\n\npara [b]\n\n[b]: /b\n")
+  checkEqual("other text is ignored", md.parse("[a] [b]\n", { refDefs: shared }),
+    '<p><a href="/a">a</a> <a href="/b">b</a></p>\n')
+  shared.dispose()
+
+  const refDefs = new md.RefDefs("[a]: /a\n")
+  checkEqual("json",
+    JSON.stringify(md.parse("[a]\n", { format: "json", refDefs })),
+    JSON.stringify(md.parse("[a]\n\n[a]: /a\n", { format: "json" })))
+  const r = md.parse("[a]\n", { format: "binary", refDefs })
+  let href = "no link"
+  for (let i = 0; i < r.length; i++) {
+    if (r.kind(i) == md.ASTKind.SPAN && r.type(i) == md.SpanType.A)
+      href = r.text(r.attr(i, md.AttrType.HREF))
+  }
+  checkEqual("binary", href, "/a")
+  refDefs.dispose()
+
+  let err = null
+  try {
+    md.parse("[a]\n", { refDefs })
+  } catch (e) {
+    err = e
+  }
+  checkEqual("parse with disposed RefDefs", String(err), "Error: RefDefs has been disposed")
+}
+
+// Random documents and definitions. Fenced code blocks are left out, since when one is
+// not closed, it would contain the appended definitions.
+{
+  const rand = random(17)
+  const labels = ["x", "X", "y", "link", "img", "h", "c", "em"]
+  let ndocs = 0
+  for (let i = 0; i < 300; i++) {
+    const source = randomSource(rand, 10 + rand(60)).replace(/```|~~~/g, "")
+    let defs = ""
+    for (let n = rand(6); n >= 0; n--)
+      defs += `[${labels[rand(labels.length)]}]: /shared${n}${rand(2) ? " 'T'" : ""}\n`
+    const options = i % 2 ? { parseFlags: md.ParseFlags.DEFAULT | md.ParseFlags.NO_HTML } : {}
+    if (!checkRefDefs(`random document ${i}`, source, defs, options))
+      break
+    ndocs++
+  }
+  if (ndocs == 300)
+    log("random documents OK")
+}
+
+exit()
@@ -0,0 +1,351 @@
+// Native benchmark of parsing and rendering, free of the cost of the JavaScript
+// bridge which bench.js includes. Built and run over ./samples by `make bench`
+// in the root of the repository.
+//
+// For each file, reports throughput, the median and 99th percentile time of one
+// parse-and-render (as done by parseUTF8 in md.c), heap allocations per parse,
+// the capacity of the output buffer relative to the size of the output and the
+// time spent per byte in each phase:
+//
+//   analyze  block structure analysis (md_analyze_line & co, see MD_STATS)
+//   inlines  inline processing, measured with callbacks which do nothing
+//   render   the rest of the time of processing with fmt_html
+//
+// Each parse renders into a new output buffer, like the first call to parseUTF8,
+// so reallocs and outcap show how well fmt_html_outsize predicts the output size.
+//
+// md4c is built with MD4C_STATS for this; the throughput and latency runs do not
+// set MD_PARSER::stats so they are (but for a branch per parse) not affected.
+#include "common.h"
+#include "fmt_html.h"
+#include <stdio.h>
+#include <errno.h>
+#include <time.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#define DEFAULT_PARSE_FLAGS ( \
+  MD_FLAG_COLLAPSEWHITESPACE | \
+  MD_FLAG_PERMISSIVEATXHEADERS | \
+  MD_FLAG_PERMISSIVEURLAUTOLINKS | \
+  MD_FLAG_STRIKETHROUGH | \
+  MD_FLAG_TABLES | \
+  MD_FLAG_TASKLISTS )
+
+#define MIN_ITERATIONS 10
+
+// allocation counting; the Makefile links with -Wl,--wrap for malloc & co.
+// where supported and defines BENCH_NO_ALLOC_COUNT otherwise.
+static size_t nallocs = 0;   // malloc, calloc and realloc(NULL, ...)
+static size_t nreallocs = 0; // realloc of an existing block
+
+#ifndef BENCH_NO_ALLOC_COUNT
+void* __real_malloc(size_t);
+void* __real_calloc(size_t, size_t);
+void* __real_realloc(void*, size_t);
+
+void* __wrap_malloc(size_t size) {
+  nallocs++;
+  return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+  nallocs++;
+  return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+  if (ptr) {
+    nreallocs++;
+  } else {
+    nallocs++;
+  }
+  return __real_realloc(ptr, size);
+}
+#endif
+
+
+typedef struct Result {
+  const char* name;
+  size_t size;
+  u32    iterations;
+  double mean_ns;
+  double p50_ns;
+  double p99_ns;
+  double allocs;    // per parse
+  double reallocs;  // per parse
+  size_t outlen;    // size of the output
+  size_t outcap;    // capacity of the output buffer
+  double analyze_ns;
+  double inlines_ns;
+  double render_ns;
+} Result;
+
+
+static u32 parserFlags = DEFAULT_PARSE_FLAGS;
+static double budget = 0.5; // seconds of measurement per file
+
+
+static uint64_t now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+
+static int cmp_u64(const void* a, const void* b) {
+  uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+  return x < y ? -1 : x > y;
+}
+
+
+static int nop_block(MD_BLOCKTYPE type, void* detail, void* userdata) { return 0; }
+static int nop_span(MD_SPANTYPE type, void* detail, void* userdata) { return 0; }
+static int nop_text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata) {
+  return 0;
+}
+
+
+// parse and render the way parseUTF8 in md.c does
+static int render(const char* src, size_t len, WBuf* outbuf, MD_PARSER_CTX* mdctx, MD_STATS* stats) {
+  WBufFree(outbuf);
+  WBufInit(outbuf);
+  WBufReserve(outbuf, fmt_html_outsize(src, len));
+  FmtHTML fmt = {
+    .flags = OutputFlagHTML,
+    .parserFlags = parserFlags,
+    .outbuf = outbuf,
+    .mdctx = mdctx,
+    .stats = stats,
+  };
+  return fmt_html(src, (u32)len, &fmt);
+}
+
+
+static int bench(Result* r, const char* src, size_t len) {
+  WBuf outbuf = {0};
+  MD_PARSER_CTX* mdctx = md_ctx_create();
+  uint64_t* times = NULL;
+  u32 cap = 0;
+  u32 n = 0;
+
+  // warm up caches and the buffers retained by outbuf and mdctx
+  if (render(src, len, &outbuf, mdctx, NULL) != 0) {
+    md_ctx_destroy(mdctx);
+    WBufFree(&outbuf);
+    return -1;
+  }
+
+  uint64_t allocs = 0, reallocs = 0;
+  uint64_t budget_ns = (uint64_t)(budget * 1e9);
+  uint64_t total_ns = 0;
+  while (n < MIN_ITERATIONS || total_ns < budget_ns) {
+    if (n == cap) {
+      cap = cap ? cap * 2 : 1024;
+      times = realloc(times, cap * sizeof(uint64_t));
+    }
+    size_t a0 = nallocs, r0 = nreallocs;
+    uint64_t t0 = now_ns();
+    render(src, len, &outbuf, mdctx, NULL);
+    uint64_t t = now_ns() - t0;
+    allocs += nallocs - a0;
+    reallocs += nreallocs - r0;
+    times[n++] = t;
+    total_ns += t;
+  }
+  qsort(times, n, sizeof(uint64_t), cmp_u64);
+
+  r->size = len;
+  r->iterations = n;
+  r->mean_ns = (double)total_ns / n;
+  r->p50_ns = times[n / 2];
+  r->p99_ns = times[(u32)((n - 1) * 0.99)];
+  r->allocs = (double)allocs / n;
+  r->reallocs = (double)reallocs / n;
+  r->outlen = WBufLen(&outbuf);
+  r->outcap = WBufCap(&outbuf);
+
+  // phases
+  u32 nphase = max(n / 2, (u32)MIN_ITERATIONS);
+  MD_STATS html = {0};
+  for (u32 i = 0; i < nphase; i++)
+    render(src, len, &outbuf, mdctx, &html);
+
+  MD_STATS nop = {0};
+  MD_PARSER parser = {
+    .flags = parserFlags,
+    .enter_block = nop_block,
+    .leave_block = nop_block,
+    .enter_span = nop_span,
+    .leave_span = nop_span,
+    .text = nop_text,
+    .stats = &nop,
+  };
+  for (u32 i = 0; i < nphase; i++)
+    md_ctx_parse(mdctx, src, (MD_SIZE)len, &parser, NULL);
+
+  double analyze_ns = (double)(html.analyze_ns + nop.analyze_ns) / (2 * nphase);
+  double inlines_ns = (double)nop.process_ns / nphase;
+  double process_ns = (double)html.process_ns / nphase;
+  r->analyze_ns = analyze_ns;
+  r->inlines_ns = inlines_ns;
+  r->render_ns = process_ns > inlines_ns ? process_ns - inlines_ns : 0;
+
+  free(times);
+  md_ctx_destroy(mdctx);
+  WBufFree(&outbuf);
+  return 0;
+}
+
+
+static int read_file(const char* filename, WBuf* buf) {
+  FILE* f = fopen(filename, "rb");
+  if (!f)
+    return -1;
+  WBufReset(buf);
+  for (;;) {
+    WBufReserve(buf, 64 * 1024);
+    size_t n = fread(buf->ptr, 1, WBufAvail(buf), f);
+    buf->ptr += n;
+    if (n == 0)
+      break;
+  }
+  int err = ferror(f) ? -1 : 0;
+  fclose(f);
+  return err;
+}
+
+
+static int cmp_str(const void* a, const void* b) {
+  return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+
+// adds the path of each *.md file in dir (sorted by name), or path itself
+// if it is not a directory, to paths
+static void add_paths(const char* path, WBuf* paths) {
+  struct stat st;
+  DIR* dir;
+  if (stat(path, &st) != 0 || !S_ISDIR(st.st_mode) || !(dir = opendir(path))) {
+    char* p = strdup(path);
+    WBufAppendBytes(paths, &p, sizeof(p));
+    return;
+  }
+  size_t start = WBufLen(paths);
+  struct dirent* ent;
+  while ((ent = readdir(dir))) {
+    size_t namelen = strlen(ent->d_name);
+    if (namelen < 3 || strcmp(ent->d_name + namelen - 3, ".md") != 0)
+      continue;
+    size_t len = strlen(path) + 1 + namelen + 1;
+    char* p = malloc(len);
+    snprintf(p, len, "%s/%s", path, ent->d_name);
+    WBufAppendBytes(paths, &p, sizeof(p));
+  }
+  closedir(dir);
+  qsort(paths->start + start, (WBufLen(paths) - start) / sizeof(char*), sizeof(char*), cmp_str);
+}
+
+
+static void print_header() {
+  printf("%-26s %8s %8s %7s %9s %9s %7s %8s %6s  %8s %8s %8s\n",
+    "file", "KiB", "MB/s", "ns/B", "p50 us", "p99 us", "allocs", "reallocs", "outcap",
+    "analyze", "inlines", "render");
+  printf("%-26s %8s %8s %7s %9s %9s %7s %8s %6s  %8s %8s %8s\n",
+    "", "", "", "", "", "", "", "", "", "ns/B", "ns/B", "ns/B");
+}
+
+
+static void print_result(const Result* r) {
+  double size = (double)r->size;
+  printf("%-26s %8.1f %8.1f %7.2f %9.1f %9.1f %7.1f %8.1f %6.2f  %8.2f %8.2f %8.2f\n",
+    r->name,
+    size / 1024.0,
+    size / r->mean_ns * 1e3,
+    r->mean_ns / size,
+    r->p50_ns / 1e3,
+    r->p99_ns / 1e3,
+    r->allocs,
+    r->reallocs,
+    r->outlen ? (double)r->outcap / r->outlen : 0.0,
+    r->analyze_ns / size,
+    r->inlines_ns / size,
+    r->render_ns / size);
+}
+
+
+static void usage(FILE* f) {
+  fprintf(f,
+    "usage: mdbench [options] <file.md|dir> ...\n"
+    "Benchmarks parsing and rendering each file, or each *.md file in dir.\n"
+    "options:\n"
+    "  -t <seconds>  Time to spend measuring each file (default %.1f)\n"
+    "  -f <flags>    md4c parse flags (default 0x%04x)\n",
+    budget, DEFAULT_PARSE_FLAGS);
+}
+
+
+int main(int argc, char** argv) {
+  WBuf paths = {0};
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      budget = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      parserFlags = (u32)strtoul(argv[++i], NULL, 0);
+    } else if (argv[i][0] == '-') {
+      usage(strcmp(argv[i], "-h") == 0 ? stdout : stderr);
+      return argv[i][1] != 'h';
+    } else {
+      add_paths(argv[i], &paths);
+    }
+  }
+  char** pathv = (char**)paths.start;
+  size_t npaths = WBufLen(&paths) / sizeof(char*);
+  if (npaths == 0) {
+    usage(stderr);
+    return 1;
+  }
+
+  Result total = { .name = "TOTAL" };
+  WBuf src = {0};
+  int status = 0;
+  print_header();
+  for (size_t i = 0; i < npaths; i++) {
+    if (read_file(pathv[i], &src) != 0) {
+      fprintf(stderr, "mdbench: %s: %s\n", pathv[i], strerror(errno));
+      status = 1;
+      continue;
+    }
+    Result r = {0};
+    const char* name = strrchr(pathv[i], '/');
+    r.name = name ? name + 1 : pathv[i];
+    if (bench(&r, src.start, WBufLen(&src)) != 0) {
+      fprintf(stderr, "mdbench: %s: failed to parse\n", pathv[i]);
+      status = 1;
+      continue;
+    }
+    print_result(&r);
+    fflush(stdout);
+
+    // TOTAL is for parsing each file once
+    total.size += r.size;
+    total.mean_ns += r.mean_ns;
+    total.p50_ns += r.p50_ns;
+    total.p99_ns += r.p99_ns;
+    total.allocs += r.allocs;
+    total.reallocs += r.reallocs;
+    total.outlen += r.outlen;
+    total.outcap += r.outcap;
+    total.analyze_ns += r.analyze_ns;
+    total.inlines_ns += r.inlines_ns;
+    total.render_ns += r.render_ns;
+  }
+  if (total.size > 0)
+    print_result(&total);
+
+  for (size_t i = 0; i < npaths; i++)
+    free(pathv[i]);
+  WBufFree(&paths);
+  WBufFree(&src);
+  return status;
+}
@@ -0,0 +1,73 @@
+#!/usr/bin/env node
+//
+// Measures per-keystroke latency of IncrementalParser.edit compared to parsing the
+// whole document again, by "typing" text at a number of places in a document.
+//
+// usage: incremental.js [<markdown-file>]  (defaults to ../spec/spec.md)
+//
+const fs = require('fs')
+const Path = require('path')
+const markdown = require('../../dist/markdown.node.js')
+
+const filename = process.argv[2] || Path.join(__dirname, "../spec/spec.md")
+const source = fs.readFileSync(filename, "utf8")
+const typed = "Hello *world*, [link](/url) `code` "
+const nplaces = 50
+
+function percentile(times, p) {
+  let v = times.slice().sort((a, b) => a - b)
+  return v[Math.min(v.length - 1, Math.floor(v.length * p))]
+}
+
+function report(name, times) {
+  let sum = times.reduce((a, b) => a + b, 0)
+  console.log(
+    `${name.padEnd(12)} avg ${(sum / times.length).toFixed(3)} ms` +
+    `  p50 ${percentile(times, 0.5).toFixed(3)} ms` +
+    `  p99 ${percentile(times, 0.99).toFixed(3)} ms` +
+    `  (${times.length} keystrokes)`
+  )
+}
+
+// insertion points at the start of lines spread evenly over the document
+let places = []
+for (let i = 0; i < nplaces; i++) {
+  let off = source.indexOf("\n", Math.floor(source.length * i / nplaces))
+  places.push(off < 0 ? source.length : off + 1)
+}
+
+{
+  let fullTimes = []
+  let incTimes = []
+  let p = new markdown.IncrementalParser()
+  let text = source
+  let html = p.parse(text)
+  let shift = 0
+
+  for (let place of places) {
+    let off = place + shift
+    for (let i = 0; i < typed.length; i++) {
+      let ch = typed[i]
+
+      let t = process.hrtime()
+      html = p.edit(off + i, 0, ch)
+      let d = process.hrtime(t)
+      incTimes.push(d[0] * 1e3 + d[1] / 1e6)
+
+      text = text.substr(0, off + i) + ch + text.substr(off + i)
+      t = process.hrtime()
+      let fullhtml = markdown.parse(text)
+      d = process.hrtime(t)
+      fullTimes.push(d[0] * 1e3 + d[1] / 1e6)
+
+      if (fullhtml != html)
+        throw new Error(`incremental result differs from full parse at offset ${off + i}`)
+    }
+    shift += typed.length
+  }
+  p.dispose()
+
+  console.log(`${Path.basename(filename)} (${Buffer.byteLength(source)} bytes)`)
+  report("full parse", fullTimes)
+  report("incremental", incTimes)
+}
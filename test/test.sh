@@ -2,10 +2,18 @@
 set -euo pipefail
 cd "$(dirname "$0")"
 
+pids=()
 node spec/spec.js &
+pids+=($!)
 
-for f in issue*.js; do
+for f in issue*.js api-*.js; do
   node "$f" "$@" &
+  pids+=($!)
 done
 
-wait
+# fail if any test failed
+status=0
+for pid in "${pids[@]}"; do
+  wait $pid || status=1
+done
+exit $status
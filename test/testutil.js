@@ -2,6 +2,7 @@ const Path = require("path")
 
 const libdir = process.argv.includes("-debug") ? "build/debug" : "dist"
 const md = require(`../${libdir}/markdown.node.js`)
+exports.md = md
 
 const line = "——————————————————————————————————————————————————"
 const wave = "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~"
@@ -22,16 +23,96 @@ exports.checkHTMLResult = function check(name, inputData, expectedOutputData) {
     log(`${name} OK`)
     return true
   }
+  reportFailure(name, expectedOutputData, actual)
+  return false
+}
+
+
+// checkEqual checks that two results (strings or byte arrays) are identical, e.g. the
+// output of some API and that of parse() for the same source. Unlike checkHTMLResult it
+// only logs failures, as it is meant to be called many times.
+exports.checkEqual = function checkEqual(name, actual, expected) {
+  actual = Buffer.from(actual)
+  expected = Buffer.from(expected)
+  if (expected.compare(actual) == 0) {
+    return true
+  }
+  reportFailure(name, expected, actual)
+  return false
+}
+
+
+function reportFailure(name, expected, actual) {
   exports.numFailures++
   logerr(`${name} FAIL`)
   console.error(`\n\nExpected output:\n${line}`)
-  inspectBuf(expectedOutputData, actual)
+  inspectBuf(expected, actual)
   console.error(`${line}\n\nActual output:\n${line}`)
-  inspectBuf(actual, expectedOutputData)
+  inspectBuf(actual, expected)
   console.error(line)
 }
 
 
+// random returns a function which returns pseudo-random integers in [0, n), the same
+// sequence for the same seed, so that failures can be reproduced
+exports.random = function random(seed) {
+  return n => {
+    seed = (seed + 0x6D2B79F5) | 0
+    let t = Math.imul(seed ^ (seed >>> 15), 1 | seed)
+    t = (t + Math.imul(t ^ (t >>> 7), 61 | t)) ^ t
+    return ((t ^ (t >>> 14)) >>> 0) % n
+  }
+}
+
+
+// randomSource returns markdown made of ntokens random pieces of block and inline
+// syntax, for differential tests of the APIs which parse in parts
+const sourceTokens = [
+  "para", "text", "after", "end", "é", "日本語", " ", "  ", "\t", "  \t", "    ",
+  "\n", "\n", "\n", "\n\n", "\n\n",
+  "# h", "h\n===", "---", "* ", "- ", "1. ", "> ", "- [x] ",
+  "```", "~~~", "```js\n", "<div>", "</div>", "<!-- c -->",
+  "|a|b|\n|-|-|\n", "*em*", "**strong**", "_u_", "~~del~~", "`c`", "&amp;", "\\*",
+  "[x]", "[x]: /u", "[y]: /v 'T'", "[link](/l)", "![img](/i)", "<http://a.b>",
+]
+
+exports.randomSource = function randomSource(rand, ntokens) {
+  let s = ""
+  for (let i = 0; i < ntokens; i++) {
+    s += sourceTokens[rand(sourceTokens.length)]
+  }
+  return s
+}
+
+
+// decodeEntity decodes a numeric character reference or one of the XML entities, like
+// the "json" format does. Other named entities are returned as they are.
+const xmlEntities = { "&amp;": "&", "&lt;": "<", "&gt;": ">", "&quot;": '"', "&apos;": "'" }
+
+exports.decodeEntity = function decodeEntity(entity) {
+  if (entity[1] == "#") {
+    const hex = entity[2] == "x" || entity[2] == "X"
+    const c = parseInt(entity.substring(hex ? 3 : 2, entity.length - 1), hex ? 16 : 10)
+    const invalid = c == 0 || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)
+    return String.fromCodePoint(invalid ? 0xFFFD : c)
+  }
+  return xmlEntities[entity] || entity
+}
+
+
+// htmlOutline reduces HTML from parse() to the names of its elements, as ⟨name⟩, and
+// its text with entities decoded (see decodeEntity), without whitespace, for comparison
+// with the syntax tree of the same source. Heading anchors are left out.
+exports.htmlOutline = function htmlOutline(html) {
+  return html
+    .replace(/<a id="[^"]*" class="anchor"[^>]*><\/a>/g, "")
+    .replace(/<\/[^>]*>/g, "")
+    .replace(/<([a-z0-9-]+)[^>]*>/g, "⟨$1⟩")
+    .replace(/&(#[0-9]+|#[xX][0-9a-fA-F]+|[a-zA-Z0-9]+);/g, exports.decodeEntity)
+    .replace(/\s+/g, "")
+}
+
+
 exports.exit = function() {
   process.exit(exports.numFailures > 0 ? 1 : 0)
 }
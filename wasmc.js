@@ -9,10 +9,14 @@ const m = {
     "src/md.c",
     "src/md4c.c",
     "src/fmt_html.c",
-    // "src/fmt_json.c",
+    "src/incremental.c",
+    "src/stream.c",
+    "src/fmt_json.c",
+    "src/fmt_bin.c",
   ],
   cflags: [
     "-DMD4C_USE_UTF8",
+    "-DMD4C_STATS", // enables the "stats" parse option
   ].concat(debug ? [
     // debug flags
     "-DDEBUG=1",
@@ -35,6 +39,11 @@ const m = {
 // —————————————————————————————————————————————————
 // products
 
+// flags of the *.simd.* products, which use wasm SIMD for vectorized scanning in md4c
+// and HTML escaping. Not every engine supports wasm SIMD, so the other products are
+// built without it.
+const simdflags = ["-msimd128"]
+
 // embedded wasm, ES module, nodejs-specific compression
 // Suitable for using or bundling as a library targeting nodejs only
 module({ ...m,
@@ -60,4 +69,42 @@ if (!debug) {
     outwasm: outdir + "/markdown.wasm",
     format:  "es",
   })
+
+  // embedded wasm, nodejs-specific compression, wasm SIMD
+  module({ ...m,
+    name:    "markdown-simd-node",
+    out:     outdir + "/markdown.simd.node.js",
+    target:  "node",
+    embed:   true,
+    cflags:  m.cflags.concat(simdflags),
+  })
+
+  // sideloaded wasm, ES module, wasm SIMD
+  module({ ...m,
+    name:    "markdown-simd-es",
+    out:     outdir + "/markdown.simd.es.js",
+    outwasm: outdir + "/markdown.simd.wasm",
+    format:  "es",
+    cflags:  m.cflags.concat(simdflags),
+  })
+
+  // embedded wasm, ES module, with the "threads" parse option enabled.
+  // Requires SharedArrayBuffer (in browsers, a cross-origin isolated page.)
+  module({ ...m,
+    name:    "markdown-threads-es",
+    out:     outdir + "/markdown.threads.es.js",
+    outwasm: outdir + "/markdown.threads.wasm",
+    format:  "es",
+    // Threads must come from the pre-started pool since the main thread blocks
+    // while waiting for them; hence FMT_HTML_MAX_THREADS = pool size + 1.
+    cflags:  m.cflags.concat([
+      "-pthread",
+      "-DMD4C_USE_THREADS",
+      "-DFMT_HTML_MAX_THREADS=8",
+    ]),
+    lflags:  m.lflags.concat([
+      "-pthread",
+      "-s","PTHREAD_POOL_SIZE=7",
+    ]),
+  })
 }